@@ -5,6 +5,20 @@ set -ex
 CC=cc
 CFLAGS='-O2 -g -Werror -Weverything -Wno-gnu-zero-variadic-macro-arguments -Wno-gnu-empty-initializer -Wno-zero-length-array -Wno-unused-parameter'
 
-${CC} ${CFLAGS} -o infiniteloop_test infiniteloop.c infiniteloop_test.c
+${CC} ${CFLAGS} -o infiniteloop_tablegen infiniteloop_tablegen.c
+${CC} ${CFLAGS} -o infiniteloop_test infiniteloop.c infiniteloop_large.c infiniteloop_parallel.c \
+    infiniteloop_refutation.c infiniteloop_sched.c infiniteloop_snapshot.c \
+    infiniteloop_test.c -lpthread -lm
 ./infiniteloop_test
-${CC} ${CFLAGS} -o infiniteloop_cmd infiniteloop.c infiniteloop_cmd.c
+${CC} ${CFLAGS} -o infiniteloop_cmd infiniteloop.c infiniteloop_large.c \
+    infiniteloop_snapshot.c infiniteloop_cmd.c -lpthread -lm
+${CC} ${CFLAGS} -o infiniteloop_check infiniteloop.c infiniteloop_large.c \
+    infiniteloop_refutation.c infiniteloop_check.c -lm
+${CC} ${CFLAGS} -o infiniteloop_dedup infiniteloop.c infiniteloop_large.c \
+    infiniteloop_dedup.c -lpthread -lm
+${CC} ${CFLAGS} -o infiniteloop_scramble infiniteloop.c infiniteloop_large.c \
+    infiniteloop_scramble.c -lpthread -lm
+${CC} ${CFLAGS} -o infiniteloop_snapgen infiniteloop.c infiniteloop_large.c \
+    infiniteloop_snapshot.c infiniteloop_snapgen.c -lm
+${CC} ${CFLAGS} -o infiniteloop_bench infiniteloop.c infiniteloop_large.c \
+    infiniteloop_parallel.c infiniteloop_bench.c -lpthread -lm
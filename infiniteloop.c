@@ -3,16 +3,24 @@
 // This file is distributed under a 2-clause BSD license.
 // See the LICENSE file for details.
 
+#include <errno.h>
+#include <limits.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <unistd.h>
 
 #include "infiniteloop.h"
+#include "infiniteloop_impl.h"
+#include "infiniteloop_tablebase.h"
 
-static bool dpll(const struct il_problem *, unsigned char[IL_AXIS][IL_AXIS],
-                 bool (*)(const struct il_solution *, void *), void *);
-
-bool il_problem_parse(const char *in, struct il_problem *p) {
+// Parses a puzzle input that ends at a given position or at a null
+// byte, whichever comes first.
+static bool parse_board(const char *in, const char *end,
+                        struct il_problem *p) {
   // Throw away the existing board.
   for (size_t x = 0; x < IL_AXIS; ++x)
     for (size_t y = 0; y < IL_AXIS; ++y)
@@ -20,7 +28,7 @@ bool il_problem_parse(const char *in, struct il_problem *p) {
 
   // Parse the input string.
   size_t x = 1, y = 1;
-  for (;;) {
+  while (in < end) {
     switch (*in++) {
       case '\0':
         return true;
@@ -69,44 +77,122 @@ bool il_problem_parse(const char *in, struct il_problem *p) {
         break;
     }
   }
+  return true;
 }
 
-// Rotates a cell clockwise by i steps. The number of steps has to be
-// provided in the form 1 << i.
-static unsigned char rotate(unsigned char a, unsigned char b) {
-  unsigned char v = a * b;
-  return (v | (v >> 4)) & 0xf;
+bool il_problem_parse(const char *in, struct il_problem *p) {
+  return parse_board(in, in + strlen(in), p);
 }
 
-// Rotates a cell by 2 steps, effectively turning the cell upside down.
-static unsigned char rotate2(unsigned char c) {
-  return ((c << 2) | (c >> 2)) & 0xf;
+// Returns true if a solution has been fully computed. This means that
+// every cell can only be placed in exactly one way.
+static bool finished(const unsigned char options[IL_AXIS][IL_AXIS]) {
+  for (size_t x = 1; x < IL_AXIS - 1; ++x)
+    for (size_t y = 1; y < IL_AXIS - 1; ++y)
+      if (!single_bit_set(options[x][y]))
+        return false;
+  return true;
 }
 
-// Determines the union of all of the edges that could be set if the
-// cell is rotated by any number of steps encoded in a bitmask. This
-// function is effectively identical to:
+// Order in which propagation visits the cells of a board.
 //
-// fanout(a, b) == rotate(a, b & 0x1) | rotate(a, b & 0x2) |
-//                 rotate(a, b & 0x4) | rotate(a, b & 0x8)
-static unsigned char fanout(unsigned char a, unsigned char b) {
-  unsigned char v =
-      a * (b & 0x1) | a * (b & 0x2) | a * (b & 0x4) | a * (b & 0x8);
-  return (v | (v >> 4)) & 0xf;
-}
+// Sweeping over the board row by row, a change only reaches the cells
+// that come after it during the same sweep. Long chains of corners and
+// straights are fully determined by their ends, but may take one sweep
+// per cell to settle. The order therefore lists the cells of every
+// chain consecutively, so that sweeping back and forth lets changes
+// travel along a chain in either direction. Adjacent dead ends, which
+// either point at each other or both away from each other, are listed
+// as a pair. Empty cells never change, so they are left out.
+struct chains {
+  unsigned char x[(IL_AXIS - 2) * (IL_AXIS - 2)];
+  unsigned char y[(IL_AXIS - 2) * (IL_AXIS - 2)];
+  size_t ncells;
+};
 
-// Returns true if the cell only has a single edge set.
-static bool single_bit_set(unsigned char c) {
-  return (c & (c - 1)) == 0;
+// Appends the chain starting at a cell to the order, walking from cell
+// to cell for as long as the chain continues. Cells that have been
+// visited have their degree cleared.
+static void chain_walk(struct chains *c,
+                       unsigned char degree[IL_AXIS][IL_AXIS], size_t x,
+                       size_t y) {
+  for (;;) {
+    unsigned char d = degree[x][y];
+    degree[x][y] = 0;
+    c->x[c->ncells] = (unsigned char)x;
+    c->y[c->ncells] = (unsigned char)y;
+    ++c->ncells;
+
+    // Chains continue through cells with two edges. Dead ends only
+    // continue into another dead end, ending the chain right after.
+    if (d > 2)
+      return;
+    if (degree[x][y - 1] == d) {
+      --y;
+    } else if (degree[x + 1][y] == d) {
+      ++x;
+    } else if (degree[x][y + 1] == d) {
+      ++y;
+    } else if (degree[x - 1][y] == d) {
+      --x;
+    } else {
+      return;
+    }
+    if (d == 1) {
+      degree[x][y] = 0;
+      c->x[c->ncells] = (unsigned char)x;
+      c->y[c->ncells] = (unsigned char)y;
+      ++c->ncells;
+      return;
+    }
+  }
 }
 
-// Returns true if a solution has been fully computed. This means that
-// every cell can only be placed in exactly one way.
-static bool finished(const unsigned char options[IL_AXIS][IL_AXIS]) {
+// Computes the order in which propagation visits the cells of a board.
+static void chains_init(const struct il_problem *p, struct chains *c) {
+  // Number of edges of every cell that has not been visited yet. The
+  // cells around the board and empty cells are never visited.
+  unsigned char degree[IL_AXIS][IL_AXIS] = {};
   for (size_t x = 1; x < IL_AXIS - 1; ++x)
     for (size_t y = 1; y < IL_AXIS - 1; ++y)
-      if (!single_bit_set(options[x][y]))
-        return false;
+      degree[x][y] = (unsigned char)__builtin_popcount(p->board[x][y]);
+  c->ncells = 0;
+
+  // Start walking at the ends of chains, being cells with two edges
+  // that have at most one neighbour with two edges.
+  for (size_t x = 1; x < IL_AXIS - 1; ++x)
+    for (size_t y = 1; y < IL_AXIS - 1; ++y)
+      if (degree[x][y] == 2 &&
+          (degree[x][y - 1] == 2) + (degree[x + 1][y] == 2) +
+                  (degree[x][y + 1] == 2) + (degree[x - 1][y] == 2) <=
+              1)
+        chain_walk(c, degree, x, y);
+
+  // Add the remaining cells, including chains that form a cycle.
+  for (size_t x = 1; x < IL_AXIS - 1; ++x)
+    for (size_t y = 1; y < IL_AXIS - 1; ++y)
+      if (degree[x][y] != 0)
+        chain_walk(c, degree, x, y);
+}
+
+// Restricts the placement of a single cell, marking its neighbours as
+// dirty if it changes. Returns false on a contradiction.
+static bool restrict_cell_dirty(const struct il_problem *p,
+                                unsigned char options[IL_AXIS][IL_AXIS],
+                                bool dirty[IL_AXIS][IL_AXIS], size_t x,
+                                size_t y, bool *made_change) {
+  unsigned char new_options = restrict_cell(p, options, x, y);
+  if (new_options == options[x][y])
+    return true;
+  // Fail if the cell cannot be placed in any direction.
+  if (new_options == 0) {
+    PROBE2(contradiction, x, y);
+    return false;
+  }
+  options[x][y] = new_options;
+  dirty[x][y - 1] = dirty[x + 1][y] = dirty[x][y + 1] = dirty[x - 1][y] =
+      true;
+  *made_change = true;
   return true;
 }
 
@@ -118,159 +204,1454 @@ static bool finished(const unsigned char options[IL_AXIS][IL_AXIS]) {
 // discovering a contradiction, this function returns false.
 //
 // Execution of this function terminates if no more inference steps can
-// be taken.
-static bool propagate(const struct il_problem *p,
+// be taken. Cells are visited in the order computed by chains_init(),
+// alternating between sweeping forward and backward.
+static bool propagate(const struct il_problem *p, const struct chains *c,
                       unsigned char options[IL_AXIS][IL_AXIS]) {
-  bool made_change;
-  do {
+  // The first sweep visits every cell. Later sweeps, which only take
+  // place if something changed, only revisit cells whose neighbours
+  // have changed.
+  bool dirty[IL_AXIS][IL_AXIS] = {};
+  bool made_change = false;
+  for (size_t i = 0; i < c->ncells; ++i) {
+    size_t x = c->x[i], y = c->y[i];
+    dirty[x][y] = false;
+    if (!restrict_cell_dirty(p, options, dirty, x, y, &made_change))
+      return false;
+  }
+  bool forward = false;
+  while (made_change) {
     made_change = false;
-    for (size_t x = 1; x < IL_AXIS - 1; ++x)
-      for (size_t y = 1; y < IL_AXIS - 1; ++y) {
-#define YES(x, y, idx) (fanout(p->board[x][y], options[x][y]) & (1 << idx))
-        // Determine which edges may be present.
-        unsigned char may_be_set = rotate2(YES(x, y + 1, 0) | YES(x - 1, y, 1) |
-                                           YES(x, y - 1, 2) | YES(x + 1, y, 3));
-#undef YES
-#define NO(x, y, idx) (fanout(p->board[x][y] ^ 0xf, options[x][y]) & (1 << idx))
-        // Determine which edges may be absent.
-        unsigned char may_be_clear = rotate2(NO(x, y + 1, 0) | NO(x - 1, y, 1) |
-                                             NO(x, y - 1, 2) | NO(x + 1, y, 3));
-#undef NO
-
-        // Compute ways in which this cell may be placed by using the
-        // bitmasks obtained above.
-        unsigned char new_options = 0;
-        for (unsigned char i = 0x1; i <= 0x8; i <<= 1) {
-          if ((options[x][y] & i) != 0) {
-            unsigned char c = rotate(p->board[x][y], i);
-            if ((c & ~may_be_set) == 0 && (c | may_be_clear) == 0xf)
-              new_options |= i;
-          }
-        }
-
-        if (new_options != options[x][y]) {
-          // Fail if the cell cannot be placed in any direction.
-          if (new_options == 0)
-            return false;
-          made_change = true;
-        }
-        options[x][y] = new_options;
+    for (size_t i = 0; i < c->ncells; ++i) {
+      size_t j = forward ? i : c->ncells - 1 - i;
+      size_t x = c->x[j], y = c->y[j];
+      if (dirty[x][y]) {
+        dirty[x][y] = false;
+        if (!restrict_cell_dirty(p, options, dirty, x, y, &made_change))
+          return false;
       }
-  } while (made_change);
+    }
+    forward = !forward;
+  }
   return true;
 }
 
-// Reports a valid solution to the caller.
-static bool report(const struct il_problem *p,
-                   const unsigned char options[IL_AXIS][IL_AXIS],
-                   bool (*callback)(const struct il_solution *, void *),
-                   void *thunk) {
-  // Extract edges from board.
-  struct il_solution s;
+// Extracts the edges of a solution from a board on which every cell
+// has been placed.
+static void extract_solution(const struct il_problem *p,
+                             const unsigned char options[IL_AXIS][IL_AXIS],
+                             struct il_solution *s) {
   for (size_t x = 0; x < IL_AXIS - 3; ++x)
     for (size_t y = 0; y < IL_AXIS - 2; ++y)
-      s.horizontal[x][y] =
+      s->horizontal[x][y] =
           rotate(p->board[x + 1][y + 1], options[x + 1][y + 1]) & 0x2;
   for (size_t x = 0; x < IL_AXIS - 2; ++x)
     for (size_t y = 0; y < IL_AXIS - 3; ++y)
-      s.vertical[x][y] =
+      s->vertical[x][y] =
           rotate(p->board[x + 1][y + 1], options[x + 1][y + 1]) & 0x4;
+}
 
-  // Invoke the user-supplied callback.
+// Reports a valid solution to the caller.
+static bool report(const struct il_problem *p,
+                   const unsigned char options[IL_AXIS][IL_AXIS],
+                   bool (*callback)(const struct il_solution *, void *),
+                   void *thunk) {
+  struct il_solution s;
+  extract_solution(p, options, &s);
   return callback(&s, thunk);
 }
 
+// Determines the component of connected non-empty cells that contains
+// a given cell. Returns false if the component is too large to be
+// stored in the tablebase.
+static bool find_component(const struct il_problem *p, size_t x, size_t y,
+                           struct component *c) {
+  c->ncells = 1;
+  c->x[0] = x;
+  c->y[0] = y;
+  c->shape[0] = shape(p->board[x][y]);
+  for (size_t i = 0; i < c->ncells; ++i) {
+    const size_t nx[4] = {c->x[i], c->x[i] + 1, c->x[i], c->x[i] - 1};
+    const size_t ny[4] = {c->y[i] - 1, c->y[i], c->y[i] + 1, c->y[i]};
+    for (size_t d = 0; d < 4; ++d) {
+      if (p->board[nx[d]][ny[d]] != 0) {
+        // Add neighbouring cells that are not part of the component yet.
+        bool seen = false;
+        for (size_t j = 0; j < c->ncells; ++j)
+          if (c->x[j] == nx[d] && c->y[j] == ny[d])
+            seen = true;
+        if (!seen) {
+          if (c->ncells == TABLEBASE_CELLS)
+            return false;
+          c->x[c->ncells] = nx[d];
+          c->y[c->ncells] = ny[d];
+          c->shape[c->ncells] = shape(p->board[nx[d]][ny[d]]);
+          ++c->ncells;
+        }
+      }
+    }
+  }
+  return component_canonicalize(c);
+}
+
+// Looks up a small component in the tablebase. Returns NULL if the
+// component has no solutions.
+static const struct tablebase_entry *tablebase_lookup(
+    const struct component *c) {
+  size_t lo = 0, hi = sizeof(tablebase_entries) / sizeof(tablebase_entries[0]);
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    if (tablebase_entries[mid].key < c->key)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo == sizeof(tablebase_entries) / sizeof(tablebase_entries[0]) ||
+                 tablebase_entries[lo].key != c->key
+             ? NULL
+             : &tablebase_entries[lo];
+}
+
+// Node in the search tree at which a guess is made.
+//
+// The options table stores the state of the board after propagation.
+// Children of the node are constructed by either placing a single cell
+// in all remaining directions, or by placing a small component in all
+// ways stored in the tablebase.
+struct frame {
+  unsigned char options[IL_AXIS][IL_AXIS];
+  size_t x;
+  size_t y;
+  const struct tablebase_entry *entry;
+  struct component component;
+
+  // Number of solutions found in the subtree of the node so far. Once
+  // all children have been visited, the number is stored in the
+  // transposition table under the key of the node, unless parts of the
+  // subtree have been split off, as tracked by the complete flag below.
+  double solutions;
+  uint64_t key;
+  unsigned long nodes;
+
+  // Estimated fraction of the search space covered by the subtree of
+  // the node, assuming that all children of a node have subtrees of
+  // the same size, and the number of children of the node.
+  double weight;
+  uint32_t children;
+
+  uint32_t next;
+  unsigned char remaining;
+  unsigned char preferred;
+  bool complete;
+  unsigned char padding[5];
+};
+
+// State of the DPLL algorithm.
+//
+// Instead of recursing, the DPLL algorithm keeps track of the path from
+// the root of the search tree to the current node explicitly. This
+// allows the search to be suspended at the point where a guess is made
+// and resumed later on. As every guess places at least one more cell,
+// the depth of the search tree is bounded by the number of cells. The
+// frame following the top of the stack is used to construct children.
+struct il_solver {
+  const struct il_problem *p;
+  bool (*callback)(const struct il_solution *, void *);
+  void *thunk;
+  size_t depth;
+
+  // Transposition table consulted and populated by the solver, if any.
+  struct il_table *table;
+
+  // Order in which propagation visits cells.
+  struct chains chains;
+
+  // Counters reported through tracing probes and il_solver_get_stats().
+  unsigned long nodes;
+  unsigned long solutions;
+  unsigned long table_hits;
+  double count;
+
+  // Estimated fraction of the search space explored, obtained by adding
+  // up the weights of the leaves of the search tree visited. This and
+  // the number of nodes visited are read by il_solver_get_progress()
+  // without any locking, meaning they are updated atomically.
+  double explored;
+  double start;
+
+  struct frame frames[(IL_AXIS - 2) * (IL_AXIS - 2) + 1];
+
+  bool pending;
+  bool done;
+  bool stopped;
+
+  // Whether cells are guessed in a fixed order instead of at random,
+  // and whether belief propagation is used to pick them instead.
+  bool deterministic;
+  bool belief_propagation;
+  unsigned char padding[3];
+};
+
+// Transposition table, storing the number of solutions in subtrees of
+// the search tree that have been visited before.
+//
+// The table is shared by solvers running on different threads without
+// any locking. Every bucket holds a fixed number of entries, whose
+// words are stored XOR'ed together with the key. Entries that are read
+// while being overwritten by another thread fail to match their key,
+// and are simply treated as absent.
+#define TABLE_BUCKET_ENTRIES 4
+
+struct table_entry {
+  uint64_t check;
+  uint64_t solutions;
+  uint64_t work;
+};
+
+struct il_table {
+  size_t mask;
+  struct table_entry (*buckets)[TABLE_BUCKET_ENTRIES];
+};
+
+struct il_table *il_table_create(size_t size) {
+  struct il_table *t = malloc(sizeof(*t));
+  if (t == NULL)
+    return NULL;
+  size_t nbuckets = 1;
+  while (nbuckets * 2 <= size / sizeof(*t->buckets))
+    nbuckets *= 2;
+  t->mask = nbuckets - 1;
+  t->buckets = calloc(nbuckets, sizeof(*t->buckets));
+  if (t->buckets == NULL) {
+    free(t);
+    return NULL;
+  }
+  return t;
+}
+
+void il_table_destroy(struct il_table *t) {
+  free(t->buckets);
+  free(t);
+}
+
+// Computes the key of a node in the transposition table. The number of
+// solutions in the subtree of a node only depends on the cells that
+// have not been placed yet, as propagation already removed the options
+// of these cells that conflict with their placed neighbours. Nodes that
+// only differ in placed cells, such as nodes in which independent parts
+// of the board have been placed in a different order, share their key.
+static uint64_t table_key(const unsigned char options[IL_AXIS][IL_AXIS]) {
+  uint64_t key = 0xcbf29ce484222325;
+  for (size_t x = 1; x < IL_AXIS - 1; ++x) {
+    for (size_t y = 1; y < IL_AXIS - 1; ++y) {
+      if (!single_bit_set(options[x][y])) {
+        key ^= (x * IL_AXIS + y) << 4 | options[x][y];
+        key *= 0x100000001b3;
+      }
+    }
+  }
+
+  // Mix the bits, as the low bits are used to select the bucket.
+  key ^= key >> 33;
+  key *= 0xff51afd7ed558ccd;
+  key ^= key >> 33;
+  return key;
+}
+
+static bool table_lookup(struct il_table *t, uint64_t key,
+                         double *solutions) {
+  struct table_entry *b = t->buckets[key & t->mask];
+  for (size_t i = 0; i < TABLE_BUCKET_ENTRIES; ++i) {
+    uint64_t work = __atomic_load_n(&b[i].work, __ATOMIC_RELAXED);
+    uint64_t value = __atomic_load_n(&b[i].solutions, __ATOMIC_RELAXED);
+    uint64_t check = __atomic_load_n(&b[i].check, __ATOMIC_RELAXED);
+    if (work != 0 && (check ^ value ^ work) == key) {
+      memcpy(solutions, &value, sizeof(*solutions));
+      return true;
+    }
+  }
+  return false;
+}
+
+// Stores the number of solutions in the subtree of a node, together
+// with the number of nodes visited to compute it. Entries that took the
+// least work to compute are replaced first.
+static void table_store(struct il_table *t, uint64_t key, double solutions,
+                        unsigned long nodes) {
+  struct table_entry *b = t->buckets[key & t->mask];
+  size_t victim = 0;
+  uint64_t victim_work = UINT64_MAX;
+  for (size_t i = 0; i < TABLE_BUCKET_ENTRIES; ++i) {
+    uint64_t work = __atomic_load_n(&b[i].work, __ATOMIC_RELAXED);
+    uint64_t check = __atomic_load_n(&b[i].check, __ATOMIC_RELAXED) ^
+                     __atomic_load_n(&b[i].solutions, __ATOMIC_RELAXED) ^ work;
+    if (work != 0 && check == key) {
+      victim = i;
+      break;
+    }
+    if (work < victim_work) {
+      victim = i;
+      victim_work = work;
+    }
+  }
+
+  uint64_t value, work = (uint64_t)nodes + 1;
+  memcpy(&value, &solutions, sizeof(value));
+  __atomic_store_n(&b[victim].work, work, __ATOMIC_RELAXED);
+  __atomic_store_n(&b[victim].solutions, value, __ATOMIC_RELAXED);
+  __atomic_store_n(&b[victim].check, key ^ value ^ work, __ATOMIC_RELAXED);
+}
+
+// Number of rounds of belief propagation performed before guessing.
+#define BELIEF_ROUNDS 10
+
+// Cell visited by belief propagation, along with its outgoing edges for
+// every rotation.
+struct belief_cell {
+  unsigned char x;
+  unsigned char y;
+  unsigned char options;
+  unsigned char edges[4];
+};
+
+// Estimates how likely every option of every cell that has not been
+// placed yet is to be part of a solution by performing loopy belief
+// propagation. Every cell sends its neighbours the probability of the
+// edge between them being present, given the options of the cell and
+// the messages received from its other neighbours. Cells that have been
+// placed and cells on the outer border send fixed messages, meaning that
+// only the cells that have not been placed need to be visited.
+static void belief_propagation(const struct il_problem *p,
+                               const unsigned char options[IL_AXIS][IL_AXIS],
+                               double beliefs[IL_AXIS][IL_AXIS][4]) {
+  double messages[IL_AXIS][IL_AXIS][4];
+  struct belief_cell cells[(IL_AXIS - 2) * (IL_AXIS - 2)];
+  size_t ncells = 0;
+  for (size_t x = 0; x < IL_AXIS; ++x) {
+    for (size_t y = 0; y < IL_AXIS; ++y) {
+      if (x == 0 || y == 0 || x == IL_AXIS - 1 || y == IL_AXIS - 1) {
+        for (unsigned int d = 0; d < 4; ++d)
+          messages[x][y][d] = 0.0;
+      } else if (single_bit_set(options[x][y])) {
+        unsigned char edges = rotate(p->board[x][y], options[x][y]);
+        for (unsigned int d = 0; d < 4; ++d)
+          messages[x][y][d] = (edges >> d & 0x1) != 0 ? 1.0 : 0.0;
+      } else {
+        for (unsigned int d = 0; d < 4; ++d)
+          messages[x][y][d] = 0.5;
+        cells[ncells].x = (unsigned char)x;
+        cells[ncells].y = (unsigned char)y;
+        cells[ncells].options = options[x][y];
+        for (unsigned int i = 0; i < 4; ++i)
+          cells[ncells].edges[i] =
+              rotate(p->board[x][y], (unsigned char)(1 << i));
+        ++ncells;
+      }
+    }
+  }
+
+  for (unsigned int round = 0; round <= BELIEF_ROUNDS; ++round) {
+    for (size_t j = 0; j < ncells; ++j) {
+      size_t x = cells[j].x, y = cells[j].y;
+
+      // Gather the messages sent by the neighbours of the cell.
+      const double incoming[4] = {messages[x][y - 1][2], messages[x + 1][y][3],
+                                  messages[x][y + 1][0], messages[x - 1][y][1]};
+
+      if (round == BELIEF_ROUNDS) {
+        // Compute the beliefs from the final messages.
+        double total = 0.0;
+        for (unsigned int i = 0; i < 4; ++i) {
+          double w = 0.0;
+          if ((cells[j].options >> i & 0x1) != 0) {
+            w = 1.0;
+            for (unsigned int d = 0; d < 4; ++d)
+              w *= (cells[j].edges[i] >> d & 0x1) != 0 ? incoming[d]
+                                                       : 1.0 - incoming[d];
+          }
+          beliefs[x][y][i] = w;
+          total += w;
+        }
+        for (unsigned int i = 0; i < 4; ++i)
+          beliefs[x][y][i] = total > 0.0 ? beliefs[x][y][i] / total : 0.25;
+        continue;
+      }
+
+      // Compute the outgoing messages, leaving out the message received
+      // from the neighbour the message is sent to. The products of the
+      // other messages are formed from products of the messages before
+      // and after it. Messages are damped to make convergence more
+      // likely.
+      double set[4] = {0.0, 0.0, 0.0, 0.0}, clear[4] = {0.0, 0.0, 0.0, 0.0};
+      for (unsigned int i = 0; i < 4; ++i) {
+        if ((cells[j].options >> i & 0x1) != 0) {
+          unsigned char edges = cells[j].edges[i];
+          double weights[4], before[4], after = 1.0;
+          for (unsigned int d = 0; d < 4; ++d)
+            weights[d] = (edges >> d & 0x1) != 0 ? incoming[d]
+                                                 : 1.0 - incoming[d];
+          before[0] = 1.0;
+          for (unsigned int d = 1; d < 4; ++d)
+            before[d] = before[d - 1] * weights[d - 1];
+          for (unsigned int d = 4; d-- > 0;) {
+            double w = before[d] * after;
+            if ((edges >> d & 0x1) != 0)
+              set[d] += w;
+            else
+              clear[d] += w;
+            after *= weights[d];
+          }
+        }
+      }
+      for (unsigned int d = 0; d < 4; ++d) {
+        double message =
+            set[d] + clear[d] > 0.0 ? set[d] / (set[d] + clear[d]) : 0.5;
+        messages[x][y][d] = (messages[x][y][d] + message) / 2.0;
+      }
+    }
+  }
+}
+
 // Performs the recursion step as part of the DPLL algorithm.
 //
 // If inference is unable to obtain a full solution (e.g., due to
 // ambiguities), this function can be used to traverse the solution
 // space. It selects a random cell that still has multiple solutions and
-// reinvokes the DPLL algorithm by placing that cell in all allowed
-// directions.
-static bool guess(const struct il_problem *p,
-                  const unsigned char options[IL_AXIS][IL_AXIS],
-                  bool (*callback)(const struct il_solution *, void *),
-                  void *thunk) {
-  // Pick a random cell with multiple solutions.
+// prepares the frame for placing that cell in all allowed directions.
+// If deterministic, the first such cell is selected instead. With
+// belief propagation, the cell whose placement is the least certain is
+// selected, as guessing it splits the search space most evenly, and its
+// most likely option is tried first. Cells that are part of small
+// components are resolved by using the tablebase instead.
+static void guess(const struct il_solver *s, struct frame *f) {
+  const struct il_problem *p = s->p;
   size_t x, y;
-  do {
-    size_t u = arc4random_uniform(IL_AXIS * IL_AXIS);
+  f->preferred = 0;
+  if (s->belief_propagation) {
+    double beliefs[IL_AXIS][IL_AXIS][4], best = 2.0;
+    belief_propagation(p, f->options, beliefs);
+    x = y = 0;
+    for (size_t u = 1; u < IL_AXIS - 1; ++u) {
+      for (size_t v = 1; v < IL_AXIS - 1; ++v) {
+        if (!single_bit_set(f->options[u][v])) {
+          // Determine the most likely option of the cell.
+          double likely = -1.0;
+          unsigned char preferred = 0;
+          for (unsigned int i = 0; i < 4; ++i) {
+            if ((f->options[u][v] >> i & 0x1) != 0 &&
+                beliefs[u][v][i] > likely) {
+              likely = beliefs[u][v][i];
+              preferred = (unsigned char)(1 << i);
+            }
+          }
+          if (likely < best) {
+            best = likely;
+            x = u;
+            y = v;
+            f->preferred = preferred;
+          }
+        }
+      }
+    }
+  } else if (s->deterministic) {
+    size_t u = 0;
+    while (single_bit_set(f->options[u / IL_AXIS][u % IL_AXIS]))
+      ++u;
     x = u / IL_AXIS;
     y = u % IL_AXIS;
-  } while (single_bit_set(options[x][y]));
+  } else {
+    // Pick a random cell with multiple solutions.
+    do {
+      size_t u = arc4random_uniform(IL_AXIS * IL_AXIS);
+      x = u / IL_AXIS;
+      y = u % IL_AXIS;
+    } while (single_bit_set(f->options[x][y]));
+  }
+  f->x = x;
+  f->y = y;
+  f->remaining = f->options[x][y];
 
-  // Reinvoke the DPLL algorithm with all allowed directions.
-  for (unsigned char i = 0x1; i <= 0x8; i <<= 1) {
-    if ((options[x][y] & i) != 0) {
-      unsigned char new_options[IL_AXIS][IL_AXIS];
-      memcpy(new_options, options, sizeof(new_options));
-      new_options[x][y] = i;
-      if (!dpll(p, new_options, callback, thunk))
-        return false;
+  // If the cell is part of a small component, place the component as a
+  // whole by using the solutions stored in the tablebase. Components
+  // that are absent from the tablebase have no solutions.
+  f->entry = NULL;
+  f->children = (uint32_t)((f->remaining & 0x1) + (f->remaining >> 1 & 0x1) +
+                           (f->remaining >> 2 & 0x1) + (f->remaining >> 3));
+  if (find_component(p, x, y, &f->component)) {
+    f->entry = tablebase_lookup(&f->component);
+    f->next = 0;
+    f->remaining = 0;
+    f->children = f->entry != NULL ? f->entry->count : 0;
+  }
+}
+
+// Returns the current time in seconds.
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Adds the weight of a leaf of the search tree to the fraction of the
+// search space explored.
+static void add_explored(struct il_solver *s, double weight) {
+  double explored = s->explored + weight;
+  __atomic_store(&s->explored, &explored, __ATOMIC_RELAXED);
+}
+
+// Constructs the next child of the node at the top of the stack in the
+// frame following it. Returns false if no more children exist.
+static bool next_child(struct il_solver *s) {
+  const struct il_problem *p = s->p;
+  const struct frame *f = &s->frames[s->depth - 1];
+  struct frame *child = &s->frames[s->depth];
+  if (f->remaining != 0) {
+    // Place the cell in the next allowed direction, starting with the
+    // preferred one.
+    unsigned char option = (f->remaining & f->preferred) != 0
+                               ? f->preferred
+                               : f->remaining & (unsigned char)-f->remaining;
+    s->frames[s->depth - 1].remaining &= (unsigned char)~option;
+    memcpy(child->options, f->options, sizeof(child->options));
+    child->options[f->x][f->y] = option;
+    child->weight = f->weight / f->children;
+    return true;
+  }
+
+  while (f->entry != NULL && f->next < f->entry->count) {
+    // Convert the edges of every cell of the component back to the
+    // orientation of the component on the board and select the
+    // matching rotation. Skip placements that have already been ruled
+    // out.
+    const struct component *c = &f->component;
+    uint32_t solution = tablebase_solutions[f->entry->offset + f->next];
+    ++s->frames[s->depth - 1].next;
+    memcpy(child->options, f->options, sizeof(child->options));
+    bool allowed = true;
+    for (size_t j = 0; j < c->ncells && allowed; ++j) {
+      size_t x = c->x[c->order[j]], y = c->y[c->order[j]];
+      unsigned char edges = symmetry_edges_inverse(
+          c->symmetry, (unsigned char)(solution >> (4 * j) & 0xf));
+      child->options[x][y] =
+          option_for_edges(p->board[x][y], f->options[x][y], edges);
+      allowed = child->options[x][y] != 0;
     }
+    child->weight = f->weight / f->children;
+    if (allowed)
+      return true;
+    add_explored(s, child->weight);
   }
-  return true;
+  return false;
+}
+
+// Adds solutions found in the subtree of the node at a given depth to
+// the number of solutions of its parent.
+static void add_solutions(struct il_solver *s, size_t depth,
+                          double solutions) {
+  if (depth == 0)
+    s->count += solutions;
+  else
+    s->frames[depth - 1].solutions += solutions;
 }
 
-// Perform the DPLL algorithm.
+// Removes the node at the top of the stack once all of its children
+// have been visited, storing the number of solutions in its subtree.
+static void backtrack(struct il_solver *s) {
+  const struct frame *f = &s->frames[--s->depth];
+  if (f->children == 0)
+    add_explored(s, f->weight);
+  if (s->table != NULL && f->complete)
+    table_store(s->table, f->key, f->solutions, s->nodes - f->nodes);
+  add_solutions(s, s->depth, f->solutions);
+}
+
+// Perform the DPLL algorithm on the node in the frame following the top
+// of the stack.
 //
 // The DPLL algorithm starts out by inferring as many cell positions as
 // possible. If this already yields a valid solution, we report it back
-// to the caller. If not, we perform backtracking and run the algorithm
-// once more.
-static bool dpll(const struct il_problem *p,
-                 unsigned char options[IL_AXIS][IL_AXIS],
-                 bool (*callback)(const struct il_solution *, void *),
-                 void *thunk) {
-  return !propagate(p, options) ||
-         (finished(options) ? report : guess)(p, options, callback, thunk);
+// to the caller. If not, we make a guess and push the node onto the
+// stack, so that its children get visited. Returns false if the caller
+// requested that no more solutions are computed.
+static bool dpll(struct il_solver *s) {
+  struct frame *f = &s->frames[s->depth];
+  if (!propagate(s->p, &s->chains, f->options))
+    return true;
+  if (finished(f->options)) {
+    PROBE2(solution, s->depth, ++s->solutions);
+    add_solutions(s, s->depth, 1.0);
+    return s->callback == NULL ||
+           report(s->p, f->options, s->callback, s->thunk);
+  }
+
+  // Skip subtrees that are known to have no solutions. When only
+  // counting solutions, all subtrees stored in the table can be skipped.
+  if (s->table != NULL) {
+    double solutions;
+    f->key = table_key(f->options);
+    if (table_lookup(s->table, f->key, &solutions) &&
+        (s->callback == NULL || solutions < 1.0)) {
+      ++s->table_hits;
+      add_solutions(s, s->depth, solutions);
+      return true;
+    }
+  }
+
+  guess(s, f);
+  f->solutions = 0.0;
+  f->nodes = s->nodes;
+  f->complete = true;
+  PROBE4(guess, f->x, f->y, s->depth, f->entry != NULL);
+  ++s->depth;
+  return true;
+}
+
+// Prepares the DPLL algorithm, starting from a table of options.
+static void solver_init(struct il_solver *s, const struct il_problem *p,
+                        const unsigned char options[IL_AXIS][IL_AXIS],
+                        bool (*callback)(const struct il_solution *, void *),
+                        void *thunk) {
+  s->p = p;
+  s->callback = callback;
+  s->thunk = thunk;
+  s->depth = 0;
+  s->pending = true;
+  s->done = false;
+  s->stopped = false;
+  s->table = NULL;
+  chains_init(p, &s->chains);
+  s->deterministic = false;
+  s->belief_propagation = false;
+  s->nodes = 0;
+  s->solutions = 0;
+  s->table_hits = 0;
+  s->count = 0.0;
+  s->explored = 0.0;
+  s->start = now();
+  memcpy(s->frames[0].options, options, sizeof(s->frames[0].options));
+  s->frames[0].weight = 1.0;
+  PROBE1(solve__start, p);
+}
+
+// Runs the DPLL algorithm, visiting at most a given number of nodes of
+// the search tree. Returns true if the search has completed.
+static bool solver_run(struct il_solver *s, unsigned long nodes) {
+  if (s->done)
+    return true;
+  while (!s->done) {
+    if (s->pending) {
+      // Visit the node constructed previously.
+      if (nodes-- == 0)
+        return false;
+      __atomic_store_n(&s->nodes, s->nodes + 1, __ATOMIC_RELAXED);
+      s->pending = false;
+      size_t depth = s->depth;
+      s->done = s->stopped = !dpll(s);
+      if (s->depth == depth)
+        add_explored(s, s->frames[depth].weight);
+    } else if (s->depth == 0) {
+      // All nodes have been visited.
+      s->done = true;
+    } else if (next_child(s)) {
+      s->pending = true;
+    } else {
+      // All children of the node have been visited. Backtrack.
+      backtrack(s);
+    }
+  }
+  PROBE3(solve__end, s->nodes, s->solutions, s->stopped);
+  return true;
+}
+
+// Computes the initial table of valid options remaining for every cell.
+static void initial_options(const struct il_problem *p,
+                            unsigned char options[IL_AXIS][IL_AXIS]) {
+  for (size_t x = 0; x < IL_AXIS; ++x)
+    for (size_t y = 0; y < IL_AXIS; ++y)
+      options[x][y] = initial_option(p->board[x][y]);
 }
 
 void il_problem_solve(const struct il_problem *p,
               bool (*callback)(const struct il_solution *, void *),
               void *thunk) {
-  // Table of valid options remaining for every cell. Initialize it by
-  // allowing all cells to be rotated to all four directions, except for
-  // shapes that have rotational symmetry. For these shapes, we only
-  // need them to be tried in one or two directions.
+  // Table of valid options remaining for every cell.
   unsigned char options[IL_AXIS][IL_AXIS];
-  for (size_t x = 0; x < IL_AXIS; ++x)
-    for (size_t y = 0; y < IL_AXIS; ++y)
-      options[x][y] =
-          (p->board[x][y] == 0 || p->board[x][y] == 0xf)
-              ? 0x1
-              : p->board[x][y] >> 2 == (p->board[x][y] & 0x3) ? 0x3 : 0xf;
+  initial_options(p, options);
 
   // Invoke the DPLL algorithm to compute solutions.
-  dpll(p, options, callback, thunk);
+  struct il_solver s;
+  solver_init(&s, p, options, callback, thunk);
+  solver_run(&s, ULONG_MAX);
+}
+
+struct il_solver *il_solver_create(
+    const struct il_problem *p,
+    bool (*callback)(const struct il_solution *, void *), void *thunk) {
+  struct il_solver *s = malloc(sizeof(*s));
+  if (s == NULL)
+    return NULL;
+  unsigned char options[IL_AXIS][IL_AXIS];
+  initial_options(p, options);
+  solver_init(s, p, options, callback, thunk);
+  return s;
+}
+
+bool il_solver_run(struct il_solver *s, unsigned long nodes) {
+  return solver_run(s, nodes);
+}
+
+void il_solver_set_table(struct il_solver *s, struct il_table *t) {
+  s->table = t;
+}
+
+void il_solver_set_deterministic(struct il_solver *s) {
+  s->deterministic = true;
+}
+
+void il_solver_set_belief_propagation(struct il_solver *s) {
+  s->belief_propagation = true;
 }
 
-// Appends a string to the output buffer.
-static bool putstr(char **out, size_t *outlen, const char *in) {
-  size_t inlen = strlen(in);
-  if (inlen >= *outlen)
+void il_solver_get_stats(const struct il_solver *s,
+                         struct il_solver_stats *stats) {
+  stats->nodes = s->nodes;
+  stats->solutions = s->count;
+  stats->table_hits = s->table_hits;
+}
+
+void il_solver_get_progress(const struct il_solver *s,
+                            struct il_solver_progress *progress) {
+  __atomic_load(&s->explored, &progress->explored, __ATOMIC_RELAXED);
+  progress->nodes = __atomic_load_n(&s->nodes, __ATOMIC_RELAXED);
+  double elapsed = now() - s->start;
+  progress->nodes_per_second =
+      elapsed > 0.0 ? (double)progress->nodes / elapsed : 0.0;
+}
+
+struct il_solver *il_solver_split(struct il_solver *s) {
+  if (s->done)
+    return NULL;
+
+  // Find the node closest to the root that has unvisited children. Its
+  // subtree is likely to be the largest one remaining. Hand over the
+  // node to the new solver, as if it just made its guess.
+  //
+  // The number of solutions of the node and its ancestors can no longer
+  // be computed by either of the solvers, so they are not stored in the
+  // transposition table.
+  for (size_t d = 0; d < s->depth; ++d) {
+    struct frame *f = &s->frames[d];
+    if (f->remaining != 0 || (f->entry != NULL && f->next < f->entry->count)) {
+      struct il_solver *t = malloc(sizeof(*t));
+      if (t == NULL)
+        return NULL;
+      t->p = s->p;
+      t->callback = s->callback;
+      t->thunk = s->thunk;
+      t->depth = 1;
+      t->pending = false;
+      t->done = false;
+      t->stopped = false;
+      t->table = s->table;
+      t->chains = s->chains;
+      t->deterministic = s->deterministic;
+      t->belief_propagation = s->belief_propagation;
+      t->nodes = 0;
+      t->solutions = 0;
+      t->table_hits = 0;
+      t->count = 0.0;
+      t->explored = 0.0;
+      t->start = now();
+      t->frames[0] = *f;
+      t->frames[0].solutions = 0.0;
+      t->frames[0].complete = false;
+      f->remaining = 0;
+      if (f->entry != NULL)
+        f->next = f->entry->count;
+      for (size_t i = 0; i <= d; ++i)
+        s->frames[i].complete = false;
+      return t;
+    }
+  }
+  return NULL;
+}
+
+void il_solver_destroy(struct il_solver *s) {
+  free(s);
+}
+
+// Callback for il_problem_backbone() that stores the first solution
+// found and stops the search.
+static bool backbone_callback(const struct il_solution *s, void *thunk) {
+  struct il_solution *out = thunk;
+  *out = *s;
+  return false;
+}
+
+// Searches for a single solution, starting from a table of options.
+// Returns false if no solution exists.
+static bool solve_once(const struct il_problem *p,
+                       const unsigned char options[IL_AXIS][IL_AXIS],
+                       struct il_solution *s) {
+  struct il_solver solver;
+  solver_init(&solver, p, options, backbone_callback, s);
+  solver_run(&solver, ULONG_MAX);
+  return solver.stopped;
+}
+
+// Computes a reference solution of a problem, along with the table of
+// options after the initial propagation and the propagation order used
+// to compute it. Returns false if no solution exists.
+static bool solve_reference(const struct il_problem *p,
+                            unsigned char options[IL_AXIS][IL_AXIS],
+                            struct chains *chains,
+                            struct il_solution *reference) {
+  initial_options(p, options);
+  chains_init(p, chains);
+  return propagate(p, chains, options) && solve_once(p, options, reference);
+}
+
+bool il_problem_backbone(const struct il_problem *p, struct il_backbone *b) {
+  // Compute a reference solution, starting from a table of options to
+  // which propagation has already been applied.
+  unsigned char options[IL_AXIS][IL_AXIS];
+  struct chains chains;
+  struct il_solution reference;
+  if (!solve_reference(p, options, &chains, &reference))
     return false;
-  memcpy(*out, in, inlen + 1);
-  *out += inlen;
-  *outlen -= inlen;
+
+  // Cells are assumed to be part of the backbone until proven
+  // otherwise. Cells that propagation managed to place need no testing.
+  for (size_t x = 0; x < IL_AXIS - 2; ++x)
+    for (size_t y = 0; y < IL_AXIS - 2; ++y)
+      b->fixed[x][y] = true;
+  for (size_t x = 1; x < IL_AXIS - 1; ++x) {
+    for (size_t y = 1; y < IL_AXIS - 1; ++y) {
+      if (b->fixed[x - 1][y - 1] && !single_bit_set(options[x][y])) {
+        // Test the cell by forcing it to be placed differently from the
+        // reference solution.
+        unsigned char placed = option_for_edges(
+            p->board[x][y], options[x][y], solution_edges(&reference, x, y));
+        unsigned char new_options[IL_AXIS][IL_AXIS];
+        memcpy(new_options, options, sizeof(new_options));
+        new_options[x][y] &= (unsigned char)~placed;
+        struct il_solution s;
+        if (solve_once(p, new_options, &s)) {
+          // Every cell that is placed differently from the reference
+          // solution is not part of the backbone.
+          for (size_t u = 1; u < IL_AXIS - 1; ++u)
+            for (size_t v = 1; v < IL_AXIS - 1; ++v)
+              if (solution_edges(&s, u, v) != solution_edges(&reference, u, v))
+                b->fixed[u - 1][v - 1] = false;
+        } else {
+          // The cell is part of the backbone. Place it and propagate,
+          // so that subsequent tests start from a smaller search space.
+          options[x][y] = placed;
+          propagate(p, &chains, options);
+        }
+      }
+    }
+  }
   return true;
 }
 
-// Writes whitespace to the output buffer until a given position has
-// been reached.
-static bool whitespace(char **out, size_t *outlen, size_t x, size_t y,
-                       size_t *posx, size_t *posy) {
-  while (y > *posy) {
-    if (!putstr(out, outlen, "\n"))
-      return false;
-    *posx = 0;
-    ++*posy;
+// State of il_problem_refute().
+struct refutation {
+  const struct il_problem *p;
+  struct renderer output;
+  bool failed;
+  unsigned char padding[7];
+};
+
+// Appends a step to a refutation. Coordinates are written in the same
+// form as the cells of struct il_backbone.
+static void refutation_step(struct refutation *r, char kind, size_t x,
+                            size_t y, unsigned char options) {
+  char line[64];
+  snprintf(line, sizeof(line), "%c %zu %zu %x\n", kind, x - 1, y - 1,
+           options);
+  if (!r->failed && !renderer_put(&r->output, line))
+    r->failed = true;
+}
+
+// Searches for a solution in the same way as the DPLL algorithm, while
+// writing down every step taken. Cells are guessed in a fixed order and
+// the tablebase is not used, so that every step can be checked by only
+// looking at the neighbours of a cell. Returns true if no solution
+// exists.
+static bool refute(struct refutation *r,
+                   const unsigned char options[IL_AXIS][IL_AXIS]) {
+  unsigned char node[IL_AXIS][IL_AXIS];
+  memcpy(node, options, sizeof(node));
+  bool made_change;
+  do {
+    made_change = false;
+    for (size_t x = 1; x < IL_AXIS - 1; ++x) {
+      for (size_t y = 1; y < IL_AXIS - 1; ++y) {
+        unsigned char new_options = restrict_cell(r->p, node, x, y);
+        if (new_options != node[x][y]) {
+          refutation_step(r, 'e', x, y, new_options);
+          if (new_options == 0)
+            return true;
+          node[x][y] = new_options;
+          made_change = true;
+        }
+      }
+    }
+  } while (made_change);
+  if (finished(node))
+    return false;
+
+  size_t u = 0;
+  while (single_bit_set(node[u / IL_AXIS][u % IL_AXIS]))
+    ++u;
+  size_t x = u / IL_AXIS, y = u % IL_AXIS;
+  unsigned char remaining = node[x][y];
+  refutation_step(r, 'b', x, y, remaining);
+  for (unsigned char i = 0x1; i <= 0x8; i <<= 1) {
+    if ((remaining & i) != 0) {
+      node[x][y] = i;
+      if (!refute(r, node))
+        return false;
+    }
+  }
+  return true;
+}
+
+bool il_problem_refute(const struct il_problem *p,
+                       bool (*sink)(const char *, size_t, void *),
+                       void *thunk) {
+  // Only write a refutation if no solution exists.
+  unsigned char options[IL_AXIS][IL_AXIS];
+  initial_options(p, options);
+  struct il_solution s;
+  if (solve_once(p, options, &s))
+    return false;
+
+  struct refutation r = {
+      .p = p, .output = {.sink = sink, .thunk = thunk}, .failed = false};
+  if (!renderer_put(&r.output, "c infiniteloop refutation\n"))
+    return false;
+  refute(&r, options);
+  return !r.failed && renderer_flush(&r.output);
+}
+
+// Partitions the cells that have not been placed yet into clusters of
+// neighbouring cells. Cells in different clusters are never adjacent,
+// meaning that they can be placed independently. Cells that have been
+// placed are assigned cluster zero. Returns the number of clusters.
+static size_t find_clusters(const unsigned char options[IL_AXIS][IL_AXIS],
+                            size_t clusters[IL_AXIS][IL_AXIS]) {
+  for (size_t x = 0; x < IL_AXIS; ++x)
+    for (size_t y = 0; y < IL_AXIS; ++y)
+      clusters[x][y] = 0;
+
+  size_t nclusters = 0;
+  for (size_t x = 1; x < IL_AXIS - 1; ++x) {
+    for (size_t y = 1; y < IL_AXIS - 1; ++y) {
+      if (clusters[x][y] == 0 && !single_bit_set(options[x][y])) {
+        // Flood fill a new cluster, starting at this cell.
+        size_t stack[IL_AXIS * IL_AXIS], nstack = 0;
+        clusters[x][y] = ++nclusters;
+        stack[nstack++] = x * IL_AXIS + y;
+        while (nstack > 0) {
+          size_t u = stack[--nstack] / IL_AXIS, v = stack[nstack] % IL_AXIS;
+          const size_t nu[4] = {u, u + 1, u, u - 1};
+          const size_t nv[4] = {v - 1, v, v + 1, v};
+          for (size_t d = 0; d < 4; ++d) {
+            if (clusters[nu[d]][nv[d]] == 0 &&
+                !single_bit_set(options[nu[d]][nv[d]])) {
+              clusters[nu[d]][nv[d]] = nclusters;
+              stack[nstack++] = nu[d] * IL_AXIS + nv[d];
+            }
+          }
+        }
+      }
+    }
+  }
+  return nclusters;
+}
+
+// Computes a table of options in which only the cells of a single
+// cluster are left undecided. All other cells are placed as in a
+// reference solution.
+static void cluster_options(const struct il_problem *p,
+                            const unsigned char options[IL_AXIS][IL_AXIS],
+                            const size_t clusters[IL_AXIS][IL_AXIS],
+                            size_t k, const struct il_solution *reference,
+                            unsigned char new_options[IL_AXIS][IL_AXIS]) {
+  for (size_t x = 0; x < IL_AXIS; ++x)
+    for (size_t y = 0; y < IL_AXIS; ++y)
+      new_options[x][y] =
+          clusters[x][y] == k || x == 0 || y == 0 || x == IL_AXIS - 1 ||
+                  y == IL_AXIS - 1
+              ? options[x][y]
+              : option_for_edges(p->board[x][y], options[x][y],
+                                 solution_edges(reference, x, y));
+}
+
+// Number of entries of the cache of the number of solutions of
+// components used by il_problem_marginals().
+#define COUNT_CACHE_ENTRIES (1 << 12)
+
+// State of counting the solutions of components of cells exactly. Cells
+// are identified by x * IL_AXIS + y, which fits in a byte.
+struct count_state {
+  const struct il_problem *p;
+
+  // Direct mapped cache of the number of solutions of components.
+  struct count_entry {
+    uint64_t key;
+    double count;
+  } cache[COUNT_CACHE_ENTRIES];
+
+  // Marks of cells that have been assigned to a component.
+  unsigned int marks[IL_AXIS][IL_AXIS];
+  unsigned int epoch;
+  unsigned char padding[4];
+};
+
+// Splits up the cells of a list that have not been placed yet into
+// components of neighbouring cells, which can be placed independently.
+// The cells of every component are stored consecutively, and the start
+// of every component is recorded. Returns the number of components.
+static size_t split_components(struct count_state *c,
+                               const unsigned char options[IL_AXIS][IL_AXIS],
+                               const unsigned char *cells, size_t ncells,
+                               unsigned char *sub, unsigned char *starts) {
+  ++c->epoch;
+  size_t nsub = 0, nsubcells = 0;
+  for (size_t j = 0; j < ncells; ++j) {
+    size_t x = cells[j] / IL_AXIS, y = cells[j] % IL_AXIS;
+    if (c->marks[x][y] != c->epoch && !single_bit_set(options[x][y])) {
+      // Flood fill a new component, starting at this cell.
+      starts[nsub++] = (unsigned char)nsubcells;
+      c->marks[x][y] = c->epoch;
+      sub[nsubcells++] = cells[j];
+      for (size_t k = starts[nsub - 1]; k < nsubcells; ++k) {
+        size_t u = sub[k] / IL_AXIS, v = sub[k] % IL_AXIS;
+        const size_t nu[4] = {u, u + 1, u, u - 1};
+        const size_t nv[4] = {v - 1, v, v + 1, v};
+        for (size_t d = 0; d < 4; ++d) {
+          if (c->marks[nu[d]][nv[d]] != c->epoch &&
+              !single_bit_set(options[nu[d]][nv[d]])) {
+            c->marks[nu[d]][nv[d]] = c->epoch;
+            sub[nsubcells++] = (unsigned char)(nu[d] * IL_AXIS + nv[d]);
+          }
+        }
+      }
+    }
+  }
+  starts[nsub] = (unsigned char)nsubcells;
+  return nsub;
+}
+
+// Places a cell in a table of options to which propagation has already
+// been applied, and propagates the change. Only the neighbours of cells
+// that change need to be revisited. Returns false on a contradiction.
+static bool place_cell(const struct il_problem *p,
+                       unsigned char options[IL_AXIS][IL_AXIS], size_t x,
+                       size_t y, unsigned char option) {
+  // Stack of cells that have changed. Every cell can change at most
+  // three times before running out of options.
+  unsigned char stack[1 + 3 * (IL_AXIS - 2) * (IL_AXIS - 2)];
+  size_t nstack = 0;
+  options[x][y] = option;
+  stack[nstack++] = (unsigned char)(x * IL_AXIS + y);
+  while (nstack > 0) {
+    size_t u = stack[--nstack] / IL_AXIS, v = stack[nstack] % IL_AXIS;
+    const size_t nu[4] = {u, u + 1, u, u - 1};
+    const size_t nv[4] = {v - 1, v, v + 1, v};
+    for (size_t d = 0; d < 4; ++d) {
+      if (p->board[nu[d]][nv[d]] != 0) {
+        unsigned char new_options = restrict_cell(p, options, nu[d], nv[d]);
+        if (new_options != options[nu[d]][nv[d]]) {
+          if (new_options == 0)
+            return false;
+          options[nu[d]][nv[d]] = new_options;
+          stack[nstack++] = (unsigned char)(nu[d] * IL_AXIS + nv[d]);
+        }
+      }
+    }
+  }
+  return true;
+}
+
+// Counts the solutions of the cells of a list, given a table of options
+// to which propagation has already been applied. The cells that have
+// not been placed fall apart into components, whose numbers of
+// solutions are multiplied. A component is counted by placing the cell
+// in its middle in every possible way and counting the remaining cells
+// recursively. As in the transposition table of the solver, the number
+// of solutions of a component only depends on the options of its
+// cells, which allows them to be cached.
+static double count_cells(struct count_state *c,
+                          const unsigned char options[IL_AXIS][IL_AXIS],
+                          const unsigned char *cells, size_t ncells) {
+  unsigned char sub[(IL_AXIS - 2) * (IL_AXIS - 2)];
+  unsigned char starts[(IL_AXIS - 2) * (IL_AXIS - 2) + 1];
+  size_t nsub = split_components(c, options, cells, ncells, sub, starts);
+
+  double product = 1.0;
+  for (size_t k = 0; k < nsub && product > 0.0; ++k) {
+    const unsigned char *component = &sub[starts[k]];
+    size_t len = (size_t)(starts[k + 1] - starts[k]);
+    uint64_t key = 0;
+    for (size_t j = 0; j < len; ++j) {
+      uint64_t h = (uint64_t)component[j] << 4 |
+                   options[component[j] / IL_AXIS][component[j] % IL_AXIS];
+      h *= 0x9e3779b97f4a7c15;
+      key += h ^ h >> 29;
+    }
+    key |= 1;
+    struct count_entry *e = &c->cache[key % COUNT_CACHE_ENTRIES];
+    if (e->key != key) {
+      // Place the cell in the middle of the component, as the cells are
+      // stored in the order of a flood fill. This tends to split the
+      // component into parts of similar size.
+      size_t x = component[len / 2] / IL_AXIS;
+      size_t y = component[len / 2] % IL_AXIS;
+      double total = 0.0;
+      for (unsigned char i = 0x1; i <= 0x8; i <<= 1) {
+        unsigned char new_options[IL_AXIS][IL_AXIS];
+        memcpy(new_options, options, sizeof(new_options));
+        if ((options[x][y] & i) != 0 &&
+            place_cell(c->p, new_options, x, y, i))
+          total += count_cells(c, new_options, component, len);
+      }
+      e->key = key;
+      e->count = total;
+    }
+    product *= e->count;
   }
-  while (x > *posx) {
-    if (!putstr(out, outlen, " "))
+  return product;
+}
+
+void il_problem_marginals(const struct il_problem *p, struct il_marginals *m) {
+  memset(m, '\0', sizeof(*m));
+
+  // Puzzles without any solutions have no statistics. Counting starts
+  // from a table of options to which propagation has been applied.
+  unsigned char options[IL_AXIS][IL_AXIS];
+  struct chains chains;
+  struct il_solution reference;
+  if (!solve_reference(p, options, &chains, &reference))
+    return;
+
+  // Solutions are formed by combining the solutions of every component
+  // of cells that cannot be placed through inference independently.
+  // Cells that have been placed are part of every solution.
+  struct count_state c = {.p = p};
+  unsigned char cells[(IL_AXIS - 2) * (IL_AXIS - 2)];
+  size_t ncells = 0;
+  for (size_t x = 1; x < IL_AXIS - 1; ++x) {
+    for (size_t y = 1; y < IL_AXIS - 1; ++y) {
+      cells[ncells++] = (unsigned char)(x * IL_AXIS + y);
+      if (single_bit_set(options[x][y]))
+        m->rotation[x - 1][y - 1][__builtin_ctz(options[x][y])] = 1.0;
+    }
+  }
+  unsigned char sub[(IL_AXIS - 2) * (IL_AXIS - 2)];
+  unsigned char starts[(IL_AXIS - 2) * (IL_AXIS - 2) + 1];
+  size_t nsub = split_components(&c, options, cells, ncells, sub, starts);
+
+  // Count the solutions of every component, followed by the fraction of
+  // them in which a cell is placed in a certain way. These are counted
+  // in the same way, after placing the cell.
+  m->solutions = 1.0;
+  for (size_t k = 0; k < nsub; ++k) {
+    const unsigned char *component = &sub[starts[k]];
+    size_t len = (size_t)(starts[k + 1] - starts[k]);
+    double total = count_cells(&c, options, component, len);
+    m->solutions *= total;
+    for (size_t j = 0; j < len; ++j) {
+      size_t x = component[j] / IL_AXIS, y = component[j] % IL_AXIS;
+      for (unsigned char i = 0x1; i <= 0x8; i <<= 1) {
+        unsigned char new_options[IL_AXIS][IL_AXIS];
+        memcpy(new_options, options, sizeof(new_options));
+        if ((options[x][y] & i) != 0 && place_cell(p, new_options, x, y, i))
+          m->rotation[x - 1][y - 1][__builtin_ctz(i)] =
+              count_cells(&c, new_options, component, len) / total;
+      }
+    }
+  }
+
+  // Derive the fractions of solutions in which edges are set from the
+  // rotations of the cells to their left and top. Extrapolate all
+  // fractions to the full solution space.
+  for (size_t x = 1; x < IL_AXIS - 1; ++x) {
+    for (size_t y = 1; y < IL_AXIS - 1; ++y) {
+      for (unsigned char i = 0x1; i <= 0x8; i <<= 1) {
+        if ((options[x][y] & i) != 0) {
+          double *r = &m->rotation[x - 1][y - 1][__builtin_ctz(i)];
+          unsigned char edges = rotate(p->board[x][y], i);
+          if (x < IL_AXIS - 2 && (edges & 0x2) != 0)
+            m->horizontal[x - 1][y - 1] += *r * m->solutions;
+          if (y < IL_AXIS - 2 && (edges & 0x4) != 0)
+            m->vertical[x - 1][y - 1] += *r * m->solutions;
+          *r *= m->solutions;
+        }
+      }
+    }
+  }
+}
+
+// Solutions of a single cluster, stored as the option selected for
+// every cell of the cluster.
+struct enumerator_cluster {
+  size_t ncells;
+  unsigned char (*cells)[2];
+  size_t nsolutions;
+  size_t capacity;
+  unsigned char *solutions;
+  size_t current;
+};
+
+struct il_enumerator {
+  const struct il_problem *p;
+  unsigned char options[IL_AXIS][IL_AXIS];
+  size_t nclusters;
+  struct enumerator_cluster *clusters;
+
+  // Solver used instead if the solutions of the clusters could not be
+  // stored, and the location at which it should store a solution.
+  struct il_solver *solver;
+  struct il_solution *next;
+
+  bool started;
+  bool done;
+  unsigned char padding[6];
+};
+
+// Callback for il_enumerator_create() that appends a solution to the
+// list of solutions of a cluster.
+struct enumerator_param {
+  const struct il_problem *p;
+  struct enumerator_cluster *c;
+  size_t bytes;
+  size_t max_bytes;
+  bool failed;
+  bool capped;
+  unsigned char padding[6];
+};
+
+static bool enumerator_callback(const struct il_solution *s, void *thunk) {
+  struct enumerator_param *param = thunk;
+  struct enumerator_cluster *c = param->c;
+  if (c->nsolutions == c->capacity) {
+    size_t capacity = c->capacity == 0 ? 16 : c->capacity * 2;
+    if (capacity > SIZE_MAX / c->ncells ||
+        (capacity - c->capacity) * c->ncells >
+            param->max_bytes - param->bytes) {
+      param->capped = true;
+      return false;
+    }
+    unsigned char *solutions = realloc(c->solutions, capacity * c->ncells);
+    if (solutions == NULL) {
+      param->failed = true;
       return false;
-    ++*posx;
+    }
+    param->bytes += (capacity - c->capacity) * c->ncells;
+    c->solutions = solutions;
+    c->capacity = capacity;
+  }
+  unsigned char *solution = &c->solutions[c->nsolutions++ * c->ncells];
+  for (size_t i = 0; i < c->ncells; ++i) {
+    size_t x = c->cells[i][0], y = c->cells[i][1];
+    solution[i] =
+        option_for_edges(param->p->board[x][y], 0xf, solution_edges(s, x, y));
+  }
+  return true;
+}
+
+// Places the cells of a cluster as in its current solution.
+static void enumerator_place(struct il_enumerator *e,
+                             const struct enumerator_cluster *c) {
+  const unsigned char *solution = &c->solutions[c->current * c->ncells];
+  for (size_t i = 0; i < c->ncells; ++i)
+    e->options[c->cells[i][0]][c->cells[i][1]] = solution[i];
+}
+
+// Callback for the solver used by an enumerator that could not store
+// the solutions of its clusters. Stores the solution and lets
+// il_enumerator_next() know that it has been found.
+static bool enumerator_fallback_callback(const struct il_solution *s,
+                                         void *thunk) {
+  struct il_enumerator *e = thunk;
+  *e->next = *s;
+  e->next = NULL;
+  return true;
+}
+
+// Frees the solutions of all clusters.
+static void enumerator_free_clusters(struct il_enumerator *e) {
+  for (size_t k = 0; k < e->nclusters; ++k) {
+    free(e->clusters[k].cells);
+    free(e->clusters[k].solutions);
+  }
+  free(e->clusters);
+  e->nclusters = 0;
+  e->clusters = NULL;
+}
+
+struct il_enumerator *il_enumerator_create(const struct il_problem *p,
+                                           size_t max_bytes) {
+  struct il_enumerator *e = malloc(sizeof(*e));
+  if (e == NULL)
+    return NULL;
+  e->p = p;
+  e->nclusters = 0;
+  e->clusters = NULL;
+  e->solver = NULL;
+  e->started = false;
+  e->done = false;
+
+  // Boards without any solutions don't need any further preprocessing.
+  unsigned char options[IL_AXIS][IL_AXIS];
+  struct chains chains;
+  struct il_solution reference;
+  if (!solve_reference(p, options, &chains, &reference)) {
+    e->done = true;
+    return e;
+  }
+
+  // Start out with the reference solution, which places the cells that
+  // are not part of any cluster.
+  for (size_t x = 0; x < IL_AXIS; ++x)
+    for (size_t y = 0; y < IL_AXIS; ++y)
+      e->options[x][y] =
+          x == 0 || y == 0 || x == IL_AXIS - 1 || y == IL_AXIS - 1
+              ? options[x][y]
+              : option_for_edges(p->board[x][y], options[x][y],
+                                 solution_edges(&reference, x, y));
+
+  // Enumerate the solutions of every cluster up front. Every cluster
+  // has at least one solution, as the reference solution exists.
+  // Combining the solutions of the clusters can then never fail, which
+  // bounds the time needed to produce every next solution.
+  struct enumerator_param param = {
+      .p = p, .max_bytes = max_bytes, .failed = false, .capped = false};
+  size_t clusters[IL_AXIS][IL_AXIS];
+  size_t nclusters = find_clusters(options, clusters);
+  e->clusters = calloc(nclusters, sizeof(*e->clusters));
+  if (nclusters > 0 && e->clusters == NULL) {
+    free(e);
+    return NULL;
   }
+  for (size_t k = 1; k <= nclusters; ++k) {
+    struct enumerator_cluster *c = &e->clusters[e->nclusters++];
+    c->cells = malloc(IL_AXIS * IL_AXIS * sizeof(*c->cells));
+    if (c->cells == NULL) {
+      il_enumerator_destroy(e);
+      return NULL;
+    }
+    for (size_t x = 1; x < IL_AXIS - 1; ++x) {
+      for (size_t y = 1; y < IL_AXIS - 1; ++y) {
+        if (clusters[x][y] == k) {
+          c->cells[c->ncells][0] = (unsigned char)x;
+          c->cells[c->ncells++][1] = (unsigned char)y;
+        }
+      }
+    }
+
+    unsigned char new_options[IL_AXIS][IL_AXIS];
+    cluster_options(p, options, clusters, k, &reference, new_options);
+    param.c = c;
+    struct il_solver solver;
+    solver_init(&solver, p, new_options, enumerator_callback, &param);
+    solver_run(&solver, ULONG_MAX);
+    if (param.failed) {
+      il_enumerator_destroy(e);
+      return NULL;
+    }
+    if (param.capped)
+      break;
+    enumerator_place(e, c);
+  }
+
+  // Search for solutions while they are requested if storing the
+  // solutions of the clusters would use too much memory.
+  if (param.capped) {
+    enumerator_free_clusters(e);
+    e->solver = il_solver_create(p, enumerator_fallback_callback, e);
+    if (e->solver == NULL) {
+      free(e);
+      return NULL;
+    }
+  }
+  return e;
+}
+
+bool il_enumerator_next(struct il_enumerator *e, struct il_solution *s) {
+  if (e->done)
+    return false;
+
+  if (e->solver != NULL) {
+    // Visit nodes one at a time until the next solution is found.
+    e->next = s;
+    while (e->next != NULL && !e->done)
+      e->done = il_solver_run(e->solver, 1);
+    return e->next == NULL;
+  }
+
+  // Advance to the next combination of solutions of the clusters, in
+  // the same way as an odometer. Only clusters that wrap around cause
+  // the next one to be advanced as well.
+  if (e->started) {
+    for (size_t k = 0;; ++k) {
+      if (k == e->nclusters) {
+        e->done = true;
+        return false;
+      }
+      struct enumerator_cluster *c = &e->clusters[k];
+      bool wrapped = ++c->current == c->nsolutions;
+      if (wrapped)
+        c->current = 0;
+      enumerator_place(e, c);
+      if (!wrapped)
+        break;
+    }
+  }
+  e->started = true;
+  extract_solution(e->p, e->options, s);
+  return true;
+}
+
+void il_enumerator_destroy(struct il_enumerator *e) {
+  enumerator_free_clusters(e);
+  if (e->solver != NULL)
+    il_solver_destroy(e->solver);
+  free(e);
+}
+
+// Callback for renderer_run() that obtains the outgoing edges of a cell.
+static unsigned char solution_render_edges(const void *arg, size_t x,
+                                           size_t y) {
+  return solution_edges(arg, x + 1, y + 1);
+}
+
+bool il_solution_render(const struct il_solution *s,
+                        bool (*sink)(const char *, size_t, void *),
+                        void *thunk) {
+  struct renderer r = {.sink = sink, .thunk = thunk};
+  return renderer_run(&r, IL_AXIS - 2, IL_AXIS - 2, solution_render_edges, s);
+}
+
+// Sink for il_solution_print() that appends output to a buffer, while
+// keeping it null terminated.
+struct print_buffer {
+  char *out;
+  size_t outlen;
+};
+
+static bool print_sink(const char *in, size_t inlen, void *thunk) {
+  struct print_buffer *b = thunk;
+  if (inlen >= b->outlen)
+    return false;
+  memcpy(b->out, in, inlen);
+  b->out += inlen;
+  b->outlen -= inlen;
+  *b->out = '\0';
   return true;
 }
 
@@ -280,46 +1661,185 @@ bool il_solution_print(const struct il_solution *s, char *out, size_t outlen) {
     return false;
   *out = '\0';
 
-  size_t posx = 0, posy = 0;
-  for (size_t y = 0; y < IL_AXIS - 2; ++y) {
-    // Print lines containing cells.
-    for (size_t x = 0; x < IL_AXIS - 2; ++x) {
-      // Determine which outgoing edges a cell has.
-      unsigned char idx = (y > 0 && s->vertical[x][y - 1] ? 0x1 : 0) |
-                          (x < IL_AXIS - 3 && s->horizontal[x][y] ? 0x2 : 0) |
-                          (y < IL_AXIS - 3 && s->vertical[x][y] ? 0x4 : 0) |
-                          (x > 0 && s->horizontal[x - 1][y] ? 0x8 : 0);
-      if (idx != 0) {
-        // Print cell.
-        const char cells[16][4] = {"",  "╵", "╶", "╰", "╷", "│", "╭", "├",
-                                   "╴", "╯", "─", "┴", "╮", "┤", "┬", "┼"};
-        if (!whitespace(&out, &outlen, 3 * x, 2 * y, &posx, &posy))
-          return false;
-        if (!putstr(&out, &outlen, cells[idx]))
+  struct print_buffer b = {.out = out, .outlen = outlen};
+  return il_solution_render(s, print_sink, &b);
+}
+
+// Writes a puzzle input to a renderer, in the form accepted by
+// il_problem_parse(). Cells are written through a table indexed by
+// their edges, while whitespace is only written once it is followed by
+// a cell.
+static bool problem_draw(struct renderer *r, const struct il_problem *p) {
+  static const char cells[16][2] = {"",  "1", "1", "c", "1", "s", "c", "3",
+                                    "1", "c", "s", "3", "c", "3", "3", "4"};
+  r->posx = 0;
+  r->posy = 0;
+  for (size_t y = 1; y < IL_AXIS - 1; ++y) {
+    for (size_t x = 1; x < IL_AXIS - 1; ++x) {
+      unsigned char c = p->board[x][y];
+      if (c != 0) {
+        if (!renderer_move(r, x - 1, y - 1) || !renderer_put(r, cells[c]))
           return false;
-        ++posx;
+        ++r->posx;
+      }
+    }
+  }
+  return true;
+}
 
-        // Print horizontal edges.
-        if (x < IL_AXIS - 3 && s->horizontal[x][y]) {
-          if (!putstr(&out, &outlen, "──"))
-            return false;
-          posx += 2;
-        }
+bool il_problem_render(const struct il_problem *p,
+                       bool (*sink)(const char *, size_t, void *),
+                       void *thunk) {
+  struct renderer r = {.sink = sink, .thunk = thunk};
+  return problem_draw(&r, p) && renderer_flush(&r);
+}
+
+bool il_problem_print(const struct il_problem *p, char *out, size_t outlen) {
+  // Empty output buffer.
+  if (outlen == 0)
+    return false;
+  *out = '\0';
+
+  struct print_buffer b = {.out = out, .outlen = outlen};
+  return il_problem_render(p, print_sink, &b);
+}
+
+void il_problem_canonicalize(const struct il_problem *p,
+                             struct il_problem *out) {
+  // Compute the bounding box of the non-empty cells.
+  int minx = IL_AXIS, miny = IL_AXIS, maxx = -1, maxy = -1;
+  for (int x = 1; x < IL_AXIS - 1; ++x) {
+    for (int y = 1; y < IL_AXIS - 1; ++y) {
+      if (p->board[x][y] != 0) {
+        if (x < minx)
+          minx = x;
+        if (x > maxx)
+          maxx = x;
+        if (y < miny)
+          miny = y;
+        if (y > maxy)
+          maxy = y;
       }
     }
+  }
+  memset(out, 0, sizeof(*out));
+  if (maxx < 0)
+    return;
 
-    // Print vertical edges.
-    if (y < IL_AXIS - 3) {
-      for (size_t x = 0; x < IL_AXIS - 2; ++x) {
-        if (s->vertical[x][y]) {
-          if (!whitespace(&out, &outlen, 3 * x, 2 * y + 1, &posx, &posy))
-            return false;
-          if (!putstr(&out, &outlen, "│"))
-            return false;
-          ++posx;
-        }
+  // Apply every symmetry to the cells within the bounding box, moving
+  // them to the top left of the board. Keep the board whose shapes come
+  // first when compared row by row.
+  bool found = false;
+  for (unsigned int t = 0; t < 8; ++t) {
+    // Determine where the corner of the bounding box ends up.
+    int cx[2] = {0, maxx - minx}, cy[2] = {0, maxy - miny};
+    int ox = INT_MAX, oy = INT_MAX;
+    for (size_t i = 0; i < 4; ++i) {
+      int x = cx[i & 0x1], y = cy[i >> 1];
+      symmetry_coords(t, &x, &y);
+      if (x < ox)
+        ox = x;
+      if (y < oy)
+        oy = y;
+    }
+
+    struct il_problem candidate;
+    memset(&candidate, 0, sizeof(candidate));
+    for (int x = minx; x <= maxx; ++x) {
+      for (int y = miny; y <= maxy; ++y) {
+        int u = x - minx, v = y - miny;
+        symmetry_coords(t, &u, &v);
+        candidate.board[u - ox + 1][v - oy + 1] = shape(p->board[x][y]);
       }
     }
+
+    int cmp = 0;
+    for (size_t y = 1; found && cmp == 0 && y < IL_AXIS - 1; ++y)
+      for (size_t x = 1; cmp == 0 && x < IL_AXIS - 1; ++x)
+        cmp = candidate.board[x][y] - out->board[x][y];
+    if (!found || cmp < 0) {
+      *out = candidate;
+      found = true;
+    }
+  }
+}
+
+// State of il_problem_solve_text(), writing the solutions of every
+// puzzle directly into the buffer of a renderer.
+struct solve_text {
+  struct renderer output;
+  unsigned int solutions;
+  bool failed;
+  unsigned char padding[3];
+};
+
+static bool solve_text_callback(const struct il_solution *s, void *thunk) {
+  struct solve_text *b = thunk;
+  if (!renderer_put(&b->output, "-- SOLUTION --\n") ||
+      !renderer_draw(&b->output, IL_AXIS - 2, IL_AXIS - 2,
+                     solution_render_edges, s) ||
+      !renderer_put(&b->output, "\n")) {
+    b->failed = true;
+    return false;
+  }
+  ++b->solutions;
+  return true;
+}
+
+bool il_problem_solve_text(const char *in, size_t len,
+                           bool (*sink)(const char *, size_t, void *),
+                           void *thunk) {
+  struct solve_text b = {.output = {.sink = sink, .thunk = thunk}};
+  const char *end = in + len;
+  bool skip = false;
+  while (in < end) {
+    // Sections extend up to the next line starting with "--". Only
+    // sections at the start and after "-- PUZZLE --" contain puzzles.
+    const char *puzzle = in, *line = in;
+    bool skip_section = skip;
+    for (;;) {
+      const char *eol = memchr(line, '\n', (size_t)(end - line));
+      if (end - line >= 2 && line[0] == '-' && line[1] == '-') {
+        skip = (size_t)(end - line) < 12 ||
+               memcmp(line, "-- PUZZLE --", 12) != 0;
+        in = eol == NULL ? end : eol + 1;
+        break;
+      }
+      if (eol == NULL) {
+        line = in = end;
+        break;
+      }
+      line = eol + 1;
+    }
+    if (skip_section || line == puzzle)
+      continue;
+
+    struct il_problem p;
+    char found[64];
+    b.solutions = 0;
+    if (!parse_board(puzzle, line, &p) ||
+        !renderer_put(&b.output, "-- PUZZLE --\n") ||
+        !problem_draw(&b.output, &p) || !renderer_put(&b.output, "\n"))
+      return false;
+    il_problem_solve(&p, solve_text_callback, &b);
+    snprintf(found, sizeof(found), "-- FOUND %u SOLUTIONS --\n", b.solutions);
+    if (b.failed || !renderer_put(&b.output, found))
+      return false;
+  }
+  return renderer_flush(&b.output);
+}
+
+bool il_sink_fd(const char *in, size_t inlen, void *thunk) {
+  int fd = *(const int *)thunk;
+  while (inlen > 0) {
+    ssize_t written = write(fd, in, inlen);
+    if (written < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    in += written;
+    inlen -= (size_t)written;
   }
   return true;
 }
@@ -328,19 +1848,39 @@ void il_solution_unsolve(const struct il_solution *s, struct il_problem *p) {
   // Empty out the board.
   memset(p, '\0', sizeof(*p));
 
-  // Turn horizontal connections into outgoing edges on the board.
-  for (size_t x = 0; x < IL_AXIS - 3; ++x)
-    for (size_t y = 0; y < IL_AXIS - 2; ++y)
-      if (s->horizontal[x][y]) {
-        p->board[x + 1][y + 1] |= 0x2;
-        p->board[x + 2][y + 1] |= 0x8;
-      }
+  // Turn horizontal connections into outgoing edges on the board. The
+  // edges are set without branching, as they tend to be random.
+  for (size_t x = 0; x < IL_AXIS - 3; ++x) {
+    for (size_t y = 0; y < IL_AXIS - 2; ++y) {
+      unsigned char edge = s->horizontal[x][y];
+      p->board[x + 1][y + 1] |= (unsigned char)(edge << 1);
+      p->board[x + 2][y + 1] |= (unsigned char)(edge << 3);
+    }
+  }
 
   // Turn vertical connections into outgoing edges on the board.
-  for (size_t x = 0; x < IL_AXIS - 2; ++x)
-    for (size_t y = 0; y < IL_AXIS - 3; ++y)
-      if (s->vertical[x][y]) {
-        p->board[x + 1][y + 1] |= 0x1;
-        p->board[x + 1][y + 2] |= 0x4;
-      }
+  for (size_t x = 0; x < IL_AXIS - 2; ++x) {
+    for (size_t y = 0; y < IL_AXIS - 3; ++y) {
+      unsigned char edge = s->vertical[x][y];
+      p->board[x + 1][y + 1] |= (unsigned char)(edge << 2);
+      p->board[x + 1][y + 2] |= edge;
+    }
+  }
+}
+
+bool il_problem_taps(const struct il_problem *p, const struct il_solution *s,
+                     unsigned int *taps) {
+  *taps = 0;
+  for (size_t x = 1; x < IL_AXIS - 1; ++x) {
+    for (size_t y = 1; y < IL_AXIS - 1; ++y) {
+      // Turn the cell clockwise until it matches the solution.
+      unsigned char edges = solution_edges(s, x, y);
+      unsigned int turns = 0;
+      while (rotate(p->board[x][y], (unsigned char)(1 << turns)) != edges)
+        if (++turns == 4)
+          return false;
+      *taps += turns;
+    }
+  }
+  return true;
 }
@@ -38,20 +38,514 @@ struct il_solution {
   bool vertical[IL_AXIS - 2][IL_AXIS - 3];
 };
 
+// Puzzle backbone structure.
+//
+// This structure stores which cells are placed in the same way in every
+// solution of a puzzle. Cells are indexed in the same way as the
+// outgoing edges in struct il_solution.
+struct il_backbone {
+  bool fixed[IL_AXIS - 2][IL_AXIS - 2];
+};
+
+// Puzzle solution statistics.
+//
+// This structure stores the number of solutions of a puzzle, the number
+// of solutions in which every edge is set and the number of solutions
+// in which every cell is rotated clockwise by a given number of steps.
+// Cells whose shape has rotational symmetry are only counted under the
+// smallest rotation yielding the same placement. Counts are stored as
+// floating point numbers, as they grow exponentially with the size of
+// the board.
+struct il_marginals {
+  double solutions;
+  double horizontal[IL_AXIS - 3][IL_AXIS - 2];
+  double vertical[IL_AXIS - 2][IL_AXIS - 3];
+  double rotation[IL_AXIS - 2][IL_AXIS - 2][4];
+};
+
+// Longest string returned by il_problem_print().
+#define IL_PROBLEM_PRINT_MAX ((IL_AXIS - 1) * (IL_AXIS - 2) + 1)
+
 // Parses a string encoding the layout of a puzzle input.
 bool il_problem_parse(const char *, struct il_problem *);
 
+// Generates a string encoding the layout of a puzzle input, in the form
+// accepted by il_problem_parse(). Cells are written in the orientation
+// in which il_problem_parse() stores them, without any trailing
+// whitespace.
+bool il_problem_print(const struct il_problem *, char *, size_t);
+
+// Generates the same string as il_problem_print(), passing it on to a
+// sink in the same way as il_solution_render().
+bool il_problem_render(const struct il_problem *,
+                       bool (*)(const char *, size_t, void *), void *);
+
+// Computes the canonical form of a puzzle, which is the same for all
+// puzzles that only differ by rotation, mirroring, their position on
+// the board or the orientation of their cells. Puzzles that are equal
+// up to symmetry have identical canonical forms.
+void il_problem_canonicalize(const struct il_problem *, struct il_problem *);
+
+// Parses, solves and prints a sequence of puzzles in one go, writing
+// output to a sink without building any intermediate strings. Puzzles
+// are preceded by a line "-- PUZZLE --", except for the first one.
+// Text following any other line starting with "--" is ignored. For
+// every puzzle, the output contains a line "-- PUZZLE --" followed by
+// the puzzle as written by il_problem_print(), every solution preceded
+// by a line "-- SOLUTION --" and a line "-- FOUND n SOLUTIONS --".
+// Output is thus accepted as input again. Returns false if a puzzle
+// could not be parsed or if the sink returned false.
+bool il_problem_solve_text(const char *, size_t,
+                           bool (*)(const char *, size_t, void *), void *);
+
 // Generates all solutions for a puzzle. The callback is invoked for
 // every solution. Additional solutions are computed if the callback
 // returns true.
 void il_problem_solve(const struct il_problem *,
                       bool (*)(const struct il_solution *, void *), void *);
 
+// Incremental solver state.
+//
+// This allows solutions for a puzzle to be generated in the same way as
+// il_problem_solve(), except that the search may be suspended every
+// time a guess is made and resumed later on.
+struct il_solver;
+
+// Prepares the computation of all solutions for a puzzle. The puzzle
+// needs to remain valid until the solver is destroyed. If no callback
+// is provided, solutions are only counted. Returns NULL if the state of
+// the solver could not be allocated.
+struct il_solver *il_solver_create(const struct il_problem *,
+                                   bool (*)(const struct il_solution *, void *),
+                                   void *);
+
+// Continues the computation of solutions, visiting at most a given
+// number of nodes of the search tree. Returns true if the search has
+// completed, either because all solutions have been generated or
+// because the callback returned false.
+bool il_solver_run(struct il_solver *, unsigned long);
+
+// Moves part of the search space that has not been visited yet to a
+// new solver, so that it may be explored independently, for example on
+// another thread. The new solver invokes the same callback. Returns
+// NULL if there is nothing left to move or if the state of the new
+// solver could not be allocated.
+struct il_solver *il_solver_split(struct il_solver *);
+
+// Frees the state of a solver.
+void il_solver_destroy(struct il_solver *);
+
+// Transposition table, storing the number of solutions of parts of the
+// search space that have been visited before. A table may be shared by
+// solvers for the same puzzle running on different threads. Its size
+// is bounded, meaning that results are replaced over time.
+struct il_table;
+
+// Creates a transposition table that uses at most a given number of
+// bytes for its entries. Returns NULL if it could not be allocated.
+struct il_table *il_table_create(size_t);
+
+// Frees a transposition table.
+void il_table_destroy(struct il_table *);
+
+// Lets a solver consult and populate a transposition table. Parts of
+// the search space without any solutions are skipped. When solutions
+// are only counted, all parts stored in the table are skipped. This
+// needs to be called before the solver is run. Solvers split off
+// from it use the same table.
+void il_solver_set_table(struct il_solver *, struct il_table *);
+
+// Lets a solver guess cells in a fixed order instead of at random, so
+// that solutions are always generated in the same order. This needs to
+// be called before the solver is run. Solvers split off from it guess
+// cells in the same way.
+void il_solver_set_deterministic(struct il_solver *);
+
+// Lets a solver pick the cells to guess and the order in which their
+// rotations are tried by estimating how likely every rotation is to be
+// part of a solution, using belief propagation. The cell whose
+// placement is the least certain is guessed first, starting with its
+// most likely rotation. This reduces the number of nodes of the search
+// tree that need to be visited to find a solution on ambiguous boards
+// by around 10%, at a higher cost per node. On random boards, searching
+// takes about as long as when guessing at random, but around 30% longer
+// than with il_solver_set_deterministic(). Cells are guessed in a fixed
+// order. This needs to be called before the solver is run. Solvers
+// split off from it guess cells in the same way.
+void il_solver_set_belief_propagation(struct il_solver *);
+
+struct il_solver_stats {
+  // Number of nodes of the search tree visited.
+  unsigned long nodes;
+
+  // Number of solutions found, including the ones in parts of the
+  // search space that were skipped by using the transposition table.
+  double solutions;
+
+  // Number of nodes whose subtree was skipped by using the
+  // transposition table.
+  unsigned long table_hits;
+};
+
+// Obtains statistics of the search performed by a solver.
+void il_solver_get_stats(const struct il_solver *, struct il_solver_stats *);
+
+struct il_solver_progress {
+  // Estimated fraction of the search space explored, between zero and
+  // one. Every node of the search tree is assumed to cover an equal
+  // share of the search space of its parent. For solvers split off
+  // from another, this is a fraction of the search space of the
+  // original solver.
+  double explored;
+
+  // Number of nodes of the search tree visited.
+  unsigned long nodes;
+
+  // Number of nodes visited per second since the solver was created.
+  double nodes_per_second;
+};
+
+// Obtains the progress of the search performed by a solver. Unlike
+// il_solver_get_stats(), this may be called from another thread while
+// the solver is running, without any locking.
+void il_solver_get_progress(const struct il_solver *,
+                            struct il_solver_progress *);
+
+// Scheduler for solving many puzzles on a pool of threads.
+//
+// Every request is first given a single time slice on one of the
+// foreground threads, so that puzzles that can be solved quickly are
+// never stuck behind ones that cannot. Requests that need more time are
+// demoted to a background queue, from which they are given time slices
+// round-robin.
+struct il_scheduler;
+
+// Outcome of a request submitted to a scheduler.
+enum il_request_status {
+  // All solutions have been generated, or the callback returned false.
+  IL_REQUEST_COMPLETED,
+
+  // The search was abandoned, as it exceeded its budget.
+  IL_REQUEST_BUDGET_EXHAUSTED,
+};
+
+// Creates a scheduler with a given number of foreground and background
+// threads. At least one foreground thread is needed. The scheduler
+// accepts at most a given number of pending requests, or an unlimited
+// number if zero. Time slices are expressed in the number of nodes of
+// the search tree visited and must be non-zero. Returns NULL if the
+// scheduler could not be created.
+struct il_scheduler *il_scheduler_create(size_t, size_t, size_t,
+                                         unsigned long);
+
+// Submits a request for computing the solutions of a puzzle, with a
+// budget expressed in the number of nodes of the search tree that may
+// be visited, or zero if unlimited. The callback is invoked for every
+// solution, followed by the completion callback. Both are called on one
+// of the threads of the scheduler. Returns false if the request could
+// not be allocated or too many requests are already pending, in which
+// case none of the callbacks are invoked.
+bool il_scheduler_submit(struct il_scheduler *, const struct il_problem *,
+                         unsigned long,
+                         bool (*)(const struct il_solution *, void *),
+                         void (*)(enum il_request_status, void *), void *);
+
+// Waits for all pending requests to complete and frees the scheduler.
+void il_scheduler_destroy(struct il_scheduler *);
+
+// Flags that can be provided to il_problem_solve_parallel() and
+// il_problem_solve_batch().
+//
+// IL_PARALLEL_PIN_THREADS: pin every thread to a different CPU.
+// IL_PARALLEL_NUMA: spread threads evenly over the NUMA nodes of the
+//     system and pin them to CPUs of their node. Only supported by
+//     il_problem_solve_batch().
+// IL_PARALLEL_TRANSPOSITIONS: let all threads share a transposition
+//     table. Not supported by il_problem_solve_batch().
+// IL_PARALLEL_ORDERED: guess cells in a fixed order and invoke the
+//     callback for solutions in the same order as a solver using
+//     il_solver_set_deterministic() would. Solutions found ahead of
+//     time by other threads are buffered, up to a fixed number, after
+//     which these threads wait. Only supported by
+//     il_problem_solve_parallel().
+#define IL_PARALLEL_PIN_THREADS 0x1
+#define IL_PARALLEL_NUMA 0x2
+#define IL_PARALLEL_TRANSPOSITIONS 0x4
+#define IL_PARALLEL_ORDERED 0x8
+
+// Statistics reported by il_problem_solve_parallel() and
+// il_problem_solve_batch().
+struct il_parallel_stats {
+  // Number of times a thread took over work from another thread.
+  unsigned long steals;
+
+  // Total number of seconds threads spent looking for work.
+  double idle;
+
+  // Number of nodes whose subtree was skipped by using the shared
+  // transposition table.
+  unsigned long table_hits;
+};
+
+// Generates all solutions for a puzzle in the same way as
+// il_problem_solve(), using a given number of threads. Threads that run
+// out of work take over unvisited parts of the search tree from other
+// threads. Invocations of the callback are serialized, but may take
+// place on any of the threads. Statistics are stored in the provided
+// structure, if not NULL. Returns false if not all threads could be
+// created, in which case the search may have been stopped early.
+bool il_problem_solve_parallel(const struct il_problem *, size_t, int,
+                               struct il_parallel_stats *,
+                               bool (*)(const struct il_solution *, void *),
+                               void *);
+
+// Counts the solutions of a puzzle in the same way as
+// il_problem_solve_parallel(). Returns false if not all threads could
+// be created, in which case the number of solutions is incomplete.
+bool il_problem_count_parallel(const struct il_problem *, size_t, int,
+                               struct il_parallel_stats *, double *);
+
+// Generates all solutions for a batch of puzzles, using a given number
+// of threads. Puzzles are initially distributed evenly, after which
+// threads that run out of work take over half of the remaining puzzles
+// of other threads. With IL_PARALLEL_NUMA, threads on the same node
+// share their puzzles, which are copied to memory local to the node,
+// and work is preferably taken over from nearby nodes. The callback is
+// invoked with the index of the puzzle, and may be invoked concurrently
+// for different puzzles.
+// Additional solutions for a puzzle are computed if the callback
+// returns true. Statistics are stored in the provided structure, if
+// not NULL. Returns false if no threads could be created.
+bool il_problem_solve_batch(const struct il_problem *, size_t, size_t, int,
+                            struct il_parallel_stats *,
+                            bool (*)(size_t, const struct il_solution *,
+                                     void *),
+                            void *);
+
+// Computes the backbone of a puzzle: the cells that are placed in the
+// same way in every solution. Instead of enumerating all solutions,
+// every cell is tested by searching for a solution in which it is
+// placed differently. Returns false if the puzzle has no solutions.
+bool il_problem_backbone(const struct il_problem *, struct il_backbone *);
+
+// Computes solution statistics for a puzzle without enumerating its
+// solutions. The cells that cannot be placed through inference are
+// split up into independent clusters, whose solutions are counted by
+// placing one cell at a time and counting the clusters into which the
+// remaining cells fall apart separately. The number of solutions in
+// which a cell is placed in a certain way is counted after placing it.
+void il_problem_marginals(const struct il_problem *, struct il_marginals *);
+
+// Enumerator of the solutions of a puzzle.
+//
+// Instead of searching for solutions while they are being requested,
+// the solutions of every cluster of cells that cannot be placed through
+// inference are computed up front. Every next solution is then formed
+// by combining the solutions of the clusters, meaning that the time
+// spent to produce it is bounded, regardless of the size of the parts
+// of the search space without any solutions. Solutions are generated
+// in a different order than by il_problem_solve().
+struct il_enumerator;
+
+// Prepares the enumeration of all solutions for a puzzle. The puzzle
+// needs to remain valid until the enumerator is destroyed.
+//
+// Storing the solutions of a cluster takes one byte per cell of the
+// cluster per solution, which may add up to gigabytes for puzzles with
+// many solutions. If storing them would take more than the provided
+// number of bytes, the enumerator instead searches for every next
+// solution while it is requested, as il_problem_solve() does. The time
+// spent to produce a solution is then no longer bounded. Returns NULL
+// if the state of the enumerator could not be allocated.
+struct il_enumerator *il_enumerator_create(const struct il_problem *,
+                                           size_t);
+
+// Stores the next solution of a puzzle. Returns false if all solutions
+// have been generated.
+bool il_enumerator_next(struct il_enumerator *, struct il_solution *);
+
+// Frees the state of an enumerator.
+void il_enumerator_destroy(struct il_enumerator *);
+
+// Writes a refutation of a puzzle without any solutions to a sink, in
+// the same way as il_solution_render(). A refutation lists every step
+// taken while searching for solutions, so that it can be checked by
+// il_refutation_check() without performing any search. Returns false
+// if the puzzle has a solution, in which case nothing is written, or if
+// the sink returned false.
+bool il_problem_refute(const struct il_problem *,
+                       bool (*)(const char *, size_t, void *), void *);
+
+// Checks whether a refutation proves that a puzzle has no solutions.
+// Takes time linear in the size of the refutation.
+bool il_refutation_check(const struct il_problem *, const char *, size_t);
+
 // Generates a string encoding the layout of a puzzle output.
 bool il_solution_print(const struct il_solution *, char *, size_t);
 
+// Generates the same string as il_solution_print(), passing it on to a
+// sink in chunks as it is generated. The string is not null terminated.
+// Returns false if the sink returned false, in which case no further
+// output is generated.
+bool il_solution_render(const struct il_solution *,
+                        bool (*)(const char *, size_t, void *), void *);
+
+// Sink for il_solution_render() and il_large_solution_render() that
+// writes output to the file descriptor pointed to by the argument.
+bool il_sink_fd(const char *, size_t, void *);
+
 // Converts a solution to a puzzle back to a problem, so that it can be
-// solved again.
+// solved again. Every cell of the problem is placed in the position it
+// has in the solution.
 void il_solution_unsolve(const struct il_solution *, struct il_problem *);
 
+// Computes the number of taps needed to turn the cells of a puzzle into
+// the positions of a solution, where every tap turns a single cell a
+// quarter turn clockwise. Returns false if the solution doesn't place
+// cells of the same shapes as the puzzle.
+bool il_problem_taps(const struct il_problem *, const struct il_solution *,
+                     unsigned int *);
+
+// Snapshot of precomputed solutions.
+//
+// A snapshot is a file containing the solutions of a set of puzzles,
+// indexed by a hash of the shapes of their cells. It is mapped into
+// memory when opened, meaning it can be used without having to be
+// loaded or parsed first.
+struct il_snapshot;
+
+// Solves a set of puzzles and writes their solutions to a snapshot
+// file. Puzzles without any solutions or with more than a given number
+// of solutions are left out. The file is replaced atomically. Returns
+// false if the snapshot could not be written.
+bool il_snapshot_build(const char *, const struct il_problem *, size_t,
+                       size_t);
+
+// Maps a snapshot file into memory. Only the header of the snapshot is
+// validated, so that this doesn't need to read the entire file. Returns
+// NULL if the file could not be opened or has an invalid header.
+struct il_snapshot *il_snapshot_open(const char *);
+
+// Generates all solutions for a puzzle stored in a snapshot, in the
+// same way as il_problem_solve(). Returns false if the puzzle is not
+// part of the snapshot or if its entry is invalid, in which case the
+// callback is not invoked.
+bool il_snapshot_lookup(const struct il_snapshot *, const struct il_problem *,
+                        bool (*)(const struct il_solution *, void *), void *);
+
+// Unmaps a snapshot file.
+void il_snapshot_close(struct il_snapshot *);
+
+// Cell layouts for boards that are larger than IL_AXIS.
+enum il_layout {
+  // Cells are stored row by row. Vertically neighbouring cells are a
+  // full row apart in memory.
+  IL_LAYOUT_ROW_MAJOR,
+
+  // Cells are stored in tiles of 8x8 cells, where every tile occupies
+  // a single cache line. Neighbouring cells in both directions tend to
+  // be stored close to each other.
+  IL_LAYOUT_TILED,
+};
+
+// Puzzle input structure for boards that are larger than IL_AXIS.
+//
+// Cells are encoded in the same way as in struct il_problem. As the
+// outer border is managed internally, coordinates start at zero and run
+// up to the width and height of the board.
+struct il_large_problem;
+
+// Puzzle output structure for boards that are larger than IL_AXIS.
+//
+// This structure is only valid during the invocation of the callback
+// passed to il_large_problem_solve().
+struct il_large_solution;
+
+// Allocates an empty board with a given width, height and layout.
+// Returns NULL if the board could not be allocated.
+struct il_large_problem *il_large_problem_create(size_t, size_t,
+                                                 enum il_layout);
+
+// Frees a board allocated with il_large_problem_create().
+void il_large_problem_destroy(struct il_large_problem *);
+
+// Returns the width and height of a board.
+size_t il_large_problem_width(const struct il_large_problem *);
+size_t il_large_problem_height(const struct il_large_problem *);
+
+// Gets and sets the expected piece of a cell.
+unsigned char il_large_problem_get(const struct il_large_problem *, size_t,
+                                   size_t);
+void il_large_problem_set(struct il_large_problem *, size_t, size_t,
+                          unsigned char);
+
+// Flags that can be provided to il_large_problem_solve() and
+// il_large_problem_count_approx().
+//
+// IL_LARGE_HUGE_PAGES: back the state of the solver by huge pages.
+// IL_LARGE_NO_EXACT_COUNT: don't count the solutions of small clusters
+//     of cells exactly, but approximate the number of solutions of the
+//     board as a whole. Only supported by
+//     il_large_problem_count_approx().
+#define IL_LARGE_HUGE_PAGES 0x1
+#define IL_LARGE_NO_EXACT_COUNT 0x2
+
+// Statistics reported by il_large_problem_solve() and
+// il_large_problem_solve_local().
+struct il_large_stats {
+  // Peak number of bytes of solver state in use.
+  size_t peak_memory;
+
+  // Number of nodes of the search tree visited. Zero if local search
+  // found a solution without falling back to complete search.
+  unsigned long nodes;
+
+  // Number of cells rotated by local search.
+  unsigned long flips;
+};
+
+// Generates all solutions for a large puzzle, in the same way as
+// il_problem_solve(). All state of the solver is allocated from a
+// single region of memory that is released at once when finished.
+// Statistics are stored in the provided structure, if not NULL.
+// Returns false if the state of the solver could not be allocated.
+bool il_large_problem_solve(const struct il_large_problem *, int,
+                            struct il_large_stats *,
+                            bool (*)(const struct il_large_solution *, void *),
+                            void *);
+
+// Estimates the number of solutions of a large puzzle, for puzzles with
+// too many solutions to count them. The binary logarithm of the
+// estimate is stored, which is minus infinity if there are no
+// solutions. The estimate is intended to be within a factor of one
+// plus epsilon of the actual number of solutions with a probability of
+// at least one minus delta. As the random constraints used are sparse,
+// this is not guaranteed, but holds in practice. Returns false if the
+// state of the solver could not be allocated.
+bool il_large_problem_count_approx(const struct il_large_problem *, double,
+                                   double, int, double *);
+
+// Searches for a single solution of a large puzzle by local search,
+// repeatedly rotating cells adjacent to mismatched edges until all edges
+// match. Unlike il_large_problem_solve(), it never backtracks, which
+// helps on puzzles on which complete search makes many wrong guesses,
+// but it cannot prove the absence of solutions. When local search stops
+// making progress, it falls back to il_large_problem_solve(). The
+// callback is invoked at most once. Statistics are stored in the
+// provided structure, if not NULL.
+// Returns false if the state of the solver could not be allocated.
+bool il_large_problem_solve_local(
+    const struct il_large_problem *, int, struct il_large_stats *,
+    bool (*)(const struct il_large_solution *, void *), void *);
+
+// Returns the outgoing edges of a cell in a solution.
+unsigned char il_large_solution_get(const struct il_large_solution *, size_t,
+                                    size_t);
+
+// Generates a string encoding the layout of a large puzzle output in the
+// same way as il_solution_render(). Output is generated row by row, using
+// a constant amount of memory regardless of the size of the board.
+bool il_large_solution_render(const struct il_large_solution *,
+                              bool (*)(const char *, size_t, void *), void *);
+
 #endif
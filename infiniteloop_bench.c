@@ -0,0 +1,411 @@
+// Copyright (c) 2016 Ed Schouten <ed@nuxi.nl>
+//
+// This file is distributed under a 2-clause BSD license.
+// See the LICENSE file for details.
+
+// Benchmarks the solver for large boards, comparing cell layouts.
+//
+// Boards are generated by picking a random solution and converting it
+// back to a problem. Every layout is given the same boards, so that
+// timings can be compared directly. Two kernels are measured: the
+// initial propagation step on its own, and the solve as a whole.
+// Optionally, hardware performance counters are read around every
+// kernel, to determine whether the solver is limited by branch
+// mispredictions or by memory accesses.
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include "infiniteloop.h"
+#include "infiniteloop_impl.h"
+
+// Deterministically derives a pseudo-random number from a seed and the
+// coordinates of a cell.
+static uint64_t splitmix64(uint64_t seed, size_t x, size_t y) {
+  uint64_t z = seed + ((uint64_t)y << 32 | x) * 0x9e3779b97f4a7c15;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+  return z ^ (z >> 31);
+}
+
+// Generates a board for which at least one solution exists.
+static struct il_large_problem *generate(size_t size, enum il_layout layout,
+                                         uint64_t seed) {
+  struct il_large_problem *p = il_large_problem_create(size, size, layout);
+  if (p == NULL)
+    return NULL;
+  for (size_t y = 0; y < size; ++y) {
+    for (size_t x = 0; x < size; ++x) {
+      uint64_t r = splitmix64(seed, x, y);
+      unsigned char c = il_large_problem_get(p, x, y);
+      if (x > 0 && (splitmix64(seed, x - 1, y) & 0x1) != 0)
+        c |= 0x8;
+      if (y > 0 && (splitmix64(seed, x, y - 1) & 0x2) != 0)
+        c |= 0x1;
+      if (x < size - 1 && (r & 0x1) != 0)
+        c |= 0x2;
+      if (y < size - 1 && (r & 0x2) != 0)
+        c |= 0x4;
+      il_large_problem_set(p, x, y, c);
+    }
+  }
+  return p;
+}
+
+static bool stop_callback(const struct il_large_solution *s, void *thunk) {
+  return false;
+}
+
+// Hardware performance counters. Counters that cannot be opened, for
+// example because the system is virtualized or because access is
+// restricted by perf_event_paranoid, are reported as unavailable. The
+// counters are opened as a single group, so that they are all
+// scheduled at the same time and ratios between them are meaningful.
+enum counter {
+  COUNTER_CYCLES,
+  COUNTER_INSTRUCTIONS,
+  COUNTER_BRANCH_MISSES,
+  COUNTER_L1D_MISSES,
+  COUNTER_LLC_MISSES,
+  NCOUNTERS,
+};
+
+struct counters {
+  int fd[NCOUNTERS];
+  int leader;
+};
+
+static void counters_open(struct counters *c) {
+  for (size_t i = 0; i < NCOUNTERS; ++i)
+    c->fd[i] = -1;
+  c->leader = -1;
+#ifdef __linux__
+  const uint64_t configs[NCOUNTERS] = {
+      [COUNTER_CYCLES] = PERF_COUNT_HW_CPU_CYCLES,
+      [COUNTER_INSTRUCTIONS] = PERF_COUNT_HW_INSTRUCTIONS,
+      [COUNTER_BRANCH_MISSES] = PERF_COUNT_HW_BRANCH_MISSES,
+      [COUNTER_L1D_MISSES] = PERF_COUNT_HW_CACHE_L1D |
+                             PERF_COUNT_HW_CACHE_OP_READ << 8 |
+                             PERF_COUNT_HW_CACHE_RESULT_MISS << 16,
+      [COUNTER_LLC_MISSES] = PERF_COUNT_HW_CACHE_MISSES,
+  };
+  for (size_t i = 0; i < NCOUNTERS; ++i) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type =
+        i == COUNTER_L1D_MISSES ? PERF_TYPE_HW_CACHE : PERF_TYPE_HARDWARE;
+    attr.config = configs[i];
+    attr.disabled = c->leader < 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+    c->fd[i] =
+        (int)syscall(__NR_perf_event_open, &attr, 0, -1, c->leader, 0);
+    if (c->leader < 0)
+      c->leader = c->fd[i];
+  }
+#endif
+}
+
+static void counters_close(struct counters *c) {
+  for (size_t i = 0; i < NCOUNTERS; ++i)
+    if (c->fd[i] >= 0)
+      close(c->fd[i]);
+}
+
+// Starts and stops all counters around a measured piece of code.
+static void counters_enable(struct counters *c, bool enable) {
+#ifdef __linux__
+  if (c->leader >= 0)
+    ioctl(c->leader, enable ? PERF_EVENT_IOC_ENABLE : PERF_EVENT_IOC_DISABLE,
+          PERF_IOC_FLAG_GROUP);
+#endif
+}
+
+// Reads and resets all counters. Values are scaled up if the group had
+// to be multiplexed with other events. Counters that are unavailable
+// are reported as NaN, as are all counters if the group was never
+// scheduled.
+static void counters_read(struct counters *c, double values[NCOUNTERS]) {
+  for (size_t i = 0; i < NCOUNTERS; ++i)
+    values[i] = NAN;
+#ifdef __linux__
+  // The group is read as the number of counters, the time enabled and
+  // running, followed by the values in the order they were opened.
+  uint64_t raw[3 + NCOUNTERS];
+  if (c->leader < 0 ||
+      read(c->leader, raw, sizeof(raw)) < (ssize_t)(3 * sizeof(raw[0])))
+    return;
+  ioctl(c->leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  if (raw[2] == 0)
+    return;
+  size_t n = 0;
+  for (size_t i = 0; i < NCOUNTERS; ++i)
+    if (c->fd[i] >= 0 && n < raw[0])
+      values[i] = (double)raw[3 + n++] * (double)raw[1] / (double)raw[2];
+#endif
+}
+
+// Prints the ratio between a counter and another quantity.
+static void counters_print(double value, double divisor) {
+  double ratio = value / divisor;
+  if (!isfinite(ratio))
+    printf(" %10s", "n/a");
+  else
+    printf(" %10.3f", ratio);
+}
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Benchmarks the solver for large boards, comparing cell layouts.
+static int bench_layouts(size_t max, int flags, bool use_counters) {
+  const enum il_layout layouts[] = {IL_LAYOUT_ROW_MAJOR, IL_LAYOUT_TILED};
+  const char *const names[] = {
+      [IL_LAYOUT_ROW_MAJOR] = "row-major",
+      [IL_LAYOUT_TILED] = "tiled",
+  };
+  const char *const kernels[] = {"propagate", "solve"};
+
+  struct counters counters;
+  if (use_counters)
+    counters_open(&counters);
+  printf("%10s %10s %10s %12s %12s %12s", "size", "layout", "kernel", "ms",
+         "ns/cell", "peak KiB");
+  if (use_counters)
+    printf(" %10s %10s %10s %10s %10s %10s %10s %10s", "cyc/cell", "ins/cell",
+           "IPC", "brm/cell", "l1m/cell", "llcm/cell", "cyc/node", "brm/node");
+  printf("\n");
+  for (size_t size = 64; size <= max; size *= 2) {
+    for (size_t i = 0; i < sizeof(layouts) / sizeof(layouts[0]); ++i) {
+      for (size_t k = 0; k < sizeof(kernels) / sizeof(kernels[0]); ++k) {
+        // Repeat small boards, so that timings are not dominated by
+        // noise.
+        size_t runs = size < 1024 ? 1024 * 1024 / (size * size) : 1;
+        double elapsed = 0.0;
+        size_t peak_memory = 0;
+        unsigned long nodes = 0;
+        for (size_t run = 0; run < runs; ++run) {
+          struct il_large_problem *p = generate(size, layouts[i], run);
+          if (p == NULL) {
+            fprintf(stderr, "Failed to allocate board\n");
+            return 1;
+          }
+          if (use_counters)
+            counters_enable(&counters, true);
+          double start = now();
+          struct il_large_stats stats = {.peak_memory = 0, .nodes = 0};
+          bool consistent;
+          if (k == 0 ? !il_large_problem_propagate(p, flags, &consistent)
+                     : !il_large_problem_solve(p, flags, &stats,
+                                               stop_callback, NULL)) {
+            fprintf(stderr, "Failed to allocate solver state\n");
+            return 1;
+          }
+          elapsed += now() - start;
+          if (use_counters)
+            counters_enable(&counters, false);
+          if (stats.peak_memory > peak_memory)
+            peak_memory = stats.peak_memory;
+          nodes += stats.nodes;
+          il_large_problem_destroy(p);
+        }
+
+        // Per-node ratios are only reported for whole solves, as
+        // propagation does not visit any nodes.
+        double cells = (double)(runs * size * size);
+        printf("%10zu %10s %10s %12.3f %12.3f %12zu", size, names[layouts[i]],
+               kernels[k], elapsed / (double)runs * 1e3,
+               elapsed / cells * 1e9, peak_memory / 1024);
+        if (use_counters) {
+          double values[NCOUNTERS];
+          counters_read(&counters, values);
+          counters_print(values[COUNTER_CYCLES], cells);
+          counters_print(values[COUNTER_INSTRUCTIONS], cells);
+          counters_print(values[COUNTER_INSTRUCTIONS],
+                         values[COUNTER_CYCLES]);
+          counters_print(values[COUNTER_BRANCH_MISSES], cells);
+          counters_print(values[COUNTER_L1D_MISSES], cells);
+          counters_print(values[COUNTER_LLC_MISSES], cells);
+          counters_print(values[COUNTER_CYCLES], (double)nodes);
+          counters_print(values[COUNTER_BRANCH_MISSES], (double)nodes);
+        }
+        printf("\n");
+      }
+    }
+  }
+  if (use_counters)
+    counters_close(&counters);
+  return 0;
+}
+
+// Generates a puzzle with a large number of solutions, consisting of
+// four independent components that each have thirteen solutions.
+static void generate_hard(struct il_problem *p) {
+  char buf[256] = "";
+  for (size_t y = 0; y < 11; ++y)
+    strcat(buf, y % 3 == 2 ? "\n" : "1cc11cc11cc1\n");
+  il_problem_parse(buf, p);
+}
+
+// Generates a puzzle with a small number of solutions.
+static void generate_easy(struct il_problem *p, uint64_t seed) {
+  struct il_solution s;
+  for (size_t x = 0; x < IL_AXIS - 3; ++x)
+    for (size_t y = 0; y < IL_AXIS - 2; ++y)
+      s.horizontal[x][y] = splitmix64(seed, x, y) % 3 == 0;
+  for (size_t x = 0; x < IL_AXIS - 2; ++x)
+    for (size_t y = 0; y < IL_AXIS - 3; ++y)
+      s.vertical[x][y] = splitmix64(seed, x, y) / 3 % 3 == 0;
+  il_solution_unsolve(&s, p);
+}
+
+static bool count_callback(const struct il_solution *s, void *thunk) {
+  ++*(unsigned long *)thunk;
+  return true;
+}
+
+static bool batch_count_callback(size_t index, const struct il_solution *s,
+                                 void *thunk) {
+  __atomic_add_fetch((unsigned long *)thunk, 1, __ATOMIC_RELAXED);
+  return true;
+}
+
+// Measures how the parallel solvers scale with the number of threads.
+//
+// Strong scaling is measured by solving a single puzzle with a large
+// search tree. Weak scaling is measured by solving a batch of puzzles,
+// whose size is proportional to the number of threads. Every thread is
+// given the same set of puzzles, so that the amount of work per thread
+// remains constant. With a transposition table, the solutions of the
+// single puzzle are counted instead of enumerated, as this allows the
+// table to skip entire subtrees.
+static int bench_scaling(size_t max_threads, int flags) {
+  size_t threads[64], nthreads = 0;
+  for (size_t n = 1; n < max_threads && nthreads < 63; n *= 2)
+    threads[nthreads++] = n;
+  threads[nthreads++] = max_threads;
+
+  struct il_problem hard;
+  generate_hard(&hard);
+  printf("Strong scaling: one puzzle\n");
+  printf("%10s %12s %12s %12s %12s %12s %12s %12s\n", "threads",
+         "solutions", "ms", "speedup", "efficiency", "steals", "idle ms",
+         "table hits");
+  double base = 0.0;
+  for (size_t i = 0; i < nthreads; ++i) {
+    unsigned long solutions = 0;
+    struct il_parallel_stats stats;
+    double start = now();
+    bool success;
+    if ((flags & IL_PARALLEL_TRANSPOSITIONS) != 0) {
+      double count;
+      success =
+          il_problem_count_parallel(&hard, threads[i], flags, &stats, &count);
+      solutions = (unsigned long)count;
+    } else {
+      success = il_problem_solve_parallel(&hard, threads[i], flags, &stats,
+                                          count_callback, &solutions);
+    }
+    if (!success) {
+      fprintf(stderr, "Failed to create threads\n");
+      return 1;
+    }
+    double elapsed = now() - start;
+    if (i == 0)
+      base = elapsed;
+    printf("%10zu %12lu %12.3f %12.3f %12.3f %12lu %12.3f %12lu\n",
+           threads[i], solutions, elapsed * 1e3, base / elapsed,
+           base / elapsed / (double)threads[i], stats.steals,
+           stats.idle * 1e3, stats.table_hits);
+  }
+
+  const size_t per_thread = 256;
+  struct il_problem *easy =
+      malloc(per_thread * max_threads * sizeof(struct il_problem));
+  if (easy == NULL) {
+    fprintf(stderr, "Failed to allocate puzzles\n");
+    return 1;
+  }
+  for (size_t i = 0; i < per_thread * max_threads; ++i)
+    generate_easy(&easy[i], i % per_thread);
+  printf("\nWeak scaling: %zu puzzles per thread\n", per_thread);
+  printf("%10s %12s %12s %12s %12s %12s %12s\n", "threads", "solutions",
+         "ms", "throughput", "efficiency", "steals", "idle ms");
+  for (size_t i = 0; i < nthreads; ++i) {
+    unsigned long solutions = 0;
+    struct il_parallel_stats stats;
+    double start = now();
+    if (!il_problem_solve_batch(easy, per_thread * threads[i], threads[i],
+                                flags & ~IL_PARALLEL_TRANSPOSITIONS, &stats,
+                                batch_count_callback, &solutions)) {
+      fprintf(stderr, "Failed to create threads\n");
+      return 1;
+    }
+    double elapsed = now() - start;
+    if (i == 0)
+      base = elapsed;
+    printf("%10zu %12lu %12.3f %12.0f %12.3f %12lu %12.3f\n", threads[i],
+           solutions, elapsed * 1e3,
+           (double)(per_thread * threads[i]) / elapsed, base / elapsed,
+           stats.steals, stats.idle * 1e3);
+  }
+  free(easy);
+  return 0;
+}
+
+int main(int argc, char *argv[]) {
+  // Parse command line arguments.
+  int layout_flags = 0, parallel_flags = 0, c;
+  bool use_counters = false;
+  size_t max_threads = 0;
+  while ((c = getopt(argc, argv, "cHnpt:x")) != -1) {
+    switch (c) {
+      case 'c':
+        use_counters = true;
+        break;
+      case 'H':
+        layout_flags |= IL_LARGE_HUGE_PAGES;
+        break;
+      case 'n':
+        parallel_flags |= IL_PARALLEL_NUMA;
+        break;
+      case 'p':
+        parallel_flags |= IL_PARALLEL_PIN_THREADS;
+        break;
+      case 't':
+        max_threads = strtoul(optarg, NULL, 10);
+        break;
+      case 'x':
+        parallel_flags |= IL_PARALLEL_TRANSPOSITIONS;
+        break;
+      default:
+        fprintf(stderr,
+                "usage: infiniteloop_bench [-cH] [max_size]\n"
+                "       infiniteloop_bench [-npx] -t max_threads\n");
+        return 1;
+    }
+  }
+  if (max_threads > 0)
+    return bench_scaling(max_threads, parallel_flags);
+  return bench_layouts(
+      optind < argc ? strtoul(argv[optind], NULL, 10) : 4096, layout_flags,
+      use_counters);
+}
@@ -0,0 +1,68 @@
+// Copyright (c) 2016 Ed Schouten <ed@nuxi.nl>
+//
+// This file is distributed under a 2-clause BSD license.
+// See the LICENSE file for details.
+
+// Checks a refutation written by infiniteloop_cmd -r, proving that a
+// puzzle has no solutions.
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "infiniteloop.h"
+
+int main(int argc, char *argv[]) {
+  if (argc != 3) {
+    fprintf(stderr, "usage: infiniteloop_check puzzle refutation\n");
+    return 1;
+  }
+
+  // Parse the puzzle.
+  FILE *f = fopen(argv[1], "r");
+  if (f == NULL) {
+    perror(argv[1]);
+    return 1;
+  }
+  char buf[1024];
+  size_t len = fread(buf, 1, sizeof(buf) - 1, f);
+  buf[len] = '\0';
+  fclose(f);
+  struct il_problem p;
+  if (!il_problem_parse(buf, &p)) {
+    fprintf(stderr, "%s: Failed to parse input\n", argv[1]);
+    return 1;
+  }
+
+  // Read the refutation in its entirety.
+  f = fopen(argv[2], "r");
+  if (f == NULL) {
+    perror(argv[2]);
+    return 1;
+  }
+  char *refutation = NULL;
+  size_t refutation_len = 0, size = 0;
+  do {
+    if (refutation_len == size) {
+      size = size == 0 ? 65536 : size * 2;
+      char *n = realloc(refutation, size);
+      if (n == NULL) {
+        fprintf(stderr, "Failed to allocate refutation\n");
+        return 1;
+      }
+      refutation = n;
+    }
+    len = fread(refutation + refutation_len, 1, size - refutation_len, f);
+    refutation_len += len;
+  } while (len > 0);
+  if (ferror(f)) {
+    perror(argv[2]);
+    return 1;
+  }
+  fclose(f);
+
+  bool valid = il_refutation_check(&p, refutation, refutation_len);
+  free(refutation);
+  printf(valid ? "-- REFUTATION VALID --\n" : "-- REFUTATION INVALID --\n");
+  return valid ? 0 : 1;
+}
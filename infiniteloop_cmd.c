@@ -3,9 +3,24 @@
 // This file is distributed under a 2-clause BSD license.
 // See the LICENSE file for details.
 
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+
+#ifdef __linux__
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/syscall.h>
+#endif
 
 #include "infiniteloop.h"
 
@@ -22,7 +37,708 @@ static bool print_solution(const struct il_solution *s, void *thunk) {
   return true;
 }
 
-int main(void) {
+// Corpus mode.
+//
+// Puzzles are read from a large number of files, and their solutions
+// are written to files in an output directory, using the same format as
+// when solving a single puzzle. Output files have the same name as
+// their input files, so input files must have distinct names. Solving
+// takes place on a pool of worker threads. I/O is performed by the main
+// thread through io_uring, keeping many reads and writes in flight
+// while the workers are busy. If io_uring is unavailable, every worker
+// performs its own I/O.
+
+// Maximum number of puzzles processed at the same time.
+#define CORPUS_JOBS 64
+
+// Output of a puzzle, built up in memory.
+struct buffer {
+  char *data;
+  size_t len;
+  size_t cap;
+  unsigned int solutions;
+  bool failed;
+  unsigned char padding[3];
+};
+
+static void buffer_append(struct buffer *b, const char *str) {
+  size_t len = strlen(str);
+  if (b->len + len > b->cap) {
+    size_t cap = b->cap == 0 ? 4096 : b->cap;
+    while (b->len + len > cap)
+      cap *= 2;
+    char *data = realloc(b->data, cap);
+    if (data == NULL) {
+      b->failed = true;
+      return;
+    }
+    b->data = data;
+    b->cap = cap;
+  }
+  memcpy(b->data + b->len, str, len);
+  b->len += len;
+}
+
+static bool append_solution(const struct il_solution *s, void *thunk) {
+  struct buffer *b = thunk;
+  char buf[IL_SOLUTION_PRINT_MAX];
+  if (!il_solution_print(s, buf, sizeof(buf))) {
+    b->failed = true;
+    return false;
+  }
+  buffer_append(b, "-- SOLUTION --\n");
+  buffer_append(b, buf);
+  buffer_append(b, "\n");
+  ++b->solutions;
+  return !b->failed;
+}
+
+// Stages that a puzzle goes through while being processed.
+enum job_stage {
+  JOB_OPEN_INPUT,
+  JOB_READ_INPUT,
+  JOB_SOLVE,
+  JOB_OPEN_OUTPUT,
+  JOB_WRITE_OUTPUT,
+};
+
+struct job {
+  const char *input_path;
+  char output_path[PATH_MAX];
+  enum job_stage stage;
+  int fd;
+  char input[1024];
+  size_t input_len;
+  struct buffer output;
+  size_t written;
+  struct job *next;
+};
+
+struct corpus {
+  struct il_snapshot *snapshot;
+  const char *output_dir;
+  char **paths;
+  size_t npaths;
+
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+
+  // Puzzles that are ready to be solved and puzzles that have been
+  // solved, when using io_uring.
+  struct job *solve_head;
+  struct job **solve_tail;
+  struct job *solved;
+
+  // Index of the next puzzle to process when not using io_uring.
+  size_t next;
+
+  // Eventfd through which the main thread is notified of puzzles that
+  // have been solved, and a buffer for reading it through io_uring.
+  uint64_t events;
+  int eventfd;
+
+  bool failed;
+  bool shutdown;
+  unsigned char padding[2];
+};
+
+static void corpus_error(struct corpus *c, const char *path, int error) {
+  pthread_mutex_lock(&c->lock);
+  fprintf(stderr, "%s: %s\n", path, strerror(error));
+  c->failed = true;
+  pthread_mutex_unlock(&c->lock);
+}
+
+// Returns the name of the output file of an input file.
+static const char *output_name(const char *path) {
+  const char *slash = strrchr(path, '/');
+  return slash == NULL ? path : slash + 1;
+}
+
+static int output_name_compare(const void *a, const void *b) {
+  return strcmp(output_name(*(char *const *)a), output_name(*(char *const *)b));
+}
+
+// Prepares a job for a given input file, computing the path of the
+// output file.
+static bool job_init(struct corpus *c, struct job *j, const char *path) {
+  j->input_path = path;
+  j->output = (struct buffer){.data = NULL};
+  j->written = 0;
+  int len = snprintf(j->output_path, sizeof(j->output_path), "%s/%s",
+                     c->output_dir, output_name(path));
+  if (len < 0 || (size_t)len >= sizeof(j->output_path)) {
+    corpus_error(c, path, ENAMETOOLONG);
+    return false;
+  }
+  return true;
+}
+
+// Solves the puzzle contained in the input of a job.
+static void job_solve(struct corpus *c, struct job *j) {
+  j->input[j->input_len] = '\0';
+  struct il_problem p;
+  if (!il_problem_parse(j->input, &p)) {
+    pthread_mutex_lock(&c->lock);
+    fprintf(stderr, "%s: Failed to parse input\n", j->input_path);
+    c->failed = true;
+    pthread_mutex_unlock(&c->lock);
+    j->output.failed = true;
+    return;
+  }
+  if (c->snapshot == NULL ||
+      !il_snapshot_lookup(c->snapshot, &p, append_solution, &j->output))
+    il_problem_solve(&p, append_solution, &j->output);
+
+  char buf[64];
+  snprintf(buf, sizeof(buf), "-- FOUND %u SOLUTIONS --\n",
+           j->output.solutions);
+  buffer_append(&j->output, buf);
+  if (j->output.failed) {
+    pthread_mutex_lock(&c->lock);
+    fprintf(stderr, "%s: Failed to print solution\n", j->input_path);
+    c->failed = true;
+    pthread_mutex_unlock(&c->lock);
+  }
+}
+
+// Worker thread that performs its own I/O, used if io_uring is
+// unavailable.
+static void *io_worker(void *arg) {
+  struct corpus *c = arg;
+  struct job *j = malloc(sizeof(*j));
+  if (j == NULL) {
+    corpus_error(c, "worker", ENOMEM);
+    return NULL;
+  }
+  for (;;) {
+    pthread_mutex_lock(&c->lock);
+    size_t i = c->next++;
+    pthread_mutex_unlock(&c->lock);
+    if (i >= c->npaths)
+      break;
+    if (!job_init(c, j, c->paths[i]))
+      continue;
+
+    // Read the input.
+    int fd = open(j->input_path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+      corpus_error(c, j->input_path, errno);
+      continue;
+    }
+    ssize_t len = read(fd, j->input, sizeof(j->input) - 1);
+    int error = errno;
+    close(fd);
+    if (len < 0) {
+      corpus_error(c, j->input_path, error);
+      continue;
+    }
+    j->input_len = (size_t)len;
+
+    // Solve the puzzle and write the output.
+    job_solve(c, j);
+    if (!j->output.failed) {
+      fd = open(j->output_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC,
+                0666);
+      if (fd < 0) {
+        corpus_error(c, j->output_path, errno);
+      } else {
+        while (j->written < j->output.len) {
+          len = write(fd, j->output.data + j->written,
+                      j->output.len - j->written);
+          if (len < 0) {
+            corpus_error(c, j->output_path, errno);
+            break;
+          }
+          j->written += (size_t)len;
+        }
+        close(fd);
+      }
+    }
+    free(j->output.data);
+  }
+  free(j);
+  return NULL;
+}
+
+#ifdef __linux__
+
+// Worker thread solving puzzles read by the main thread.
+static void *solve_worker(void *arg) {
+  struct corpus *c = arg;
+  pthread_mutex_lock(&c->lock);
+  for (;;) {
+    struct job *j = c->solve_head;
+    if (j == NULL) {
+      if (c->shutdown)
+        break;
+      pthread_cond_wait(&c->cond, &c->lock);
+      continue;
+    }
+    c->solve_head = j->next;
+    if (c->solve_head == NULL)
+      c->solve_tail = &c->solve_head;
+    pthread_mutex_unlock(&c->lock);
+
+    job_solve(c, j);
+
+    pthread_mutex_lock(&c->lock);
+    j->next = c->solved;
+    c->solved = j;
+    uint64_t one = 1;
+    if (write(c->eventfd, &one, sizeof(one)) != sizeof(one))
+      abort();
+  }
+  pthread_mutex_unlock(&c->lock);
+  return NULL;
+}
+
+// Minimal io_uring wrapper, using the system calls directly.
+struct ring {
+  void *sq_ptr;
+  size_t sq_size;
+  void *cq_ptr;
+  size_t cq_size;
+  struct io_uring_sqe *sqes;
+  size_t sqes_size;
+
+  unsigned int *sq_tail;
+  unsigned int *sq_array;
+  unsigned int *cq_head;
+  unsigned int *cq_tail;
+  struct io_uring_cqe *cqes;
+  unsigned int sq_mask;
+  unsigned int cq_mask;
+  unsigned int to_submit;
+  int fd;
+};
+
+static bool ring_init(struct ring *r, unsigned int entries) {
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+  long fd = syscall(__NR_io_uring_setup, entries, &params);
+  if (fd < 0)
+    return false;
+  r->fd = (int)fd;
+
+  // Map the submission queue, completion queue and submission entries.
+  r->sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+  r->cq_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+  if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0 &&
+      r->cq_size > r->sq_size)
+    r->sq_size = r->cq_size;
+  r->sqes_size = params.sq_entries * sizeof(struct io_uring_sqe);
+  r->sq_ptr = mmap(NULL, r->sq_size, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQ_RING);
+  if (r->sq_ptr == MAP_FAILED) {
+    close(r->fd);
+    return false;
+  }
+  if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+    r->cq_ptr = r->sq_ptr;
+  } else {
+    r->cq_ptr = mmap(NULL, r->cq_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_CQ_RING);
+    if (r->cq_ptr == MAP_FAILED) {
+      munmap(r->sq_ptr, r->sq_size);
+      close(r->fd);
+      return false;
+    }
+  }
+  r->sqes = mmap(NULL, r->sqes_size, PROT_READ | PROT_WRITE,
+                 MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQES);
+  if (r->sqes == MAP_FAILED) {
+    if (r->cq_ptr != r->sq_ptr)
+      munmap(r->cq_ptr, r->cq_size);
+    munmap(r->sq_ptr, r->sq_size);
+    close(r->fd);
+    return false;
+  }
+
+  char *sq = r->sq_ptr, *cq = r->cq_ptr;
+  r->sq_tail = (void *)(sq + params.sq_off.tail);
+  r->sq_mask = *(unsigned int *)(void *)(sq + params.sq_off.ring_mask);
+  r->sq_array = (void *)(sq + params.sq_off.array);
+  r->cq_head = (void *)(cq + params.cq_off.head);
+  r->cq_tail = (void *)(cq + params.cq_off.tail);
+  r->cq_mask = *(unsigned int *)(void *)(cq + params.cq_off.ring_mask);
+  r->cqes = (void *)(cq + params.cq_off.cqes);
+  r->to_submit = 0;
+  return true;
+}
+
+static void ring_destroy(struct ring *r) {
+  munmap(r->sqes, r->sqes_size);
+  if (r->cq_ptr != r->sq_ptr)
+    munmap(r->cq_ptr, r->cq_size);
+  munmap(r->sq_ptr, r->sq_size);
+  close(r->fd);
+}
+
+// Returns a cleared submission entry, which will be submitted on the
+// next call to ring_enter(). The caller needs to ensure that the number
+// of entries in flight never exceeds the size of the ring.
+static struct io_uring_sqe *ring_sqe(struct ring *r, uint8_t opcode, int fd,
+                                     const void *addr, unsigned int len,
+                                     uint64_t off, uint64_t user_data) {
+  unsigned int tail = *r->sq_tail;
+  unsigned int index = tail & r->sq_mask;
+  struct io_uring_sqe *sqe = &r->sqes[index];
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->opcode = opcode;
+  sqe->fd = fd;
+  sqe->addr = (uintptr_t)addr;
+  sqe->len = len;
+  sqe->off = off;
+  sqe->user_data = user_data;
+  r->sq_array[index] = index;
+  __atomic_store_n(r->sq_tail, tail + 1, __ATOMIC_RELEASE);
+  ++r->to_submit;
+  return sqe;
+}
+
+// Submits all pending entries and waits for at least one completion.
+static bool ring_enter(struct ring *r) {
+  for (;;) {
+    long ret = syscall(__NR_io_uring_enter, r->fd, r->to_submit, 1,
+                       IORING_ENTER_GETEVENTS, NULL, 0);
+    if (ret >= 0) {
+      r->to_submit -= (unsigned int)ret;
+      return true;
+    }
+    if (errno != EINTR)
+      return false;
+  }
+}
+
+// Returns the next completion, if any.
+static bool ring_reap(struct ring *r, struct io_uring_cqe *cqe) {
+  unsigned int head = *r->cq_head;
+  if (head == __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE))
+    return false;
+  *cqe = r->cqes[head & r->cq_mask];
+  __atomic_store_n(r->cq_head, head + 1, __ATOMIC_RELEASE);
+  return true;
+}
+
+// Submits an operation to close a file descriptor. Its completion is
+// only tracked for the purpose of waiting for it.
+static void ring_close(struct ring *r, int fd, size_t *closing) {
+  ring_sqe(r, IORING_OP_CLOSE, fd, NULL, 0, 0, 0);
+  ++*closing;
+}
+
+// Submits the next write of a job's output.
+static void job_write(struct ring *r, struct job *j) {
+  size_t len = j->output.len - j->written;
+  j->stage = JOB_WRITE_OUTPUT;
+  ring_sqe(r, IORING_OP_WRITE, j->fd, j->output.data + j->written,
+           len < UINT_MAX ? (unsigned int)len : UINT_MAX, j->written,
+           (uintptr_t)j);
+}
+
+// Advances a job after one of its I/O operations has completed.
+// Returns false if the job has finished.
+static bool job_advance(struct corpus *c, struct ring *r, struct job *j,
+                        int res, size_t *closing) {
+  if (j->stage == JOB_OPEN_INPUT) {
+    if (res < 0) {
+      corpus_error(c, j->input_path, -res);
+      return false;
+    }
+    j->fd = res;
+    j->stage = JOB_READ_INPUT;
+    ring_sqe(r, IORING_OP_READ, j->fd, j->input, sizeof(j->input) - 1, 0,
+             (uintptr_t)j);
+  } else if (j->stage == JOB_READ_INPUT) {
+    ring_close(r, j->fd, closing);
+    if (res < 0) {
+      corpus_error(c, j->input_path, -res);
+      return false;
+    }
+    j->input_len = (size_t)res;
+
+    // Hand the puzzle over to the worker threads.
+    j->stage = JOB_SOLVE;
+    j->next = NULL;
+    pthread_mutex_lock(&c->lock);
+    *c->solve_tail = j;
+    c->solve_tail = &j->next;
+    pthread_cond_signal(&c->cond);
+    pthread_mutex_unlock(&c->lock);
+  } else if (j->stage == JOB_SOLVE) {
+    if (j->output.failed)
+      return false;
+    j->stage = JOB_OPEN_OUTPUT;
+    struct io_uring_sqe *sqe =
+        ring_sqe(r, IORING_OP_OPENAT, AT_FDCWD, j->output_path, 0666, 0,
+                 (uintptr_t)j);
+    sqe->open_flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+  } else if (j->stage == JOB_OPEN_OUTPUT) {
+    if (res < 0) {
+      corpus_error(c, j->output_path, -res);
+      return false;
+    }
+    j->fd = res;
+    job_write(r, j);
+  } else {
+    if (res <= 0) {
+      corpus_error(c, j->output_path, res < 0 ? -res : EIO);
+      ring_close(r, j->fd, closing);
+      return false;
+    }
+    j->written += (size_t)res;
+    if (j->written == j->output.len) {
+      ring_close(r, j->fd, closing);
+      return false;
+    }
+    job_write(r, j);
+  }
+  return true;
+}
+
+static bool corpus_run_uring(struct corpus *c) {
+  struct ring r;
+  if (!ring_init(&r, 2 * CORPUS_JOBS + 2))
+    return false;
+  struct job *jobs = malloc(CORPUS_JOBS * sizeof(*jobs));
+  if (jobs == NULL) {
+    ring_destroy(&r);
+    return false;
+  }
+  struct job *free_jobs = NULL;
+  for (size_t i = 0; i < CORPUS_JOBS; ++i) {
+    jobs[i].next = free_jobs;
+    free_jobs = &jobs[i];
+  }
+
+  // Keep a read on the eventfd in flight, so that the main thread is
+  // woken up when puzzles have been solved.
+  ring_sqe(&r, IORING_OP_READ, c->eventfd, &c->events, sizeof(c->events), 0,
+           (uintptr_t)c);
+
+  size_t next = 0, active = 0, closing = 0;
+  while (next < c->npaths || active > 0 || closing > 0) {
+    // Start processing new puzzles.
+    while (free_jobs != NULL && next < c->npaths) {
+      struct job *j = free_jobs;
+      if (!job_init(c, j, c->paths[next++]))
+        continue;
+      free_jobs = j->next;
+      ++active;
+      j->stage = JOB_OPEN_INPUT;
+      struct io_uring_sqe *sqe =
+          ring_sqe(&r, IORING_OP_OPENAT, AT_FDCWD, j->input_path, 0, 0,
+                   (uintptr_t)j);
+      sqe->open_flags = O_RDONLY | O_CLOEXEC;
+    }
+
+    if (!ring_enter(&r)) {
+      perror("io_uring_enter");
+      exit(1);
+    }
+    struct io_uring_cqe cqe;
+    while (ring_reap(&r, &cqe)) {
+      if (cqe.user_data == 0) {
+        --closing;
+        continue;
+      }
+
+      // Collect the puzzles that have been solved.
+      struct job *finished = NULL;
+      if (cqe.user_data == (uintptr_t)c) {
+        ring_sqe(&r, IORING_OP_READ, c->eventfd, &c->events,
+                 sizeof(c->events), 0, (uintptr_t)c);
+        pthread_mutex_lock(&c->lock);
+        finished = c->solved;
+        c->solved = NULL;
+        pthread_mutex_unlock(&c->lock);
+      } else {
+        finished = (struct job *)(uintptr_t)cqe.user_data;
+        finished->next = NULL;
+      }
+
+      while (finished != NULL) {
+        struct job *j = finished;
+        finished = j->next;
+        if (!job_advance(c, &r, j, cqe.res, &closing)) {
+          free(j->output.data);
+          j->next = free_jobs;
+          free_jobs = j;
+          --active;
+        }
+      }
+    }
+  }
+
+  ring_destroy(&r);
+  free(jobs);
+  return true;
+}
+
+#endif
+
+static int corpus_main(struct il_snapshot *snapshot, const char *output_dir,
+                       char **paths, size_t npaths, size_t nthreads,
+                       bool use_uring) {
+  // Refuse to write the solutions of multiple input files to the same
+  // output file.
+  char **sorted = malloc(npaths * sizeof(*sorted));
+  if (sorted == NULL) {
+    perror("malloc");
+    return 1;
+  }
+  memcpy(sorted, paths, npaths * sizeof(*sorted));
+  qsort(sorted, npaths, sizeof(*sorted), output_name_compare);
+  for (size_t i = 1; i < npaths; ++i) {
+    if (output_name_compare(&sorted[i - 1], &sorted[i]) == 0) {
+      fprintf(stderr, "%s: Output file name collides with %s\n", sorted[i],
+              sorted[i - 1]);
+      free(sorted);
+      return 1;
+    }
+  }
+  free(sorted);
+
+  struct corpus c = {
+      .snapshot = snapshot,
+      .output_dir = output_dir,
+      .paths = paths,
+      .npaths = npaths,
+      .lock = PTHREAD_MUTEX_INITIALIZER,
+      .cond = PTHREAD_COND_INITIALIZER,
+  };
+  c.solve_tail = &c.solve_head;
+  pthread_t *threads = malloc(nthreads * sizeof(*threads));
+  if (threads == NULL) {
+    perror("malloc");
+    return 1;
+  }
+
+#ifdef __linux__
+  if (use_uring) {
+    // Let the worker threads solve puzzles, while the main thread
+    // performs I/O. Fall back to having the workers perform I/O if
+    // io_uring cannot be used.
+    c.eventfd = eventfd(0, EFD_CLOEXEC);
+    if (c.eventfd < 0) {
+      perror("eventfd");
+      return 1;
+    }
+    for (size_t i = 0; i < nthreads; ++i) {
+      if (pthread_create(&threads[i], NULL, solve_worker, &c) != 0) {
+        perror("pthread_create");
+        return 1;
+      }
+    }
+    use_uring = corpus_run_uring(&c);
+    pthread_mutex_lock(&c.lock);
+    c.shutdown = true;
+    pthread_cond_broadcast(&c.cond);
+    pthread_mutex_unlock(&c.lock);
+    for (size_t i = 0; i < nthreads; ++i)
+      pthread_join(threads[i], NULL);
+    close(c.eventfd);
+  }
+#else
+  use_uring = false;
+#endif
+
+  if (!use_uring) {
+    for (size_t i = 0; i < nthreads; ++i) {
+      if (pthread_create(&threads[i], NULL, io_worker, &c) != 0) {
+        perror("pthread_create");
+        return 1;
+      }
+    }
+    for (size_t i = 0; i < nthreads; ++i)
+      pthread_join(threads[i], NULL);
+  }
+
+  free(threads);
+  return c.failed ? 1 : 0;
+}
+
+int main(int argc, char *argv[]) {
+  // Parse command line arguments. Puzzles that are part of a snapshot
+  // are not solved again.
+  struct il_snapshot *snapshot = NULL;
+  const char *output_dir = NULL;
+  const char *refutation = NULL;
+  long nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+  bool use_uring = true, text = false;
+  int c;
+  while ((c = getopt(argc, argv, "bj:o:r:s:T")) != -1) {
+    switch (c) {
+      case 'b':
+        text = true;
+        break;
+      case 'j':
+        nthreads = strtol(optarg, NULL, 10);
+        break;
+      case 'o':
+        output_dir = optarg;
+        break;
+      case 'r':
+        refutation = optarg;
+        break;
+      case 's':
+        snapshot = il_snapshot_open(optarg);
+        if (snapshot == NULL) {
+          fprintf(stderr, "Failed to open snapshot\n");
+          return 1;
+        }
+        break;
+      case 'T':
+        use_uring = false;
+        break;
+      default:
+        goto usage;
+    }
+  }
+  if (text && optind == argc && output_dir == NULL && refutation == NULL &&
+      snapshot == NULL) {
+    // Solve a sequence of puzzles read from stdin in one go.
+    char *buf = NULL;
+    size_t len = 0, cap = 0;
+    for (;;) {
+      if (len == cap) {
+        cap = cap == 0 ? 65536 : cap * 2;
+        char *newbuf = realloc(buf, cap);
+        if (newbuf == NULL) {
+          perror("realloc");
+          return 1;
+        }
+        buf = newbuf;
+      }
+      size_t ret = fread(buf + len, 1, cap - len, stdin);
+      if (ret == 0)
+        break;
+      len += ret;
+    }
+    int fd = STDOUT_FILENO;
+    if (!il_problem_solve_text(buf, len, il_sink_fd, &fd)) {
+      fprintf(stderr, "Failed to solve input\n");
+      return 1;
+    }
+    free(buf);
+    return 0;
+  } else if (output_dir != NULL && refutation == NULL && !text) {
+    // Solve puzzles stored in files provided on the command line.
+    return corpus_main(snapshot, output_dir, argv + optind,
+                       (size_t)(argc - optind),
+                       nthreads > 0 ? (size_t)nthreads : 1, use_uring);
+  } else if (optind != argc || output_dir != NULL || text) {
+  usage:
+    fprintf(stderr,
+            "usage: infiniteloop_cmd [-r refutation] [-s snapshot]\n"
+            "       infiniteloop_cmd -b\n"
+            "       infiniteloop_cmd [-s snapshot] [-j threads] [-T] "
+            "-o output_dir puzzle ...\n");
+    return 1;
+  }
+
   char buf[1024];
   size_t len = fread(buf, 1, sizeof(buf) - 1, stdin);
   buf[len] = '\0';
@@ -33,8 +749,24 @@ int main(void) {
     return 1;
   }
 
-  il_problem_solve(&p, print_solution, NULL);
+  if (snapshot == NULL ||
+      !il_snapshot_lookup(snapshot, &p, print_solution, NULL))
+    il_problem_solve(&p, print_solution, NULL);
 
   printf("-- FOUND %u SOLUTIONS --\n", solutions_found);
+
+  // Prove that the puzzle has no solutions if requested.
+  if (refutation != NULL && solutions_found == 0) {
+    int fd = open(refutation, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+    if (fd < 0) {
+      perror(refutation);
+      return 1;
+    }
+    bool written = il_problem_refute(&p, il_sink_fd, &fd);
+    if (close(fd) != 0 || !written) {
+      fprintf(stderr, "Failed to write refutation\n");
+      return 1;
+    }
+  }
   return 0;
 }
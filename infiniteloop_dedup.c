@@ -0,0 +1,645 @@
+// Copyright (c) 2016 Ed Schouten <ed@nuxi.nl>
+//
+// This file is distributed under a 2-clause BSD license.
+// See the LICENSE file for details.
+
+// Removes duplicate puzzles from a corpus, treating puzzles that only
+// differ by symmetry as duplicates.
+//
+// Puzzles are read from stdin in the form accepted by
+// il_problem_solve_text(). Every puzzle is numbered, starting at zero,
+// and converted to its canonical form. Records holding the canonical
+// form and the original puzzle are spread over a fixed number of
+// partition files, based on a hash of the canonical form. Partitions
+// are then processed one at a time per thread, merging the records of
+// duplicates as they are read, so that only a single record and the
+// numbers of the other puzzles are kept in memory per group.
+// Partitions that don't fit in the memory available to a thread are
+// processed in multiple passes, using more bits of the hash. This means
+// that the corpus only needs to fit on disk.
+//
+// The first puzzle of every group is written to stdout, preceded by a
+// line "-- PUZZLE --". Groups having more than one puzzle are followed
+// by a line "-- DUPLICATES i j ... --" listing the numbers of all of
+// its puzzles. The output can thus be solved with infiniteloop_cmd -b.
+// Groups are written in no particular order.
+
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/stat.h>
+
+#include "infiniteloop.h"
+
+// Number of partition files into which records are spread.
+#define DEDUP_FANOUT 256
+
+// Number of records buffered per partition and thread before they are
+// written to disk.
+#define DEDUP_BUFFER_RECORDS 16
+
+// Number of puzzles passed on to a thread at once.
+#define DEDUP_BATCH_PUZZLES 1024
+
+// Number of bytes needed to store a board at four bits per cell.
+#define DEDUP_BOARD_SIZE (((IL_AXIS - 2) * (IL_AXIS - 2) + 1) / 2)
+
+// Record of a single puzzle stored in a partition file.
+struct record {
+  uint64_t hash;
+  uint64_t index;
+  unsigned char canonical[DEDUP_BOARD_SIZE];
+  unsigned char original[DEDUP_BOARD_SIZE];
+  unsigned char padding[4];
+};
+
+static void board_pack(const struct il_problem *p, unsigned char *out) {
+  memset(out, 0, DEDUP_BOARD_SIZE);
+  size_t i = 0;
+  for (size_t x = 1; x < IL_AXIS - 1; ++x)
+    for (size_t y = 1; y < IL_AXIS - 1; ++y, ++i)
+      out[i / 2] |= (unsigned char)(p->board[x][y] << (i % 2 * 4));
+}
+
+static void board_unpack(const unsigned char *in, struct il_problem *p) {
+  memset(p, 0, sizeof(*p));
+  size_t i = 0;
+  for (size_t x = 1; x < IL_AXIS - 1; ++x)
+    for (size_t y = 1; y < IL_AXIS - 1; ++y, ++i)
+      p->board[x][y] = (in[i / 2] >> (i % 2 * 4)) & 0xf;
+}
+
+// Computes the FNV-1a hash of a packed board.
+static uint64_t board_hash(const unsigned char *in) {
+  uint64_t hash = 0xcbf29ce484222325;
+  for (size_t i = 0; i < DEDUP_BOARD_SIZE; ++i) {
+    hash ^= in[i];
+    hash *= 0x100000001b3;
+  }
+  return hash;
+}
+
+// Puzzle that is a duplicate of the first puzzle of a group.
+struct duplicate {
+  size_t group;
+  uint64_t index;
+};
+
+// Sorts duplicates by group and number.
+static int duplicate_compare(const void *a, const void *b) {
+  const struct duplicate *da = a, *db = b;
+  if (da->group != db->group)
+    return da->group < db->group ? -1 : 1;
+  return da->index < db->index ? -1 : da->index > db->index ? 1 : 0;
+}
+
+// Puzzles read from stdin, stored as null terminated strings.
+struct batch {
+  char *text;
+  size_t len;
+  size_t cap;
+  size_t npuzzles;
+  uint64_t first;
+  struct batch *next;
+};
+
+struct dedup {
+  const char *dir;
+  size_t memory;
+
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+
+  // Batches of puzzles that still need to be partitioned.
+  struct batch *head;
+  struct batch **tail;
+  size_t nbatches;
+  size_t max_batches;
+
+  // Partition files, which are appended to while holding their lock.
+  int fds[DEDUP_FANOUT];
+  pthread_mutex_t fd_locks[DEDUP_FANOUT];
+
+  // Next partition to process.
+  size_t next;
+
+  // Statistics.
+  uint64_t unique;
+  uint64_t duplicates;
+
+  bool failed;
+  bool eof;
+  unsigned char padding[6];
+};
+
+static void dedup_error(struct dedup *d, const char *message, int error) {
+  pthread_mutex_lock(&d->lock);
+  if (error != 0)
+    fprintf(stderr, "%s: %s\n", message, strerror(error));
+  else
+    fprintf(stderr, "%s\n", message);
+  d->failed = true;
+  pthread_mutex_unlock(&d->lock);
+}
+
+static bool write_all(int fd, const void *buf, size_t len) {
+  const char *in = buf;
+  while (len > 0) {
+    ssize_t written = write(fd, in, len);
+    if (written < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    in += written;
+    len -= (size_t)written;
+  }
+  return true;
+}
+
+// Records buffered by a single thread, grouped by partition.
+struct partition_buffer {
+  struct record records[DEDUP_FANOUT][DEDUP_BUFFER_RECORDS];
+  size_t counts[DEDUP_FANOUT];
+};
+
+static void partition_flush(struct dedup *d, struct partition_buffer *b,
+                            size_t i) {
+  if (b->counts[i] == 0)
+    return;
+  pthread_mutex_lock(&d->fd_locks[i]);
+  bool written = write_all(d->fds[i], b->records[i],
+                           b->counts[i] * sizeof(struct record));
+  pthread_mutex_unlock(&d->fd_locks[i]);
+  if (!written)
+    dedup_error(d, "write", errno);
+  b->counts[i] = 0;
+}
+
+// Canonicalizes batches of puzzles and spreads them over partitions,
+// using the top bits of their hashes.
+static void *partition_worker(void *arg) {
+  struct dedup *d = arg;
+  struct partition_buffer *b = calloc(1, sizeof(*b));
+  if (b == NULL) {
+    dedup_error(d, "calloc", errno);
+    return NULL;
+  }
+  for (;;) {
+    pthread_mutex_lock(&d->lock);
+    while (d->head == NULL && !d->eof)
+      pthread_cond_wait(&d->cond, &d->lock);
+    struct batch *batch = d->head;
+    if (batch != NULL) {
+      d->head = batch->next;
+      if (d->head == NULL)
+        d->tail = &d->head;
+      --d->nbatches;
+      pthread_cond_broadcast(&d->cond);
+    }
+    pthread_mutex_unlock(&d->lock);
+    if (batch == NULL)
+      break;
+
+    const char *text = batch->text;
+    for (size_t i = 0; i < batch->npuzzles; ++i) {
+      struct il_problem p, canonical;
+      if (!il_problem_parse(text, &p)) {
+        dedup_error(d, "Failed to parse input", 0);
+        break;
+      }
+      text += strlen(text) + 1;
+      il_problem_canonicalize(&p, &canonical);
+
+      struct record r = {.index = batch->first + i};
+      board_pack(&canonical, r.canonical);
+      board_pack(&p, r.original);
+      r.hash = board_hash(r.canonical);
+      size_t partition = r.hash >> 56;
+      b->records[partition][b->counts[partition]++] = r;
+      if (b->counts[partition] == DEDUP_BUFFER_RECORDS)
+        partition_flush(d, b, partition);
+    }
+    free(batch->text);
+    free(batch);
+  }
+  for (size_t i = 0; i < DEDUP_FANOUT; ++i)
+    partition_flush(d, b, i);
+  free(b);
+  return NULL;
+}
+
+// Output of a thread, written to stdout when full.
+struct output {
+  char buf[65536];
+  size_t len;
+};
+
+static void output_flush(struct dedup *d, struct output *o) {
+  pthread_mutex_lock(&d->lock);
+  bool written = write_all(STDOUT_FILENO, o->buf, o->len);
+  pthread_mutex_unlock(&d->lock);
+  if (!written)
+    dedup_error(d, "write", errno);
+  o->len = 0;
+}
+
+static void output_put(struct dedup *d, struct output *o, const char *str) {
+  size_t len = strlen(str);
+  if (o->len + len > sizeof(o->buf))
+    output_flush(d, o);
+  memcpy(o->buf + o->len, str, len);
+  o->len += len;
+}
+
+// Groups of duplicates found during a single pass over a partition.
+struct pass {
+  // Record of the first puzzle of every group.
+  struct record *groups;
+  size_t ngroups;
+  size_t groups_cap;
+
+  // Open addressing hash table of groups, using SIZE_MAX for empty
+  // slots. Its size is a power of two.
+  size_t *table;
+  size_t table_size;
+
+  // Other puzzles of the groups.
+  struct duplicate *duplicates;
+  size_t nduplicates;
+  size_t duplicates_cap;
+};
+
+// Upper bound on the number of bytes needed by a pass per record.
+#define DEDUP_PASS_RECORD_SIZE (sizeof(struct record) + 4 * sizeof(size_t))
+
+// Returns the first slot of the hash table to probe for a record. The
+// top bits of the hash are used to select partitions and passes, so
+// mix them with the bottom bits.
+static size_t pass_slot(const struct pass *p, uint64_t hash) {
+  return (size_t)(hash ^ hash >> 24) & (p->table_size - 1);
+}
+
+static void pass_reset(struct pass *p) {
+  for (size_t i = 0; i < p->table_size; ++i)
+    p->table[i] = SIZE_MAX;
+  p->ngroups = 0;
+  p->nduplicates = 0;
+}
+
+static bool pass_grow_table(struct pass *p) {
+  size_t size = p->table_size == 0 ? 1024 : p->table_size * 2;
+  size_t *table = malloc(size * sizeof(*table));
+  if (table == NULL)
+    return false;
+  free(p->table);
+  p->table = table;
+  p->table_size = size;
+  for (size_t i = 0; i < size; ++i)
+    table[i] = SIZE_MAX;
+  for (size_t i = 0; i < p->ngroups; ++i) {
+    size_t slot = pass_slot(p, p->groups[i].hash);
+    while (table[slot] != SIZE_MAX)
+      slot = (slot + 1) & (size - 1);
+    table[slot] = i;
+  }
+  return true;
+}
+
+// Adds a record to the group of its canonical form, creating the group
+// if none exists yet. Every group keeps the record of the puzzle with
+// the lowest number, as that is the one written to the output.
+static bool pass_add(struct pass *p, const struct record *r) {
+  if (p->ngroups * 2 >= p->table_size && !pass_grow_table(p))
+    return false;
+  size_t slot = pass_slot(p, r->hash);
+  for (; p->table[slot] != SIZE_MAX;
+       slot = (slot + 1) & (p->table_size - 1)) {
+    size_t group = p->table[slot];
+    struct record *first = &p->groups[group];
+    if (first->hash != r->hash ||
+        memcmp(first->canonical, r->canonical, DEDUP_BOARD_SIZE) != 0)
+      continue;
+
+    if (p->nduplicates == p->duplicates_cap) {
+      size_t cap = p->duplicates_cap == 0 ? 1024 : p->duplicates_cap * 2;
+      struct duplicate *duplicates =
+          realloc(p->duplicates, cap * sizeof(*duplicates));
+      if (duplicates == NULL)
+        return false;
+      p->duplicates = duplicates;
+      p->duplicates_cap = cap;
+    }
+    uint64_t index = r->index;
+    if (index < first->index) {
+      index = first->index;
+      *first = *r;
+    }
+    p->duplicates[p->nduplicates++] =
+        (struct duplicate){.group = group, .index = index};
+    return true;
+  }
+
+  if (p->ngroups == p->groups_cap) {
+    size_t cap = p->groups_cap == 0 ? 1024 : p->groups_cap * 2;
+    struct record *groups = realloc(p->groups, cap * sizeof(*groups));
+    if (groups == NULL)
+      return false;
+    p->groups = groups;
+    p->groups_cap = cap;
+  }
+  p->table[slot] = p->ngroups;
+  p->groups[p->ngroups++] = *r;
+  return true;
+}
+
+// Writes the groups of duplicates found during a pass.
+static void pass_output(struct dedup *d, struct output *o, struct pass *p) {
+  qsort(p->duplicates, p->nduplicates, sizeof(*p->duplicates),
+        duplicate_compare);
+  size_t k = 0;
+  for (size_t i = 0; i < p->ngroups; ++i) {
+    const struct record *first = &p->groups[i];
+    struct il_problem problem;
+    board_unpack(first->original, &problem);
+    char buf[IL_PROBLEM_PRINT_MAX];
+    il_problem_print(&problem, buf, sizeof(buf));
+    output_put(d, o, "-- PUZZLE --\n");
+    output_put(d, o, buf);
+    output_put(d, o, "\n");
+    if (k < p->nduplicates && p->duplicates[k].group == i) {
+      char index[32];
+      snprintf(index, sizeof(index), "-- DUPLICATES %llu",
+               (unsigned long long)first->index);
+      output_put(d, o, index);
+      for (; k < p->nduplicates && p->duplicates[k].group == i; ++k) {
+        snprintf(index, sizeof(index), " %llu",
+                 (unsigned long long)p->duplicates[k].index);
+        output_put(d, o, index);
+      }
+      output_put(d, o, " --\n");
+    }
+  }
+  pthread_mutex_lock(&d->lock);
+  d->unique += p->ngroups;
+  d->duplicates += p->nduplicates;
+  pthread_mutex_unlock(&d->lock);
+}
+
+// Processes a partition file, removing it afterwards. Partitions that
+// don't fit in memory are processed in multiple passes, each reading
+// the records whose hashes fall within a range. As duplicates have the
+// same hash, they are always read during the same pass, where they are
+// merged into the group of their canonical form right away. Every
+// duplicate thus only takes up the space of its number.
+static void partition_process(struct dedup *d, struct output *o,
+                              const char *path) {
+  FILE *f = fopen(path, "r");
+  struct stat sb;
+  if (f == NULL || fstat(fileno(f), &sb) != 0) {
+    dedup_error(d, path, errno);
+    if (f != NULL)
+      fclose(f);
+    return;
+  }
+  size_t n = (size_t)sb.st_size / sizeof(struct record);
+  size_t npasses = (n * DEDUP_PASS_RECORD_SIZE + d->memory - 1) / d->memory;
+  if (npasses == 0)
+    npasses = 1;
+
+  struct pass p = {};
+  for (size_t pass = 0; pass < npasses; ++pass) {
+    // Read the records of this pass. The top bits of the hash are the
+    // same for all records in the partition, so use the bits below.
+    rewind(f);
+    pass_reset(&p);
+    struct record buf[256];
+    size_t len;
+    bool added = true;
+    while (added && (len = fread(buf, sizeof(buf[0]), 256, f)) > 0) {
+      for (size_t i = 0; i < len && added; ++i)
+        if (((buf[i].hash >> 24 & 0xffffffff) * npasses) >> 32 == pass)
+          added = pass_add(&p, &buf[i]);
+    }
+    if (!added) {
+      dedup_error(d, "realloc", errno);
+      break;
+    }
+    if (ferror(f)) {
+      dedup_error(d, path, errno);
+      break;
+    }
+    pass_output(d, o, &p);
+  }
+  free(p.groups);
+  free(p.table);
+  free(p.duplicates);
+  fclose(f);
+  unlink(path);
+}
+
+static void *process_worker(void *arg) {
+  struct dedup *d = arg;
+  struct output *o = malloc(sizeof(*o));
+  if (o == NULL) {
+    dedup_error(d, "malloc", errno);
+    return NULL;
+  }
+  o->len = 0;
+  for (;;) {
+    pthread_mutex_lock(&d->lock);
+    size_t i = d->next++;
+    pthread_mutex_unlock(&d->lock);
+    if (i >= DEDUP_FANOUT)
+      break;
+    char path[PATH_MAX];
+    snprintf(path, sizeof(path), "%s/%02zx", d->dir, i);
+    partition_process(d, o, path);
+  }
+  output_flush(d, o);
+  free(o);
+  return NULL;
+}
+
+// Passes a batch of puzzles on to the threads partitioning them,
+// waiting if too many batches are pending already.
+static void batch_submit(struct dedup *d, struct batch *batch) {
+  pthread_mutex_lock(&d->lock);
+  while (d->nbatches >= d->max_batches)
+    pthread_cond_wait(&d->cond, &d->lock);
+  *d->tail = batch;
+  d->tail = &batch->next;
+  ++d->nbatches;
+  pthread_cond_broadcast(&d->cond);
+  pthread_mutex_unlock(&d->lock);
+}
+
+static bool batch_append(struct batch *batch, const char *str, size_t len) {
+  if (batch->len + len > batch->cap) {
+    size_t cap = batch->cap == 0 ? 65536 : batch->cap;
+    while (batch->len + len > cap)
+      cap *= 2;
+    char *text = realloc(batch->text, cap);
+    if (text == NULL)
+      return false;
+    batch->text = text;
+    batch->cap = cap;
+  }
+  memcpy(batch->text + batch->len, str, len);
+  batch->len += len;
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  long nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+  size_t memory = 256;
+  const char *tmpdir = getenv("TMPDIR");
+  int c;
+  while ((c = getopt(argc, argv, "j:m:t:")) != -1) {
+    switch (c) {
+      case 'j':
+        nthreads = strtol(optarg, NULL, 10);
+        break;
+      case 'm':
+        memory = strtoul(optarg, NULL, 10);
+        break;
+      case 't':
+        tmpdir = optarg;
+        break;
+      default:
+        goto usage;
+    }
+  }
+  if (optind != argc || memory == 0) {
+  usage:
+    fprintf(stderr,
+            "usage: infiniteloop_dedup [-j threads] [-m megabytes] "
+            "[-t tmpdir] < puzzles\n");
+    return 1;
+  }
+  size_t threads = nthreads > 0 ? (size_t)nthreads : 1;
+
+  // Create a directory holding the partition files.
+  char dir[PATH_MAX];
+  snprintf(dir, sizeof(dir), "%s/infiniteloop_dedup.XXXXXX",
+           tmpdir != NULL ? tmpdir : "/tmp");
+  if (mkdtemp(dir) == NULL) {
+    perror(dir);
+    return 1;
+  }
+  struct dedup d = {
+      .dir = dir,
+      .memory = memory * 1024 * 1024 / threads,
+      .lock = PTHREAD_MUTEX_INITIALIZER,
+      .cond = PTHREAD_COND_INITIALIZER,
+      .max_batches = threads * 2,
+  };
+  d.tail = &d.head;
+  for (size_t i = 0; i < DEDUP_FANOUT; ++i) {
+    char path[PATH_MAX + 4];
+    snprintf(path, sizeof(path), "%s/%02zx", dir, i);
+    d.fds[i] = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (d.fds[i] < 0) {
+      perror(path);
+      return 1;
+    }
+    pthread_mutex_init(&d.fd_locks[i], NULL);
+  }
+
+  pthread_t *workers = malloc(threads * sizeof(*workers));
+  if (workers == NULL) {
+    perror("malloc");
+    return 1;
+  }
+  for (size_t i = 0; i < threads; ++i) {
+    if (pthread_create(&workers[i], NULL, partition_worker, &d) != 0) {
+      perror("pthread_create");
+      return 1;
+    }
+  }
+
+  // Split the input into puzzles in the same way as
+  // il_problem_solve_text(), passing them on in batches.
+  struct batch *batch = NULL;
+  uint64_t npuzzles = 0;
+  bool in_puzzle = true, has_lines = false;
+  char *line = NULL;
+  size_t linecap = 0;
+  for (;;) {
+    ssize_t len = getline(&line, &linecap, stdin);
+    bool separator = len >= 2 && line[0] == '-' && line[1] == '-';
+    if ((len < 0 || separator) && in_puzzle && has_lines) {
+      // End the current puzzle.
+      if (!batch_append(batch, "", 1)) {
+        perror("realloc");
+        return 1;
+      }
+      ++npuzzles;
+      if (++batch->npuzzles == DEDUP_BATCH_PUZZLES) {
+        batch_submit(&d, batch);
+        batch = NULL;
+      }
+    }
+    if (len < 0)
+      break;
+    if (separator) {
+      in_puzzle = strncmp(line, "-- PUZZLE --", 12) == 0;
+      has_lines = false;
+    } else if (in_puzzle) {
+      if (batch == NULL) {
+        batch = calloc(1, sizeof(*batch));
+        if (batch == NULL) {
+          perror("calloc");
+          return 1;
+        }
+        batch->first = npuzzles;
+      }
+      if (!batch_append(batch, line, (size_t)len)) {
+        perror("realloc");
+        return 1;
+      }
+      has_lines = true;
+    }
+  }
+  free(line);
+  if (ferror(stdin)) {
+    perror("stdin");
+    return 1;
+  }
+  if (batch != NULL)
+    batch_submit(&d, batch);
+
+  pthread_mutex_lock(&d.lock);
+  d.eof = true;
+  pthread_cond_broadcast(&d.cond);
+  pthread_mutex_unlock(&d.lock);
+  for (size_t i = 0; i < threads; ++i)
+    pthread_join(workers[i], NULL);
+  for (size_t i = 0; i < DEDUP_FANOUT; ++i)
+    close(d.fds[i]);
+
+  // Find the duplicates within every partition.
+  for (size_t i = 0; i < threads; ++i) {
+    if (pthread_create(&workers[i], NULL, process_worker, &d) != 0) {
+      perror("pthread_create");
+      return 1;
+    }
+  }
+  for (size_t i = 0; i < threads; ++i)
+    pthread_join(workers[i], NULL);
+  free(workers);
+  rmdir(dir);
+
+  fprintf(stderr, "%llu puzzles, %llu unique, %llu duplicates\n",
+          (unsigned long long)npuzzles, (unsigned long long)d.unique,
+          (unsigned long long)d.duplicates);
+  return d.failed ? 1 : 0;
+}
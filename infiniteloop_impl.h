@@ -0,0 +1,495 @@
+// Copyright (c) 2016 Ed Schouten <ed@nuxi.nl>
+//
+// This file is distributed under a 2-clause BSD license.
+// See the LICENSE file for details.
+
+// Internal helpers shared between the source files of the library and
+// the tools that are built alongside it.
+
+#ifndef INFINITELOOP_IMPL_H
+#define INFINITELOOP_IMPL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <sys/mman.h>
+
+#include "infiniteloop.h"
+
+// Statically defined tracing probes, which tools like bpftrace and perf
+// can attach to at run time. Every probe compiles to a single nop if
+// <sys/sdt.h> is available, and to nothing at all otherwise. Probes can
+// be left out explicitly by defining IL_NO_PROBES.
+//
+// The solver for struct il_problem provides these probes:
+//
+// solve-start(problem), solve-end(nodes, solutions, stopped),
+// guess(x, y, depth, tablebase), contradiction(x, y) and
+// solution(depth, solutions).
+//
+// The solver for large boards provides these probes, where cells are
+// identified by their index in the layout of the board:
+//
+// large-solve-start(width, height),
+// large-solve-end(solutions, trail_peak, decisions_peak),
+// large-guess(index, depth), large-contradiction(index) and
+// large-solution(depth, solutions).
+#if !defined(IL_NO_PROBES) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define IL_PROBES
+#endif
+#endif
+
+#ifdef IL_PROBES
+#define PROBE1(name, a) DTRACE_PROBE1(infiniteloop, name, a)
+#define PROBE2(name, a, b) DTRACE_PROBE2(infiniteloop, name, a, b)
+#define PROBE3(name, a, b, c) DTRACE_PROBE3(infiniteloop, name, a, b, c)
+#define PROBE4(name, a, b, c, d) DTRACE_PROBE4(infiniteloop, name, a, b, c, d)
+#else
+#define PROBE1(name, a) ((void)(a))
+#define PROBE2(name, a, b) ((void)(a), (void)(b))
+#define PROBE3(name, a, b, c) ((void)(a), (void)(b), (void)(c))
+#define PROBE4(name, a, b, c, d) ((void)(a), (void)(b), (void)(c), (void)(d))
+#endif
+
+// Rotates a cell clockwise by i steps. The number of steps has to be
+// provided in the form 1 << i.
+static inline unsigned char rotate(unsigned char a, unsigned char b) {
+  unsigned char v = (unsigned char)(a * b);
+  return (v | (v >> 4)) & 0xf;
+}
+
+// Rotates a cell by 2 steps, effectively turning the cell upside down.
+static inline unsigned char rotate2(unsigned char c) {
+  return ((c << 2) | (c >> 2)) & 0xf;
+}
+
+// Determines the union of all of the edges that could be set if the
+// cell is rotated by any number of steps encoded in a bitmask. This
+// function is effectively identical to:
+//
+// fanout(a, b) == rotate(a, b & 0x1) | rotate(a, b & 0x2) |
+//                 rotate(a, b & 0x4) | rotate(a, b & 0x8)
+static inline unsigned char fanout(unsigned char a, unsigned char b) {
+  unsigned char v = (unsigned char)(a * (b & 0x1) | a * (b & 0x2) |
+                                    a * (b & 0x4) | a * (b & 0x8));
+  return (v | (v >> 4)) & 0xf;
+}
+
+// Returns true if the cell only has a single edge set.
+static inline bool single_bit_set(unsigned char c) {
+  return (c & (c - 1)) == 0;
+}
+
+// Returns the initial set of options under which a cell may be placed.
+// All cells may be rotated to all four directions, except for shapes
+// that have rotational symmetry. For these shapes, we only need them to
+// be tried in one or two directions.
+static inline unsigned char initial_option(unsigned char c) {
+  return (c == 0 || c == 0xf) ? 0x1 : c >> 2 == (c & 0x3) ? 0x3 : 0xf;
+}
+
+// Restricts the options under which a cell may be placed, given the
+// edges that may be set and the edges that may be absent according to
+// its neighbours.
+static inline unsigned char restrict_options(unsigned char board,
+                                             unsigned char options,
+                                             unsigned char may_be_set,
+                                             unsigned char may_be_clear) {
+  unsigned char new_options = 0;
+  for (unsigned char i = 0x1; i <= 0x8; i <<= 1) {
+    if ((options & i) != 0) {
+      unsigned char c = rotate(board, i);
+      if ((c & ~may_be_set) == 0 && (c | may_be_clear) == 0xf)
+        new_options |= i;
+    }
+  }
+  return new_options;
+}
+
+// Restricts the options under which a cell of a puzzle may be placed,
+// by looking at the edges that its neighbours may have.
+static inline unsigned char restrict_cell(
+    const struct il_problem *p, const unsigned char options[IL_AXIS][IL_AXIS],
+    size_t x, size_t y) {
+#define YES(x, y, idx) (fanout(p->board[x][y], options[x][y]) & (1 << idx))
+  // Determine which edges may be present.
+  unsigned char may_be_set = rotate2(YES(x, y + 1, 0) | YES(x - 1, y, 1) |
+                                     YES(x, y - 1, 2) | YES(x + 1, y, 3));
+#undef YES
+#define NO(x, y, idx) (fanout(p->board[x][y] ^ 0xf, options[x][y]) & (1 << idx))
+  // Determine which edges may be absent.
+  unsigned char may_be_clear = rotate2(NO(x, y + 1, 0) | NO(x - 1, y, 1) |
+                                       NO(x, y - 1, 2) | NO(x + 1, y, 3));
+#undef NO
+
+  // Compute ways in which this cell may be placed by using the bitmasks
+  // obtained above.
+  return restrict_options(p->board[x][y], options[x][y], may_be_set,
+                          may_be_clear);
+}
+
+// Returns the option under which a cell is placed such that it has a
+// given set of edges, or zero if none of the options match.
+static inline unsigned char option_for_edges(unsigned char board,
+                                             unsigned char options,
+                                             unsigned char edges) {
+  for (unsigned char i = 0x1; i <= 0x8; i <<= 1)
+    if ((options & i) != 0 && rotate(board, i) == edges)
+      return i;
+  return 0;
+}
+
+// Returns the outgoing edges of a cell in a solution. Coordinates are
+// provided in the same form as the board of a problem.
+static inline unsigned char solution_edges(const struct il_solution *s,
+                                           size_t x, size_t y) {
+  return (unsigned char)((y > 1 && s->vertical[x - 1][y - 2] ? 0x1 : 0) |
+                         (x < IL_AXIS - 2 && s->horizontal[x - 1][y - 1] ? 0x2
+                                                                         : 0) |
+                         (y < IL_AXIS - 2 && s->vertical[x - 1][y - 1] ? 0x4
+                                                                       : 0) |
+                         (x > 1 && s->horizontal[x - 2][y - 1] ? 0x8 : 0));
+}
+
+// Returns the shape of a cell, regardless of its orientation. Shapes
+// are returned in the same form as emitted by il_problem_parse().
+static inline unsigned char shape(unsigned char c) {
+  switch (c & 0xf) {
+    case 0x0:
+      return 0x0;
+    case 0x1:
+    case 0x2:
+    case 0x4:
+    case 0x8:
+      return 0x1;
+    case 0x5:
+    case 0xa:
+      return 0x5;
+    case 0x7:
+    case 0xb:
+    case 0xd:
+    case 0xe:
+      return 0x7;
+    case 0xf:
+      return 0xf;
+    default:
+      return 0x3;
+  }
+}
+
+// Applies one of the eight symmetries of the square to the edges of a
+// cell. Symmetries are numbered such that bits 0 and 1 store the number
+// of clockwise quarter turns and bit 2 indicates that the cell is
+// mirrored horizontally before turning.
+static inline unsigned char symmetry_edges(size_t t, unsigned char c) {
+  if ((t & 0x4) != 0)
+    c = (c & 0x5) | ((c & 0x2) << 2) | ((c & 0x8) >> 2);
+  return rotate(c, (unsigned char)(1 << (t & 0x3)));
+}
+
+// Reverts the effect of symmetry_edges().
+static inline unsigned char symmetry_edges_inverse(size_t t, unsigned char c) {
+  c = rotate(c, (unsigned char)(1 << ((4 - (t & 0x3)) & 0x3)));
+  if ((t & 0x4) != 0)
+    c = (c & 0x5) | ((c & 0x2) << 2) | ((c & 0x8) >> 2);
+  return c;
+}
+
+// Applies one of the eight symmetries of the square to cell
+// coordinates, using the same numbering as symmetry_edges().
+static inline void symmetry_coords(unsigned int t, int *x, int *y) {
+  if ((t & 0x4) != 0)
+    *x = -*x;
+  for (unsigned int i = 0; i < (t & 0x3); ++i) {
+    int tmp = *x;
+    *x = -*y;
+    *y = tmp;
+  }
+}
+
+// Largest component of connected non-empty cells that is stored in the
+// tablebase. Components also need to fit in a 4x4 bounding box.
+#define TABLEBASE_CELLS 8
+
+// Small component of connected non-empty cells.
+//
+// Components are keyed by their canonical form. The key stores the
+// shapes of the cells within a 4x4 bounding box, using three bits per
+// position, with the top left position stored in the least significant
+// bits. The canonical form is the symmetry of the component that yields
+// the lowest key.
+struct component {
+  size_t ncells;
+  size_t x[TABLEBASE_CELLS];
+  size_t y[TABLEBASE_CELLS];
+  unsigned char shape[TABLEBASE_CELLS];
+
+  // Computed by component_canonicalize(). The order array contains the
+  // indices of the cells above, sorted by their canonical position.
+  uint64_t key;
+  size_t symmetry;
+  size_t order[TABLEBASE_CELLS];
+};
+
+// Converts a shape to the three-bit code used in tablebase keys.
+static inline uint64_t component_shape_code(unsigned char s) {
+  switch (s) {
+    case 0x1:
+      return 1;
+    case 0x3:
+      return 2;
+    case 0x5:
+      return 3;
+    case 0x7:
+      return 4;
+    default:
+      return 5;
+  }
+}
+
+// Computes the canonical form of a component. Returns false if the
+// component does not fit in a 4x4 bounding box.
+static inline bool component_canonicalize(struct component *c) {
+  c->key = UINT64_MAX;
+  c->symmetry = 0;
+  for (unsigned int t = 0; t < 8; ++t) {
+    // Transform all cells and compute the bounding box.
+    int tx[TABLEBASE_CELLS], ty[TABLEBASE_CELLS];
+    int minx = INT32_MAX, miny = INT32_MAX, maxx = INT32_MIN,
+        maxy = INT32_MIN;
+    for (size_t i = 0; i < c->ncells; ++i) {
+      tx[i] = (int)c->x[i];
+      ty[i] = (int)c->y[i];
+      symmetry_coords(t, &tx[i], &ty[i]);
+      if (tx[i] < minx)
+        minx = tx[i];
+      if (tx[i] > maxx)
+        maxx = tx[i];
+      if (ty[i] < miny)
+        miny = ty[i];
+      if (ty[i] > maxy)
+        maxy = ty[i];
+    }
+    if (maxx - minx >= 4 || maxy - miny >= 4)
+      return false;
+
+    // Place the cells in the bounding box.
+    uint64_t key = 0;
+    size_t cells[16];
+    unsigned int occupied = 0;
+    for (size_t i = 0; i < c->ncells; ++i) {
+      unsigned int pos = (unsigned int)((ty[i] - miny) * 4 + (tx[i] - minx));
+      key |= component_shape_code(c->shape[i]) << (3 * pos);
+      cells[pos] = i;
+      occupied |= 1U << pos;
+    }
+
+    // Keep the symmetry yielding the lowest key.
+    if (key < c->key) {
+      c->key = key;
+      c->symmetry = t;
+      size_t n = 0;
+      for (unsigned int pos = 0; pos < 16; ++pos)
+        if ((occupied & (1U << pos)) != 0)
+          c->order[n++] = cells[pos];
+    }
+  }
+  return true;
+}
+
+// Entry in the tablebase, referring to a range of solutions. Every
+// solution stores the edges of the cells of a canonical component in
+// its nibbles, starting with the least significant nibble.
+struct tablebase_entry {
+  uint64_t key;
+  uint32_t offset;
+  uint32_t count;
+};
+
+// Region of memory from which all state of a solver is allocated.
+//
+// Memory is obtained through a single anonymous mapping, which is
+// released in one go when the solver finishes. As the mapping is only
+// backed by physical memory as it gets used, it may be sized for the
+// worst case.
+struct arena {
+  unsigned char *base;
+  size_t size;
+  size_t used;
+};
+
+// Alignment of allocations, chosen to match the size of a cache line.
+#define ARENA_ALIGN 64
+
+// Size of a huge page that may be used to back an arena.
+#define ARENA_HUGE_PAGE_SIZE ((size_t)2 << 20)
+
+// Creates an arena of a given size, optionally backed by huge pages to
+// reduce TLB misses.
+static inline bool arena_init(struct arena *a, size_t size, bool huge_pages) {
+  // Reserve an additional huge page, so that the arena can be aligned.
+  size = (size + ARENA_HUGE_PAGE_SIZE - 1) & ~(ARENA_HUGE_PAGE_SIZE - 1);
+  size_t mapped = huge_pages ? size + ARENA_HUGE_PAGE_SIZE : size;
+  int flags = MAP_PRIVATE | MAP_ANON;
+#ifdef MAP_NORESERVE
+  flags |= MAP_NORESERVE;
+#endif
+  void *base = mmap(NULL, mapped, PROT_READ | PROT_WRITE, flags, -1, 0);
+  if (base == MAP_FAILED)
+    return false;
+  a->base = base;
+  a->size = size;
+  a->used = 0;
+
+  if (huge_pages) {
+    // Unmap the unaligned parts at the start and the end.
+    size_t head =
+        (ARENA_HUGE_PAGE_SIZE - (uintptr_t)base % ARENA_HUGE_PAGE_SIZE) %
+        ARENA_HUGE_PAGE_SIZE;
+    if (head > 0)
+      munmap(base, head);
+    a->base += head;
+    munmap(a->base + size, ARENA_HUGE_PAGE_SIZE - head);
+#ifdef MADV_HUGEPAGE
+    madvise(a->base, size, MADV_HUGEPAGE);
+#endif
+  }
+  return true;
+}
+
+// Allocates memory from an arena. The caller is responsible for sizing
+// the arena in such a way that allocations never fail, accounting for
+// ARENA_ALIGN bytes of padding per allocation.
+static inline void *arena_alloc(struct arena *a, size_t size) {
+  void *p = a->base + a->used;
+  a->used = (a->used + size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+  return p;
+}
+
+// Releases all memory of an arena.
+static inline void arena_destroy(struct arena *a) {
+  munmap(a->base, a->size);
+}
+
+// Renderer of solutions, emitting output in chunks to a sink.
+//
+// Cells are written row by row, as drawn by il_solution_print(). Output
+// is collected in a buffer of fixed size that is passed on to the sink
+// when full, meaning that the amount of memory used does not depend on
+// the size of the board. Whitespace is only written once it is followed
+// by an edge, so that no lines have trailing whitespace.
+struct renderer {
+  bool (*sink)(const char *, size_t, void *);
+  void *thunk;
+  size_t posx;
+  size_t posy;
+  size_t len;
+  char buf[4096];
+};
+
+// Passes on the contents of the buffer of a renderer to its sink.
+static inline bool renderer_flush(struct renderer *r) {
+  if (r->len == 0)
+    return true;
+  size_t len = r->len;
+  r->len = 0;
+  return r->sink(r->buf, len, r->thunk);
+}
+
+// Appends a string to the buffer of a renderer.
+static inline bool renderer_put(struct renderer *r, const char *in) {
+  size_t inlen = strlen(in);
+  if (r->len + inlen > sizeof(r->buf) && !renderer_flush(r))
+    return false;
+  memcpy(r->buf + r->len, in, inlen);
+  r->len += inlen;
+  return true;
+}
+
+// Writes whitespace until a given position has been reached.
+static inline bool renderer_move(struct renderer *r, size_t x, size_t y) {
+  while (y > r->posy) {
+    if (!renderer_put(r, "\n"))
+      return false;
+    r->posx = 0;
+    ++r->posy;
+  }
+  while (x > r->posx) {
+    if (!renderer_put(r, " "))
+      return false;
+    ++r->posx;
+  }
+  return true;
+}
+
+// Renders a board of a given width and height, where the outgoing
+// edges of every cell are obtained through a callback. Output is
+// appended to the buffer without being flushed and is not terminated by
+// a newline.
+static inline bool renderer_draw(struct renderer *r, size_t width,
+                                 size_t height,
+                                 unsigned char (*edges)(const void *, size_t,
+                                                        size_t),
+                                 const void *arg) {
+  r->posx = 0;
+  r->posy = 0;
+  for (size_t y = 0; y < height; ++y) {
+    // Print lines containing cells and horizontal edges.
+    for (size_t x = 0; x < width; ++x) {
+      unsigned char idx = edges(arg, x, y);
+      if (idx != 0) {
+        const char cells[16][4] = {"",  "╵", "╶", "╰", "╷", "│", "╭", "├",
+                                   "╴", "╯", "─", "┴", "╮", "┤", "┬", "┼"};
+        if (!renderer_move(r, 3 * x, 2 * y) || !renderer_put(r, cells[idx]))
+          return false;
+        ++r->posx;
+        if ((idx & 0x2) != 0) {
+          if (!renderer_put(r, "──"))
+            return false;
+          r->posx += 2;
+        }
+      }
+    }
+
+    // Print lines containing vertical edges.
+    for (size_t x = 0; x < width; ++x) {
+      if ((edges(arg, x, y) & 0x4) != 0) {
+        if (!renderer_move(r, 3 * x, 2 * y + 1) || !renderer_put(r, "│"))
+          return false;
+        ++r->posx;
+      }
+    }
+  }
+  return true;
+}
+
+// Renders a board in the same way as renderer_draw(), flushing the
+// output afterwards.
+static inline bool renderer_run(struct renderer *r, size_t width,
+                                size_t height,
+                                unsigned char (*edges)(const void *, size_t,
+                                                       size_t),
+                                const void *arg) {
+  return renderer_draw(r, width, height, edges, arg) && renderer_flush(r);
+}
+
+// Performs only the initial propagation step of
+// il_large_problem_solve(), so that it can be benchmarked separately.
+// Stores whether the board is consistent after propagation. Returns
+// false if the state of the solver could not be allocated.
+bool il_large_problem_propagate(const struct il_large_problem *, int,
+                                bool *);
+
+// Variant of il_problem_solve_batch() that simulates a number of NUMA
+// nodes that each span all CPUs, or uses the actual topology if zero.
+// This allows testing threads sharing queues on any system.
+bool il_problem_solve_batch_numa(
+    const struct il_problem *, size_t, size_t, size_t, int,
+    struct il_parallel_stats *,
+    bool (*)(size_t, const struct il_solution *, void *), void *);
+
+#endif
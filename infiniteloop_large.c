@@ -0,0 +1,1147 @@
+// Copyright (c) 2016 Ed Schouten <ed@nuxi.nl>
+//
+// This file is distributed under a 2-clause BSD license.
+// See the LICENSE file for details.
+
+// Solver for boards that are larger than IL_AXIS.
+//
+// The solver for struct il_problem copies the full table of options
+// every time it makes a guess and repeatedly sweeps over the entire
+// board during propagation. Both are fine for small boards, but don't
+// scale. This solver instead keeps a single table of options, a trail
+// of changes made to it that can be undone when backtracking, and a
+// worklist of cells whose neighbours have changed.
+
+#include <limits.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "infiniteloop.h"
+#include "infiniteloop_impl.h"
+
+struct il_large_problem {
+  size_t width;
+  size_t height;
+
+  // Number of cells per row for IL_LAYOUT_ROW_MAJOR, or the number of
+  // tiles per row for IL_LAYOUT_TILED. Rows and tiles include the outer
+  // border of the board.
+  size_t stride;
+  size_t ncells;
+  unsigned char *board;
+  enum il_layout layout;
+  uint32_t padding;
+};
+
+struct il_large_solution {
+  const struct il_large_problem *p;
+  const unsigned char *options;
+};
+
+// Returns the index at which a cell is stored. Coordinates include the
+// outer border of the board.
+static size_t layout_index(const struct il_large_problem *p, size_t x,
+                           size_t y) {
+  switch (p->layout) {
+    case IL_LAYOUT_ROW_MAJOR:
+      return y * p->stride + x;
+    case IL_LAYOUT_TILED:
+      return ((y >> 3) * p->stride + (x >> 3)) << 6 | (y & 7) << 3 | (x & 7);
+  }
+  abort();
+}
+
+// Returns the index of a neighbouring cell, using the same numbering
+// of directions as the bits of a cell. The cell may not be part of the
+// outer border of the board.
+static size_t layout_neighbour(const struct il_large_problem *p, size_t i,
+                               unsigned int d) {
+  switch (p->layout) {
+    case IL_LAYOUT_ROW_MAJOR:
+      switch (d) {
+        case 0:
+          return i - p->stride;
+        case 1:
+          return i + 1;
+        case 2:
+          return i + p->stride;
+        default:
+          return i - 1;
+      }
+    case IL_LAYOUT_TILED:
+      // Move within the tile, or to the adjacent tile.
+      switch (d) {
+        case 0:
+          return (i & 0x38) != 0 ? i - 8 : i - (p->stride << 6) + 0x38;
+        case 1:
+          return (i & 0x7) != 0x7 ? i + 1 : i + 0x40 - 0x7;
+        case 2:
+          return (i & 0x38) != 0x38 ? i + 8 : i + (p->stride << 6) - 0x38;
+        default:
+          return (i & 0x7) != 0 ? i - 1 : i - 0x40 + 0x7;
+      }
+  }
+  abort();
+}
+
+struct il_large_problem *il_large_problem_create(size_t width, size_t height,
+                                                 enum il_layout layout) {
+  struct il_large_problem *p = malloc(sizeof(*p));
+  if (p == NULL)
+    return NULL;
+  p->width = width;
+  p->height = height;
+  p->layout = layout;
+
+  // Determine the size of the board, including the outer border. Cell
+  // indices are stored as 32-bit integers by the solver.
+  if (layout == IL_LAYOUT_TILED) {
+    p->stride = (width + 9) / 8;
+    p->ncells = p->stride * ((height + 9) / 8) * 64;
+  } else {
+    p->stride = width + 2;
+    p->ncells = p->stride * (height + 2);
+  }
+  if (p->ncells > UINT32_MAX) {
+    free(p);
+    return NULL;
+  }
+
+  p->board = calloc(p->ncells, 1);
+  if (p->board == NULL) {
+    free(p);
+    return NULL;
+  }
+  return p;
+}
+
+void il_large_problem_destroy(struct il_large_problem *p) {
+  free(p->board);
+  free(p);
+}
+
+size_t il_large_problem_width(const struct il_large_problem *p) {
+  return p->width;
+}
+
+size_t il_large_problem_height(const struct il_large_problem *p) {
+  return p->height;
+}
+
+unsigned char il_large_problem_get(const struct il_large_problem *p, size_t x,
+                                   size_t y) {
+  return p->board[layout_index(p, x + 1, y + 1)];
+}
+
+void il_large_problem_set(struct il_large_problem *p, size_t x, size_t y,
+                          unsigned char c) {
+  p->board[layout_index(p, x + 1, y + 1)] = c & 0xf;
+}
+
+unsigned char il_large_solution_get(const struct il_large_solution *s,
+                                    size_t x, size_t y) {
+  size_t i = layout_index(s->p, x + 1, y + 1);
+  return rotate(s->p->board[i], s->options[i]);
+}
+
+// Callback for renderer_run() that obtains the outgoing edges of a cell.
+static unsigned char large_solution_render_edges(const void *arg, size_t x,
+                                                 size_t y) {
+  return il_large_solution_get(arg, x, y);
+}
+
+bool il_large_solution_render(const struct il_large_solution *s,
+                              bool (*sink)(const char *, size_t, void *),
+                              void *thunk) {
+  struct renderer r = {.sink = sink, .thunk = thunk};
+  return renderer_run(&r, s->p->width, s->p->height,
+                      large_solution_render_edges, s);
+}
+
+// Bit in the table of options indicating that a cell is part of the
+// worklist.
+#define QUEUED 0x10
+
+// Change made to the table of options that can be undone.
+struct trail_entry {
+  uint32_t index;
+  unsigned char options;
+  unsigned char padding[3];
+};
+
+// Choice made while searching that can be revisited.
+struct decision {
+  size_t trail;
+  size_t cursor;
+  uint32_t index;
+  unsigned char remaining;
+  unsigned char padding[3];
+};
+
+// State of the solver. All of it is allocated from a single arena,
+// sized for the worst case. Along a single path of the search, the
+// options of a cell can only be reduced three times, which bounds the
+// size of the trail. Only the parts of the arena that are actually
+// used are backed by physical memory.
+struct solver {
+  const struct il_large_problem *p;
+  struct arena arena;
+  unsigned char *options;
+
+  // Worklist of cells that need to be reconsidered, stored as a ring
+  // buffer. Every cell is part of the worklist at most once.
+  uint32_t *worklist;
+  size_t worklist_start;
+  size_t worklist_len;
+
+  struct trail_entry *trail;
+  size_t trail_len;
+  size_t trail_peak;
+
+  struct decision *decisions;
+  size_t decisions_len;
+  size_t decisions_peak;
+
+  // Parity constraints that solutions need to satisfy, if any.
+  const struct parity_system *parity;
+
+  unsigned long nodes;
+};
+
+// Adds a cell to the worklist if it isn't part of it already. Empty
+// cells, which includes the outer border, never need to be considered.
+static void enqueue(struct solver *s, size_t i) {
+  if (s->p->board[i] != 0 && (s->options[i] & QUEUED) == 0) {
+    s->options[i] |= QUEUED;
+    size_t end = s->worklist_start + s->worklist_len++;
+    s->worklist[end < s->p->ncells ? end : end - s->p->ncells] = (uint32_t)i;
+  }
+}
+
+// Changes the options of a cell, recording the old value on the trail
+// and adding its neighbours to the worklist.
+static void assign(struct solver *s, size_t i, unsigned char options) {
+  s->trail[s->trail_len++] = (struct trail_entry){
+      .index = (uint32_t)i, .options = s->options[i] & 0xf};
+  if (s->trail_len > s->trail_peak)
+    s->trail_peak = s->trail_len;
+  s->options[i] = (s->options[i] & QUEUED) | options;
+  for (unsigned int d = 0; d < 4; ++d)
+    enqueue(s, layout_neighbour(s->p, i, d));
+}
+
+// Performs the propagation step, processing cells on the worklist until
+// no more inference steps can be taken. When discovering a
+// contradiction, the worklist is emptied and false is returned.
+static bool propagate(struct solver *s) {
+  const unsigned char *board = s->p->board;
+  unsigned char *options = s->options;
+  bool success = true;
+  while (s->worklist_len > 0) {
+    size_t i = s->worklist[s->worklist_start];
+    if (++s->worklist_start == s->p->ncells)
+      s->worklist_start = 0;
+    --s->worklist_len;
+    options[i] &= (unsigned char)~QUEUED;
+    if (!success)
+      continue;
+
+    // Determine which edges may be present and absent.
+    size_t n[4];
+    for (unsigned int d = 0; d < 4; ++d)
+      n[d] = layout_neighbour(s->p, i, d);
+#define YES(d, idx) (fanout(board[n[d]], options[n[d]] & 0xf) & (1 << idx))
+    unsigned char may_be_set =
+        rotate2(YES(2, 0) | YES(3, 1) | YES(0, 2) | YES(1, 3));
+#undef YES
+#define NO(d, idx) \
+  (fanout(board[n[d]] ^ 0xf, options[n[d]] & 0xf) & (1 << idx))
+    unsigned char may_be_clear =
+        rotate2(NO(2, 0) | NO(3, 1) | NO(0, 2) | NO(1, 3));
+#undef NO
+
+    unsigned char old_options = options[i] & 0xf;
+    unsigned char new_options =
+        restrict_options(board[i], old_options, may_be_set, may_be_clear);
+    if (new_options != old_options) {
+      // Fail if the cell cannot be placed in any direction. Keep on
+      // draining the worklist to clear the flags of queued cells.
+      if (new_options == 0) {
+        if (success)
+          PROBE1(large__contradiction, i);
+        success = false;
+      } else
+        assign(s, i, new_options);
+    }
+  }
+  return success;
+}
+
+// Reverts all changes made to the table of options since a given
+// position in the trail.
+static void undo(struct solver *s, size_t trail) {
+  while (s->trail_len > trail) {
+    const struct trail_entry *e = &s->trail[--s->trail_len];
+    s->options[e->index] = e->options;
+  }
+}
+
+// Number of edges of which every random parity constraint used for
+// approximate counting consists. Constraints over half of all edges
+// can only force an edge once nearly all cells have been decided,
+// whereas a few edges let them prune the search early. With fewer than
+// eight edges, the constraints are no longer independent enough and
+// the estimates become biased towards too few solutions.
+#define PARITY_ROW_EDGES 8
+
+// System of parity constraints over the edges between the cells of a
+// cluster, used for approximate counting. Every constraint consists of
+// a fixed number of edges, of which an odd or even number needs to be
+// present.
+struct parity_system {
+  const uint32_t *edge_cells;
+  const unsigned char *edge_bits;
+  const uint32_t *rows;
+  const bool *odd;
+  size_t nrows;
+};
+
+// Returns whether an edge of a cell is present or absent, or -1 if the
+// cell may still be placed either way.
+static int edge_value(const struct solver *s, size_t i, unsigned char bit) {
+  unsigned char options = s->options[i] & 0xf;
+  if ((fanout(s->p->board[i], options) & bit) == 0)
+    return 0;
+  if ((fanout(s->p->board[i] ^ 0xf, options) & bit) == 0)
+    return 1;
+  return -1;
+}
+
+// Applies the parity constraints. Every constraint of which all edges
+// but one have been determined forces the remaining edge. Returns false
+// if a constraint is violated or if placing an edge leads to a
+// contradiction.
+static bool parity_propagate(struct solver *s) {
+  const struct parity_system *ps = s->parity;
+  bool made_change;
+  do {
+    made_change = false;
+    for (size_t r = 0; r < ps->nrows; ++r) {
+      const uint32_t *row = &ps->rows[r * PARITY_ROW_EDGES];
+      bool odd = ps->odd[r];
+      size_t open = 0, nopen = 0;
+      for (size_t k = 0; k < PARITY_ROW_EDGES && nopen < 2; ++k) {
+        int value =
+            edge_value(s, ps->edge_cells[row[k]], ps->edge_bits[row[k]]);
+        if (value < 0) {
+          open = row[k];
+          ++nopen;
+        } else if (value > 0) {
+          odd = !odd;
+        }
+      }
+
+      if (nopen == 0 && odd)
+        return false;
+      if (nopen == 1) {
+        // Place the cell such that the constraint is satisfied.
+        size_t i = ps->edge_cells[open];
+        unsigned char options = 0;
+        for (unsigned char o = 0x1; o <= 0x8; o <<= 1)
+          if ((s->options[i] & o) != 0 &&
+              ((rotate(s->p->board[i], o) & ps->edge_bits[open]) != 0) == odd)
+            options |= o;
+        assign(s, i, options);
+        if (!propagate(s))
+          return false;
+        made_change = true;
+      }
+    }
+  } while (made_change);
+  return true;
+}
+
+// Makes the next choice for the topmost decision. Returns false if no
+// more choices can be made.
+static bool decide(struct solver *s) {
+  struct decision *d = &s->decisions[s->decisions_len - 1];
+  while (d->remaining != 0) {
+    unsigned char option = d->remaining & (unsigned char)-d->remaining;
+    d->remaining &= (unsigned char)~option;
+    ++s->nodes;
+    assign(s, d->index, option);
+    if (propagate(s) && (s->parity == NULL || parity_propagate(s)))
+      return true;
+    undo(s, d->trail);
+  }
+  return false;
+}
+
+// Allocates all state of the solver from a single arena and computes
+// the initial table of options. Returns false if the state of the
+// solver could not be allocated.
+static bool solver_init(struct solver *s, const struct il_large_problem *p,
+                        int flags) {
+  *s = (struct solver){.p = p, .nodes = 1};
+  size_t ntrail = p->ncells * 3, ndecisions = p->ncells;
+  if (!arena_init(&s->arena,
+                  p->ncells + ARENA_ALIGN + p->ncells * sizeof(uint32_t) +
+                      ARENA_ALIGN + ntrail * sizeof(struct trail_entry) +
+                      ARENA_ALIGN + ndecisions * sizeof(struct decision),
+                  (flags & IL_LARGE_HUGE_PAGES) != 0))
+    return false;
+  s->options = arena_alloc(&s->arena, p->ncells);
+  s->worklist = arena_alloc(&s->arena, p->ncells * sizeof(uint32_t));
+  s->trail = arena_alloc(&s->arena, ntrail * sizeof(struct trail_entry));
+  s->decisions = arena_alloc(&s->arena, ndecisions * sizeof(struct decision));
+
+  // Compute the initial table of options. Propagation should consider
+  // cells in the order in which they are stored.
+  for (size_t i = 0; i < p->ncells; ++i)
+    s->options[i] = initial_option(p->board[i]);
+  for (size_t i = 0; i < p->ncells; ++i)
+    enqueue(s, i);
+  return true;
+}
+
+bool il_large_problem_solve(const struct il_large_problem *p, int flags,
+                            struct il_large_stats *stats,
+                            bool (*callback)(const struct il_large_solution *,
+                                             void *),
+                            void *thunk) {
+  struct solver s;
+  if (!solver_init(&s, p, flags))
+    return false;
+
+  PROBE2(large__solve__start, p->width, p->height);
+  size_t cursor = 0, solutions = 0;
+  bool consistent = propagate(&s);
+  while (consistent) {
+    // Find the next cell that has multiple options remaining.
+    while (cursor < p->ncells && single_bit_set(s.options[cursor]))
+      ++cursor;
+
+    if (cursor == p->ncells) {
+      // Report a solution to the caller.
+      PROBE2(large__solution, s.decisions_len, ++solutions);
+      struct il_large_solution solution = {.p = p, .options = s.options};
+      if (!callback(&solution, thunk))
+        break;
+    } else {
+      // Make a new decision.
+      s.decisions[s.decisions_len++] = (struct decision){
+          .index = (uint32_t)cursor,
+          .remaining = s.options[cursor],
+          .trail = s.trail_len,
+          .cursor = cursor,
+      };
+      if (s.decisions_len > s.decisions_peak)
+        s.decisions_peak = s.decisions_len;
+      PROBE2(large__guess, cursor, s.decisions_len);
+      if (decide(&s))
+        continue;
+      --s.decisions_len;
+    }
+
+    // Backtrack to the most recent decision that still has choices.
+    consistent = false;
+    while (s.decisions_len > 0) {
+      struct decision *d = &s.decisions[s.decisions_len - 1];
+      undo(&s, d->trail);
+      cursor = d->cursor;
+      if (decide(&s)) {
+        consistent = true;
+        break;
+      }
+      --s.decisions_len;
+    }
+  }
+
+  PROBE3(large__solve__end, solutions, s.trail_peak, s.decisions_peak);
+
+  // Only the parts of the trail and the decisions that have been used
+  // contribute to the amount of memory used.
+  if (stats != NULL) {
+    stats->peak_memory = p->ncells + p->ncells * sizeof(uint32_t) +
+                         s.trail_peak * sizeof(struct trail_entry) +
+                         s.decisions_peak * sizeof(struct decision);
+    stats->nodes = s.nodes;
+    stats->flips = 0;
+  }
+  arena_destroy(&s.arena);
+  return true;
+}
+
+bool il_large_problem_propagate(const struct il_large_problem *p, int flags,
+                                bool *consistent) {
+  struct solver s;
+  if (!solver_init(&s, p, flags))
+    return false;
+  *consistent = propagate(&s);
+  arena_destroy(&s.arena);
+  return true;
+}
+
+// Number of nodes that may be visited to count the solutions of a
+// cluster exactly, before falling back to approximating them.
+#define COUNT_EXACT_NODES (1 << 20)
+
+// Maximum number of cells of a cluster of which the solutions may be
+// counted exactly. Every level of recursion while counting places a
+// cell, so this also bounds the depth of the recursion.
+#define COUNT_EXACT_CELLS 512
+
+// Number of entries of the stack on which the components of all levels
+// of recursion are stored. A level needs two entries per cell and one
+// more, while the number of cells decreases by at least one per level.
+#define COUNT_STACK_ENTRIES (COUNT_EXACT_CELLS * (COUNT_EXACT_CELLS + 2))
+
+// Number of entries of the cache of the number of solutions of
+// components used while counting exactly.
+#define COUNT_CACHE_ENTRIES (1 << 16)
+
+// Partitions the cells that have not been placed yet into clusters of
+// neighbouring cells. Cells in different clusters are never adjacent,
+// meaning that they can be placed independently. The cells of every
+// cluster are stored consecutively, and the start of every cluster is
+// recorded. Returns the number of clusters.
+static size_t find_clusters(const struct solver *s, bool *seen,
+                            uint32_t *cells, size_t *starts) {
+  size_t nclusters = 0, ncells = 0;
+  for (size_t i = 0; i < s->p->ncells; ++i) {
+    if (!seen[i] && !single_bit_set(s->options[i])) {
+      // Flood fill a new cluster, starting at this cell.
+      starts[nclusters++] = ncells;
+      seen[i] = true;
+      cells[ncells++] = (uint32_t)i;
+      for (size_t j = starts[nclusters - 1]; j < ncells; ++j) {
+        for (unsigned int d = 0; d < 4; ++d) {
+          size_t n = layout_neighbour(s->p, cells[j], d);
+          if (!seen[n] && !single_bit_set(s->options[n])) {
+            seen[n] = true;
+            cells[ncells++] = (uint32_t)n;
+          }
+        }
+      }
+    }
+  }
+  starts[nclusters] = ncells;
+  return nclusters;
+}
+
+// Counts the solutions of a cluster, stopping once a given limit has
+// been reached. The state of the solver is restored afterwards.
+static size_t count_cluster(struct solver *s, const uint32_t *cells,
+                            size_t ncells, size_t limit) {
+  size_t trail = s->trail_len, cursor = 0, count = 0;
+  bool consistent = s->parity == NULL || parity_propagate(s);
+  while (consistent && count < limit) {
+    // Find the next cell of the cluster that has multiple options
+    // remaining.
+    while (cursor < ncells && single_bit_set(s->options[cells[cursor]]))
+      ++cursor;
+
+    if (cursor == ncells) {
+      ++count;
+    } else {
+      // Make a new decision.
+      s->decisions[s->decisions_len++] = (struct decision){
+          .index = cells[cursor],
+          .remaining = s->options[cells[cursor]],
+          .trail = s->trail_len,
+          .cursor = cursor,
+      };
+      if (s->decisions_len > s->decisions_peak)
+        s->decisions_peak = s->decisions_len;
+      if (decide(s))
+        continue;
+      --s->decisions_len;
+    }
+
+    // Backtrack to the most recent decision that still has choices.
+    consistent = false;
+    while (s->decisions_len > 0) {
+      struct decision *d = &s->decisions[s->decisions_len - 1];
+      undo(s, d->trail);
+      cursor = d->cursor;
+      if (decide(s)) {
+        consistent = true;
+        break;
+      }
+      --s->decisions_len;
+    }
+  }
+  s->decisions_len = 0;
+  undo(s, trail);
+  return count;
+}
+
+// State of counting the solutions of a cluster exactly.
+struct count_state {
+  // Direct mapped cache of the number of solutions of components.
+  struct count_entry {
+    uint64_t key;
+    double count;
+  } * cache;
+
+  // Components into which the cells fall apart at every level of
+  // recursion, followed by the start of every component.
+  uint32_t *stack;
+  size_t stack_len;
+
+  unsigned long max_nodes;
+
+  // Marks of cells that have been assigned to a component.
+  uint32_t *marks;
+  uint32_t epoch;
+  uint32_t padding;
+};
+
+// Counts the solutions of a connected component of cells that have not
+// been placed yet. After placing a cell, the remaining cells of the
+// component often fall apart into smaller components, whose numbers of
+// solutions can be multiplied. As in the transposition table of the
+// solver for struct il_problem, the number of solutions of a component
+// only depends on the options of its cells, which allows them to be
+// cached. Components may have at most COUNT_EXACT_CELLS cells. Returns
+// a negative number if too many nodes are visited.
+static double count_component(struct solver *s, struct count_state *c,
+                              const uint32_t *cells, size_t ncells) {
+  uint64_t key = 0;
+  for (size_t j = 0; j < ncells; ++j) {
+    uint64_t h = (uint64_t)cells[j] << 4 | s->options[cells[j]];
+    h *= 0x9e3779b97f4a7c15;
+    key += h ^ h >> 29;
+  }
+  key |= 1;
+  struct count_entry *e = &c->cache[key % COUNT_CACHE_ENTRIES];
+  if (e->key == key)
+    return e->count;
+
+  uint32_t *sub = &c->stack[c->stack_len], *starts = sub + ncells;
+  c->stack_len += 2 * ncells + 1;
+
+  // Place the cell in the middle of the component, as the cells are
+  // stored in the order of a flood fill. This tends to split the
+  // component into parts of similar size.
+  size_t i = cells[ncells / 2], trail = s->trail_len;
+  unsigned char remaining = s->options[i];
+  double total = 0.0;
+  while (remaining != 0 && total >= 0.0) {
+    unsigned char option = remaining & (unsigned char)-remaining;
+    remaining &= (unsigned char)~option;
+    if (++s->nodes > c->max_nodes) {
+      total = -1.0;
+      break;
+    }
+    assign(s, i, option);
+    if (propagate(s)) {
+      // Split up the remaining cells into components.
+      ++c->epoch;
+      size_t nsub = 0, nsubcells = 0;
+      for (size_t j = 0; j < ncells; ++j) {
+        if (c->marks[cells[j]] != c->epoch &&
+            !single_bit_set(s->options[cells[j]])) {
+          starts[nsub++] = (uint32_t)nsubcells;
+          c->marks[cells[j]] = c->epoch;
+          sub[nsubcells++] = cells[j];
+          for (size_t k = starts[nsub - 1]; k < nsubcells; ++k) {
+            for (unsigned int d = 0; d < 4; ++d) {
+              size_t n = layout_neighbour(s->p, sub[k], d);
+              if (c->marks[n] != c->epoch && !single_bit_set(s->options[n])) {
+                c->marks[n] = c->epoch;
+                sub[nsubcells++] = (uint32_t)n;
+              }
+            }
+          }
+        }
+      }
+      starts[nsub] = (uint32_t)nsubcells;
+
+      double product = 1.0;
+      for (size_t k = 0; k < nsub && product > 0.0; ++k) {
+        double count = count_component(s, c, &sub[starts[k]],
+                                       starts[k + 1] - starts[k]);
+        product = count < 0.0 ? -1.0 : product * count;
+      }
+      total = product < 0.0 ? -1.0 : total + product;
+    }
+    undo(s, trail);
+  }
+  c->stack_len -= 2 * ncells + 1;
+  if (total >= 0.0) {
+    e->key = key;
+    e->count = total;
+  }
+  return total;
+}
+
+static int compare_doubles(const void *a, const void *b) {
+  double da = *(const double *)a, db = *(const double *)b;
+  return da < db ? -1 : da > db;
+}
+
+// Approximates the binary logarithm of the number of solutions of a
+// cluster, using the hashing based algorithm of ApproxMC.
+//
+// Clusters having fewer than a threshold number of solutions are
+// counted exactly. For other clusters, every iteration adds random
+// parity constraints over the edges of the cluster until fewer than the
+// threshold number of solutions remain. As every constraint is
+// satisfied by half of the solutions in expectation, multiplying the
+// number of remaining solutions by two to the power of the number of
+// constraints yields an estimate. The median of the estimates of all
+// iterations is returned.
+//
+// Unlike ApproxMC, every constraint only consists of PARITY_ROW_EDGES
+// random edges. The guarantees of ApproxMC rely on constraints over
+// half of all edges, which make the search visit nearly all cells
+// before pruning and take minutes on boards of a thousand cells.
+static bool approximate_cluster(struct solver *s, const uint32_t *cells,
+                                size_t ncells, double epsilon, double delta,
+                                double *log2_count) {
+  // Number of solutions that may remain and the number of iterations
+  // needed to provide the requested guarantees.
+  size_t threshold =
+      (size_t)(1.0 + 9.84 * (1.0 + epsilon / (1.0 + epsilon)) *
+                         (1.0 + 1.0 / epsilon) * (1.0 + 1.0 / epsilon));
+  size_t iterations = (size_t)ceil(17.0 * log2(3.0 / delta));
+  size_t count = count_cluster(s, cells, ncells, threshold);
+  if (count < threshold) {
+    *log2_count = count == 0 ? -(double)INFINITY : log2((double)count);
+    return true;
+  }
+
+  // Collect the edges between cells of the cluster that have not been
+  // determined yet. Placing these edges places all cells.
+  uint32_t *edge_cells = malloc(ncells * 2 * sizeof(uint32_t));
+  unsigned char *edge_bits = malloc(ncells * 2);
+  double *estimates = malloc(iterations * sizeof(double));
+  size_t nedges = 0;
+  if (edge_cells != NULL && edge_bits != NULL) {
+    for (size_t j = 0; j < ncells; ++j) {
+      for (unsigned int d = 1; d <= 2; ++d) {
+        unsigned char bit = (unsigned char)(1 << d);
+        if (!single_bit_set(s->options[layout_neighbour(s->p, cells[j], d)]) &&
+            edge_value(s, cells[j], bit) < 0) {
+          edge_cells[nedges] = cells[j];
+          edge_bits[nedges++] = bit;
+        }
+      }
+    }
+  }
+
+  // Constraints are generated as needed. Cells are decided in an order
+  // that starts with the cells of the edges of the constraints, so that
+  // constraints apply as early as possible.
+  uint32_t *rows = malloc(nedges * PARITY_ROW_EDGES * sizeof(uint32_t) + 1);
+  bool *odd = malloc(nedges * sizeof(bool) + 1);
+  uint32_t *order = malloc(ncells * sizeof(uint32_t));
+  bool *ordered = calloc(s->p->ncells, sizeof(bool));
+  bool success = edge_cells != NULL && edge_bits != NULL &&
+                 estimates != NULL && rows != NULL && odd != NULL &&
+                 order != NULL && ordered != NULL;
+  size_t previous = 1;
+  for (size_t i = 0; i < iterations && success; ++i) {
+    size_t ngenerated = 0;
+    // Find the smallest number of constraints for which fewer solutions
+    // than the threshold remain, knowing that at least the threshold
+    // number of solutions remain without any constraints. As adding
+    // constraints only removes solutions, this can be done by a binary
+    // search. The number found by the previous iteration is likely to
+    // be close, so start there and at its neighbours, before doubling
+    // the number of constraints or bisecting.
+    size_t lo = 0, hi = 0, m = previous;
+    bool found = false;
+    for (size_t probe = 0;; ++probe) {
+      for (; ngenerated < m; ++ngenerated) {
+        uint32_t *row = &rows[ngenerated * PARITY_ROW_EDGES];
+        for (size_t k = 0; k < PARITY_ROW_EDGES; ++k) {
+          // Pick distinct edges, unless there are too few of them.
+          size_t j;
+          do {
+            row[k] = arc4random_uniform((uint32_t)nedges);
+            for (j = 0; j < k && row[j] != row[k]; ++j)
+              continue;
+          } while (j < k && nedges >= PARITY_ROW_EDGES);
+        }
+        odd[ngenerated] = (arc4random() & 1) != 0;
+      }
+      size_t norder = 0;
+      for (size_t k = 0; k < m * PARITY_ROW_EDGES; ++k) {
+        uint32_t cell = edge_cells[rows[k]];
+        if (!ordered[cell]) {
+          ordered[cell] = true;
+          order[norder++] = cell;
+        }
+      }
+      for (size_t j = 0; j < ncells; ++j)
+        if (!ordered[cells[j]])
+          order[norder++] = cells[j];
+      for (size_t j = 0; j < ncells; ++j)
+        ordered[cells[j]] = false;
+
+      struct parity_system ps = {
+          .edge_cells = edge_cells,
+          .edge_bits = edge_bits,
+          .rows = rows,
+          .odd = odd,
+          .nrows = m,
+      };
+      s->parity = &ps;
+      size_t c = count_cluster(s, order, ncells, threshold);
+      s->parity = NULL;
+
+      if (c < threshold || m == nedges) {
+        // All constraints being in use without reaching the threshold
+        // can only happen if they are linearly dependent.
+        hi = m;
+        count = c;
+        found = true;
+      } else {
+        lo = m;
+      }
+      if (found && hi - lo <= 1)
+        break;
+      if (!found)
+        m = probe == 0 ? m + 1 : 2 * m < nedges ? 2 * m : nedges;
+      else if (probe == 0)
+        m = hi - 1;
+      else
+        m = lo + (hi - lo) / 2;
+    }
+    previous = hi;
+    estimates[i] =
+        count == 0 ? -(double)INFINITY : log2((double)count) + (double)hi;
+  }
+  if (success) {
+    qsort(estimates, iterations, sizeof(double), compare_doubles);
+    *log2_count = estimates[iterations / 2];
+  }
+  free(edge_cells);
+  free(edge_bits);
+  free(estimates);
+  free(rows);
+  free(odd);
+  free(order);
+  free(ordered);
+  return success;
+}
+
+bool il_large_problem_count_approx(const struct il_large_problem *p,
+                                   double epsilon, double delta, int flags,
+                                   double *log2_count) {
+  struct solver s;
+  if (!solver_init(&s, p, flags))
+    return false;
+  if (!propagate(&s)) {
+    *log2_count = -(double)INFINITY;
+    arena_destroy(&s.arena);
+    return true;
+  }
+
+  // Split up the board into clusters that can be counted independently.
+  bool *seen = calloc(p->ncells, sizeof(bool));
+  uint32_t *cells = malloc(p->ncells * sizeof(uint32_t));
+  size_t *starts = malloc((p->ncells + 1) * sizeof(size_t));
+  size_t *large = malloc(p->ncells * sizeof(size_t));
+  struct count_state c = {
+      .cache = calloc(COUNT_CACHE_ENTRIES, sizeof(struct count_entry)),
+      .stack = malloc(COUNT_STACK_ENTRIES * sizeof(uint32_t)),
+      .marks = calloc(p->ncells, sizeof(uint32_t)),
+  };
+  bool success = seen != NULL && cells != NULL && starts != NULL &&
+                 large != NULL && c.cache != NULL && c.stack != NULL &&
+                 c.marks != NULL;
+  *log2_count = 0.0;
+  size_t nlarge = 0;
+  if (success && (flags & IL_LARGE_NO_EXACT_COUNT) != 0) {
+    // Approximate all cells that have not been placed yet as if they
+    // were a single cluster.
+    size_t ncells = 0;
+    for (size_t i = 0; i < p->ncells; ++i)
+      if (!single_bit_set(s.options[i]))
+        cells[ncells++] = (uint32_t)i;
+    starts[0] = 0;
+    starts[1] = ncells;
+    large[0] = 0;
+    nlarge = ncells > 0 ? 1 : 0;
+  } else if (success) {
+    // Count the solutions of clusters exactly if this can be done
+    // quickly, so that only the remaining clusters contribute to the
+    // error of the estimate.
+    size_t nclusters = find_clusters(&s, seen, cells, starts);
+    for (size_t k = 0; k < nclusters; ++k) {
+      c.max_nodes = s.nodes + COUNT_EXACT_NODES;
+      size_t ncells = starts[k + 1] - starts[k];
+      double count = ncells <= COUNT_EXACT_CELLS
+                         ? count_component(&s, &c, &cells[starts[k]], ncells)
+                         : -1.0;
+      if (count < 0.0) {
+        large[nlarge++] = k;
+      } else if (count < 1.0) {
+        *log2_count = -(double)INFINITY;
+        nlarge = 0;
+        break;
+      } else {
+        *log2_count += log2(count);
+      }
+    }
+  }
+
+  // Approximate the large clusters, dividing the tolerance and the
+  // probability of failure evenly over them.
+  for (size_t k = 0; k < nlarge && success; ++k) {
+    double cluster_epsilon = pow(1.0 + epsilon, 1.0 / (double)nlarge) - 1.0;
+    double cluster_delta = delta / (double)nlarge;
+    double log2_cluster = 0.0;
+    success = approximate_cluster(
+        &s, &cells[starts[large[k]]], starts[large[k] + 1] - starts[large[k]],
+        cluster_epsilon, cluster_delta, &log2_cluster);
+    *log2_count += log2_cluster;
+  }
+  free(seen);
+  free(cells);
+  free(starts);
+  free(large);
+  free(c.cache);
+  free(c.stack);
+  free(c.marks);
+  arena_destroy(&s.arena);
+  return success;
+}
+
+// Number of flips after which local search is considered to have
+// stalled if it has not found a better placement, per undecided cell.
+#define LOCAL_STALL_FLIPS 64
+
+// Number of flips during which a cell may not be flipped back, unless
+// doing so yields a better placement than found so far.
+#define LOCAL_TABU_TENURE 8
+
+// Probability, in percent, of flipping a random cell adjacent to a
+// mismatched edge instead of the one that reduces the number of
+// mismatched edges most.
+#define LOCAL_NOISE 20
+
+// State of local search. Every cell is placed in one of its options,
+// and the edges at which neighbouring cells disagree are kept in a set.
+// The edges of a cell are numbered twice its index for the east edge
+// and one more for the south edge.
+struct local_search {
+  const struct il_large_problem *p;
+  const unsigned char *options;
+  unsigned char *placement;
+  uint32_t *mismatched;
+  size_t nmismatched;
+  uint32_t *position;
+  unsigned long *flipped;
+  uint64_t random;
+};
+
+// Returns a random number below a given bound. Local search makes
+// several random choices per flip, for which arc4random() is too slow.
+static uint32_t local_random(struct local_search *l, uint32_t bound) {
+  l->random ^= l->random << 13;
+  l->random ^= l->random >> 7;
+  l->random ^= l->random << 17;
+  return (uint32_t)(((l->random >> 32) * bound) >> 32);
+}
+
+// Returns the number of the edge of a cell in a given direction.
+static size_t local_edge(const struct il_large_problem *p, size_t i,
+                         unsigned int d) {
+  switch (d) {
+    case 0:
+      return layout_neighbour(p, i, 0) * 2 + 1;
+    case 1:
+      return i * 2;
+    case 2:
+      return i * 2 + 1;
+    default:
+      return layout_neighbour(p, i, 3) * 2;
+  }
+}
+
+// Returns whether a cell and its neighbour in a given direction
+// disagree on the edge between them, if the cell were placed under a
+// given option.
+static bool local_mismatch(const struct local_search *l, size_t i,
+                           unsigned char option, unsigned int d) {
+  size_t n = layout_neighbour(l->p, i, d);
+  return ((rotate(l->p->board[i], option) >> d) & 0x1) !=
+         ((rotate(l->p->board[n], l->placement[n]) >> ((d + 2) & 0x3)) & 0x1);
+}
+
+// Returns the change in the number of mismatched edges if a cell were
+// placed under a given option.
+static int local_delta(const struct local_search *l, size_t i,
+                       unsigned char option) {
+  int delta = 0;
+  for (unsigned int d = 0; d < 4; ++d)
+    delta += (int)local_mismatch(l, i, option, d) -
+             (int)local_mismatch(l, i, l->placement[i], d);
+  return delta;
+}
+
+// Places a cell under a given option, updating the set of mismatched
+// edges.
+static void local_place(struct local_search *l, size_t i,
+                        unsigned char option) {
+  l->placement[i] = option;
+  for (unsigned int d = 0; d < 4; ++d) {
+    size_t e = local_edge(l->p, i, d);
+    bool mismatch = local_mismatch(l, i, option, d);
+    if (mismatch && l->position[e] == UINT32_MAX) {
+      l->position[e] = (uint32_t)l->nmismatched;
+      l->mismatched[l->nmismatched++] = (uint32_t)e;
+    } else if (!mismatch && l->position[e] != UINT32_MAX) {
+      uint32_t last = l->mismatched[--l->nmismatched];
+      l->mismatched[l->position[e]] = last;
+      l->position[last] = l->position[e];
+      l->position[e] = UINT32_MAX;
+    }
+  }
+}
+
+// Callback for il_large_problem_solve_local() that stops the complete
+// search after the first solution.
+struct local_fallback {
+  bool (*callback)(const struct il_large_solution *, void *);
+  void *thunk;
+};
+
+static bool local_fallback_callback(const struct il_large_solution *s,
+                                    void *thunk) {
+  struct local_fallback *f = thunk;
+  f->callback(s, f->thunk);
+  return false;
+}
+
+bool il_large_problem_solve_local(
+    const struct il_large_problem *p, int flags, struct il_large_stats *stats,
+    bool (*callback)(const struct il_large_solution *, void *), void *thunk) {
+  // Place all cells that can be placed through inference first, so that
+  // local search only needs to consider the remaining ones. Puzzles for
+  // which this leads to a contradiction are left to complete search.
+  struct solver s;
+  if (!solver_init(&s, p, flags))
+    return false;
+  bool consistent = propagate(&s);
+
+  struct local_search l = {
+      .p = p,
+      .options = s.options,
+      .placement = malloc(p->ncells),
+      .mismatched = malloc(p->ncells * 2 * sizeof(uint32_t)),
+      .nmismatched = 0,
+      .position = malloc(p->ncells * 2 * sizeof(uint32_t)),
+      .flipped = calloc(p->ncells, sizeof(unsigned long)),
+      .random = (uint64_t)arc4random() << 32 | arc4random() | 1,
+  };
+  uint32_t *cells = malloc(p->ncells * sizeof(uint32_t));
+  bool success = l.placement != NULL && l.mismatched != NULL &&
+                 l.position != NULL && l.flipped != NULL && cells != NULL;
+  bool found = false;
+  unsigned long flips = 0;
+  if (success && consistent) {
+    // Place the remaining cells at random.
+    size_t ncells = 0;
+    for (size_t i = 0; i < p->ncells; ++i) {
+      l.placement[i] = s.options[i];
+      if (!single_bit_set(s.options[i])) {
+        cells[ncells++] = (uint32_t)i;
+        do {
+          l.placement[i] = (unsigned char)(1 << local_random(&l, 4));
+        } while ((s.options[i] & l.placement[i]) == 0);
+      }
+    }
+    memset(l.position, 0xff, p->ncells * 2 * sizeof(uint32_t));
+    for (size_t j = 0; j < ncells; ++j)
+      local_place(&l, cells[j], l.placement[cells[j]]);
+
+    // Repeatedly pick a random mismatched edge and flip one of its
+    // cells, until all edges match or no progress is made.
+    size_t best = l.nmismatched;
+    unsigned long improved = 0;
+    while (l.nmismatched > 0 &&
+           flips - improved < LOCAL_STALL_FLIPS * (unsigned long)ncells) {
+      size_t e = l.mismatched[local_random(&l, (uint32_t)l.nmismatched)];
+      size_t ends[2] = {e / 2, layout_neighbour(p, e / 2, (e & 0x1) + 1)};
+
+      // Determine the candidate flips. Cells that have been placed
+      // through inference never disagree with each other.
+      size_t candidates = 0, choice = SIZE_MAX, pick = 0;
+      int best_delta = INT_MAX;
+      bool noise = local_random(&l, 100) < LOCAL_NOISE;
+      for (size_t k = 0; k < 2; ++k) {
+        size_t i = ends[k];
+        for (unsigned char o = 0x1; o <= 0x8; o <<= 1) {
+          if ((s.options[i] & o) == 0 || o == l.placement[i])
+            continue;
+          size_t candidate = i * 16 + o;
+          if (noise) {
+            // Reservoir sampling of a random candidate.
+            if (local_random(&l, (uint32_t)++candidates) == 0)
+              choice = candidate;
+            continue;
+          }
+          int delta = local_delta(&l, i, o);
+          bool tabu = l.flipped[i] != 0 &&
+                      flips - l.flipped[i] < LOCAL_TABU_TENURE &&
+                      (size_t)((int)l.nmismatched + delta) >= best;
+          if (!tabu && (delta < best_delta ||
+                        (delta == best_delta &&
+                         local_random(&l, (uint32_t)++pick + 1) == 0))) {
+            if (delta < best_delta)
+              pick = 0;
+            best_delta = delta;
+            choice = candidate;
+          }
+        }
+      }
+      if (choice == SIZE_MAX)
+        continue;
+
+      ++flips;
+      l.flipped[choice / 16] = flips;
+      local_place(&l, choice / 16, (unsigned char)(choice % 16));
+      if (l.nmismatched < best) {
+        best = l.nmismatched;
+        improved = flips;
+      }
+    }
+
+    if (l.nmismatched == 0) {
+      struct il_large_solution solution = {.p = p, .options = l.placement};
+      callback(&solution, thunk);
+      found = true;
+    }
+  }
+  free(l.placement);
+  free(l.mismatched);
+  free(l.position);
+  free(l.flipped);
+  free(cells);
+  arena_destroy(&s.arena);
+
+  // Fall back to complete search if local search stalled.
+  if (success && !found) {
+    struct local_fallback f = {.callback = callback, .thunk = thunk};
+    success = il_large_problem_solve(p, flags, stats, local_fallback_callback,
+                                     &f);
+  } else if (success && stats != NULL) {
+    stats->peak_memory = p->ncells + p->ncells * sizeof(uint32_t) +
+                         s.trail_peak * sizeof(struct trail_entry) +
+                         p->ncells + p->ncells * 4 * sizeof(uint32_t) +
+                         p->ncells * sizeof(unsigned long) +
+                         p->ncells * sizeof(uint32_t);
+    stats->nodes = 0;
+  }
+  if (success && stats != NULL)
+    stats->flips = flips;
+  return success;
+}
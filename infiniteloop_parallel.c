@@ -0,0 +1,948 @@
+// Copyright (c) 2016 Ed Schouten <ed@nuxi.nl>
+//
+// This file is distributed under a 2-clause BSD license.
+// See the LICENSE file for details.
+
+// Solvers that make use of multiple threads.
+//
+// A single puzzle is solved in parallel by giving every thread its own
+// incremental solver. Threads that run out of work wait until another
+// thread hands over part of its search tree. Threads run their solver
+// for a short slice at a time, after which they check whether any
+// threads are waiting. If so, they split off the unvisited part of
+// their search tree closest to the root themselves. Optionally, all
+// solvers share a transposition table, so that threads do not need to
+// search parts of the search tree already visited by other threads.
+//
+// As every split hands over the children of a node that come after the
+// ones still being visited, every solver covers a contiguous range of
+// the search tree in depth-first order. To report solutions in that
+// order, every solver is given a segment in a list of ranges. Solutions
+// of the first segment are reported right away, while the others are
+// buffered until all segments preceding them have finished.
+//
+// Batches of puzzles are solved by giving every thread a range of
+// puzzles. Threads that run out of work steal half of the remaining
+// range of another thread. On NUMA systems, threads on the same node
+// may share a range instead, whose puzzles are stored in memory local
+// to the node.
+
+#define _GNU_SOURCE
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <sys/mman.h>
+
+#include "infiniteloop.h"
+#include "infiniteloop_impl.h"
+
+// Number of nodes of the search tree visited by a thread before it
+// checks whether the search has been stopped and whether other threads
+// are waiting for work.
+#define PARALLEL_SLICE 64
+
+// Size in bytes of the transposition table shared by the threads when
+// IL_PARALLEL_TRANSPOSITIONS is provided.
+#define PARALLEL_TABLE_SIZE (64 << 20)
+
+// Number of solutions that may be buffered when IL_PARALLEL_ORDERED is
+// provided, before threads ahead of the first segment need to wait.
+#define PARALLEL_ORDERED_BUFFER 256
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+#ifdef __linux__
+
+// Returns the n-th CPU in a set, wrapping around.
+static size_t cpu_nth(const cpu_set_t *set, size_t n) {
+  n %= (size_t)CPU_COUNT(set);
+  for (size_t cpu = 0;; ++cpu)
+    if (CPU_ISSET(cpu, set) && n-- == 0)
+      return cpu;
+}
+
+// Returns the n-th CPU on which the process is allowed to run, wrapping
+// around.
+static bool allowed_cpu(size_t n, size_t *cpu) {
+  cpu_set_t allowed;
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0 ||
+      CPU_COUNT(&allowed) == 0)
+    return false;
+  *cpu = cpu_nth(&allowed, n);
+  return true;
+}
+
+static void pin_thread(size_t cpu) {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+// NUMA topology of the system, restricted to the CPUs on which the
+// process is allowed to run. Nodes without any of these CPUs are left
+// out.
+#define MAX_NODES 64
+
+struct topology {
+  size_t nnodes;
+  cpu_set_t cpus[MAX_NODES];
+  unsigned int distance[MAX_NODES][MAX_NODES];
+};
+
+// Parses a list of CPUs as used by sysfs, such as "0-3,8-11".
+static void parse_cpulist(const char *list, cpu_set_t *set) {
+  CPU_ZERO(set);
+  while (*list >= '0' && *list <= '9') {
+    char *end;
+    unsigned long first = strtoul(list, &end, 10), last = first;
+    if (*end == '-')
+      last = strtoul(end + 1, &end, 10);
+    for (unsigned long cpu = first; cpu <= last && cpu < CPU_SETSIZE; ++cpu)
+      CPU_SET(cpu, set);
+    list = *end == ',' ? end + 1 : end;
+  }
+}
+
+// Discovers the NUMA topology through sysfs. If unavailable, all CPUs
+// are considered to be part of a single node. If a number of fake
+// nodes is provided, that many nodes spanning all CPUs are simulated
+// instead.
+static void topology_discover(struct topology *t, size_t nfake) {
+  cpu_set_t allowed;
+  if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+    CPU_ZERO(&allowed);
+    CPU_SET(0, &allowed);
+  }
+
+  if (nfake > 0) {
+    t->nnodes = nfake < MAX_NODES ? nfake : MAX_NODES;
+    for (size_t i = 0; i < t->nnodes; ++i) {
+      t->cpus[i] = allowed;
+      for (size_t j = 0; j < t->nnodes; ++j)
+        t->distance[i][j] = i == j ? 10 : 20;
+    }
+    return;
+  }
+
+  t->nnodes = 0;
+  unsigned int ids[MAX_NODES];
+  for (unsigned int id = 0; id < 1024 && t->nnodes < MAX_NODES; ++id) {
+    char path[64], buf[4096];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist",
+             id);
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+      continue;
+    size_t len = fread(buf, 1, sizeof(buf) - 1, f);
+    fclose(f);
+    buf[len] = '\0';
+    cpu_set_t *cpus = &t->cpus[t->nnodes];
+    parse_cpulist(buf, cpus);
+    CPU_AND(cpus, cpus, &allowed);
+    if (CPU_COUNT(cpus) > 0)
+      ids[t->nnodes++] = id;
+  }
+  if (t->nnodes == 0) {
+    t->nnodes = 1;
+    t->cpus[0] = allowed;
+    t->distance[0][0] = 10;
+    return;
+  }
+
+  // Read the distances between nodes, which are used to prefer stealing
+  // work from nearby nodes.
+  for (size_t i = 0; i < t->nnodes; ++i) {
+    for (size_t j = 0; j < t->nnodes; ++j)
+      t->distance[i][j] = i == j ? 10 : 20;
+    char path[64];
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/distance",
+             ids[i]);
+    FILE *f = fopen(path, "r");
+    if (f == NULL)
+      continue;
+    unsigned int distance[1024];
+    size_t n = 0;
+    while (n < 1024 && fscanf(f, "%u", &distance[n]) == 1)
+      ++n;
+    fclose(f);
+    for (size_t j = 0; j < t->nnodes; ++j)
+      if (ids[j] < n)
+        t->distance[i][j] = distance[ids[j]];
+  }
+}
+
+// Returns the n-th CPU of a NUMA node, wrapping around.
+static bool topology_cpu(const struct topology *t, size_t node, size_t n,
+                         size_t *cpu) {
+  *cpu = cpu_nth(&t->cpus[node], n);
+  return true;
+}
+
+#else
+
+// Threads can only be pinned on Linux. Other systems are considered to
+// consist of a single NUMA node.
+#define MAX_NODES 1
+
+struct topology {
+  size_t nnodes;
+  unsigned int distance[MAX_NODES][MAX_NODES];
+};
+
+static void topology_discover(struct topology *t, size_t nfake) {
+  t->nnodes = 1;
+  t->distance[0][0] = 10;
+}
+
+static bool allowed_cpu(size_t n, size_t *cpu) {
+  return false;
+}
+
+static bool topology_cpu(const struct topology *t, size_t node, size_t n,
+                         size_t *cpu) {
+  return false;
+}
+
+static void pin_thread(size_t cpu) {}
+
+#endif
+
+struct search;
+
+// Solution found ahead of time with IL_PARALLEL_ORDERED.
+struct buffered_solution {
+  struct buffered_solution *next;
+  struct il_solution solution;
+  unsigned char padding[4];
+};
+
+// Range of the search tree in depth-first order, covered by a single
+// solver with IL_PARALLEL_ORDERED. Segments of solvers that finished
+// without buffering any solutions are removed right away.
+struct search_segment {
+  struct search_segment *prev;
+  struct search_segment *next;
+  struct buffered_solution *first;
+  struct buffered_solution **last;
+  bool done;
+  unsigned char padding[7];
+};
+
+struct search_worker {
+  struct search *search;
+  size_t index;
+  pthread_t thread;
+
+  // Solver owned by this thread, or NULL if the thread is idle, and its
+  // segment when IL_PARALLEL_ORDERED is provided. Idle threads allocate
+  // the segment for the work handed over to them up front. Protected by
+  // the idle lock while the thread is idle.
+  struct il_solver *solver;
+  struct search_segment *segment;
+
+  // Next thread in the list of idle threads.
+  struct search_worker *next_idle;
+
+  unsigned long steals;
+  double idle;
+  unsigned long table_hits;
+  double solutions;
+};
+
+struct search {
+  struct il_table *table;
+  bool (*callback)(const struct il_solution *, void *);
+  void *thunk;
+  pthread_mutex_t callback_lock;
+
+  // List of segments with IL_PARALLEL_ORDERED, starting with the one
+  // whose solutions are reported right away, and unused buffers for
+  // solutions of the others. Protected by the callback lock.
+  struct search_segment *order;
+  struct buffered_solution *buffers;
+  struct buffered_solution *free_buffers;
+  pthread_cond_t order_cond;
+
+  size_t nworkers;
+  struct search_worker *workers;
+
+  // Number of threads owning a solver. The search has completed when
+  // this drops to zero, as idle threads can no longer obtain work.
+  size_t active;
+
+  // Threads waiting for work to be handed over to them, and their
+  // number, which threads owning a solver check after every slice.
+  // Protected by the idle lock.
+  pthread_mutex_t idle_lock;
+  pthread_cond_t idle_cond;
+  struct search_worker *idle;
+  size_t nidle;
+
+  int flags;
+  bool ordered;
+  bool stopped;
+  unsigned char padding[2];
+};
+
+// Serializes invocations of the callback, stopping the search as soon
+// as the callback returns false.
+static bool search_callback(const struct il_solution *s, void *thunk) {
+  struct search *x = thunk;
+  pthread_mutex_lock(&x->callback_lock);
+  bool proceed = !__atomic_load_n(&x->stopped, __ATOMIC_RELAXED) &&
+                 x->callback(s, x->thunk);
+  if (!proceed)
+    __atomic_store_n(&x->stopped, true, __ATOMIC_RELAXED);
+  pthread_mutex_unlock(&x->callback_lock);
+  return proceed;
+}
+
+// Worker running on the current thread. Used to determine the segment
+// to which solutions belong with IL_PARALLEL_ORDERED, as solvers split
+// off from another share the same callback and argument.
+static _Thread_local struct search_worker *current_worker;
+
+// Stops the search, waking up threads waiting for their solutions to be
+// buffered. Needs to be called with the callback lock held.
+static void search_stop(struct search *x) {
+  __atomic_store_n(&x->stopped, true, __ATOMIC_RELAXED);
+  if (x->ordered)
+    pthread_cond_broadcast(&x->order_cond);
+}
+
+// Reports solutions in the same order as a single thread would, by
+// buffering solutions of all but the first segment. Threads wait for
+// their segment to become the first one if no buffers are available.
+static bool search_ordered_callback(const struct il_solution *s,
+                                    void *thunk) {
+  struct search *x = thunk;
+  struct search_segment *segment = current_worker->segment;
+  pthread_mutex_lock(&x->callback_lock);
+  for (;;) {
+    if (__atomic_load_n(&x->stopped, __ATOMIC_RELAXED)) {
+      pthread_mutex_unlock(&x->callback_lock);
+      return false;
+    }
+    if (segment == x->order) {
+      bool proceed = x->callback(s, x->thunk);
+      if (!proceed)
+        search_stop(x);
+      pthread_mutex_unlock(&x->callback_lock);
+      return proceed;
+    }
+    struct buffered_solution *b = x->free_buffers;
+    if (b != NULL) {
+      x->free_buffers = b->next;
+      b->solution = *s;
+      b->next = NULL;
+      *segment->last = b;
+      segment->last = &b->next;
+      pthread_mutex_unlock(&x->callback_lock);
+      return true;
+    }
+    pthread_cond_wait(&x->order_cond, &x->callback_lock);
+  }
+}
+
+// Marks the segment of a solver that has finished as done. Solutions
+// of segments that have become the first are reported, after which
+// they are removed once done as well.
+static void search_segment_done(struct search *x,
+                                struct search_segment *segment) {
+  pthread_mutex_lock(&x->callback_lock);
+  segment->done = true;
+  if (segment != x->order && segment->first == NULL) {
+    segment->prev->next = segment->next;
+    if (segment->next != NULL)
+      segment->next->prev = segment->prev;
+    free(segment);
+  }
+  while (x->order != NULL && x->order->done) {
+    struct search_segment *first = x->order;
+    x->order = first->next;
+    free(first);
+    if (x->order == NULL)
+      break;
+    x->order->prev = NULL;
+    struct buffered_solution *b;
+    while ((b = x->order->first) != NULL) {
+      if (!__atomic_load_n(&x->stopped, __ATOMIC_RELAXED) &&
+          !x->callback(&b->solution, x->thunk))
+        search_stop(x);
+      x->order->first = b->next;
+      b->next = x->free_buffers;
+      x->free_buffers = b;
+    }
+    x->order->last = &x->order->first;
+  }
+  pthread_cond_broadcast(&x->order_cond);
+  pthread_mutex_unlock(&x->callback_lock);
+}
+
+// Hands over part of the search tree of a thread to an idle thread,
+// by splitting off the unvisited part closest to the root. With
+// IL_PARALLEL_ORDERED, the part that is split off directly follows the
+// part that remains.
+static void search_handoff(struct search_worker *w) {
+  struct search *x = w->search;
+  pthread_mutex_lock(&x->idle_lock);
+  struct search_worker *v = x->idle;
+  struct il_solver *s = v != NULL ? il_solver_split(w->solver) : NULL;
+  if (s != NULL) {
+    x->idle = v->next_idle;
+    __atomic_sub_fetch(&x->nidle, 1, __ATOMIC_RELAXED);
+
+    // Account for the new solver while this thread cannot finish yet,
+    // so that the number of active threads never drops to zero
+    // prematurely.
+    __atomic_add_fetch(&x->active, 1, __ATOMIC_ACQ_REL);
+    if (x->ordered) {
+      struct search_segment *n = v->segment;
+      pthread_mutex_lock(&x->callback_lock);
+      *n = (struct search_segment){.prev = w->segment,
+                                   .next = w->segment->next,
+                                   .first = NULL,
+                                   .last = &n->first,
+                                   .done = false};
+      if (n->next != NULL)
+        n->next->prev = n;
+      w->segment->next = n;
+      pthread_mutex_unlock(&x->callback_lock);
+    }
+    v->solver = s;
+    pthread_cond_broadcast(&x->idle_cond);
+  }
+  pthread_mutex_unlock(&x->idle_lock);
+}
+
+static void *search_worker(void *arg) {
+  struct search_worker *w = arg;
+  struct search *x = w->search;
+  size_t cpu;
+  if ((x->flags & IL_PARALLEL_PIN_THREADS) != 0 && allowed_cpu(w->index, &cpu))
+    pin_thread(cpu);
+  current_worker = w;
+
+  for (;;) {
+    // Run the solver owned by this thread for a single slice.
+    struct il_solver *s = w->solver;
+    if (s != NULL) {
+      if (il_solver_run(s, PARALLEL_SLICE) ||
+          __atomic_load_n(&x->stopped, __ATOMIC_RELAXED)) {
+        struct il_solver_stats stats;
+        il_solver_get_stats(s, &stats);
+        w->table_hits += stats.table_hits;
+        w->solutions += stats.solutions;
+        il_solver_destroy(s);
+        w->solver = NULL;
+        if (x->ordered) {
+          search_segment_done(x, w->segment);
+          w->segment = NULL;
+        }
+
+        // Let idle threads terminate once all work has been done.
+        if (__atomic_sub_fetch(&x->active, 1, __ATOMIC_ACQ_REL) == 0) {
+          pthread_mutex_lock(&x->idle_lock);
+          pthread_cond_broadcast(&x->idle_cond);
+          pthread_mutex_unlock(&x->idle_lock);
+        }
+      } else if (__atomic_load_n(&x->nidle, __ATOMIC_RELAXED) > 0) {
+        search_handoff(w);
+      }
+      continue;
+    }
+
+    // Out of work. Wait for another thread to hand over work until all
+    // of them have finished. With IL_PARALLEL_ORDERED, the segment for
+    // the work handed over is allocated up front. Threads that cannot
+    // allocate one only wait for the others to finish.
+    double start = now();
+    w->segment = x->ordered ? malloc(sizeof(*w->segment)) : NULL;
+    pthread_mutex_lock(&x->idle_lock);
+    if (!x->ordered || w->segment != NULL) {
+      w->next_idle = x->idle;
+      x->idle = w;
+      __atomic_add_fetch(&x->nidle, 1, __ATOMIC_RELAXED);
+    }
+    while (w->solver == NULL &&
+           __atomic_load_n(&x->active, __ATOMIC_ACQUIRE) > 0)
+      pthread_cond_wait(&x->idle_cond, &x->idle_lock);
+    pthread_mutex_unlock(&x->idle_lock);
+    w->idle += now() - start;
+    if (w->solver == NULL) {
+      free(w->segment);
+      break;
+    }
+    ++w->steals;
+  }
+  return NULL;
+}
+
+// Runs the search on a given number of threads. If no callback is
+// provided, solutions are only counted.
+static bool search_run(const struct il_problem *p, size_t nthreads, int flags,
+                       struct il_parallel_stats *stats,
+                       bool (*callback)(const struct il_solution *, void *),
+                       void *thunk, double *count) {
+  if (nthreads == 0)
+    nthreads = 1;
+  struct search x = {
+      .flags = flags,
+      .table = NULL,
+      .callback = callback,
+      .thunk = thunk,
+      .ordered = (flags & IL_PARALLEL_ORDERED) != 0 && callback != NULL,
+      .order = NULL,
+      .buffers = NULL,
+      .free_buffers = NULL,
+      .nworkers = nthreads,
+      .active = 1,
+      .idle = NULL,
+      .nidle = 0,
+      .stopped = false,
+  };
+  x.workers = malloc(nthreads * sizeof(*x.workers));
+  if (x.workers == NULL)
+    return false;
+  if ((flags & IL_PARALLEL_TRANSPOSITIONS) != 0 &&
+      (x.table = il_table_create(PARALLEL_TABLE_SIZE)) == NULL) {
+    free(x.workers);
+    return false;
+  }
+  if (x.ordered) {
+    x.order = malloc(sizeof(*x.order));
+    x.buffers = malloc(PARALLEL_ORDERED_BUFFER * sizeof(*x.buffers));
+    if (x.order == NULL || x.buffers == NULL) {
+      free(x.order);
+      free(x.buffers);
+      if (x.table != NULL)
+        il_table_destroy(x.table);
+      free(x.workers);
+      return false;
+    }
+    *x.order = (struct search_segment){.prev = NULL,
+                                       .next = NULL,
+                                       .first = NULL,
+                                       .last = &x.order->first,
+                                       .done = false};
+    for (size_t i = 0; i < PARALLEL_ORDERED_BUFFER; ++i) {
+      x.buffers[i].next = x.free_buffers;
+      x.free_buffers = &x.buffers[i];
+    }
+    pthread_cond_init(&x.order_cond, NULL);
+  }
+  pthread_mutex_init(&x.callback_lock, NULL);
+  pthread_mutex_init(&x.idle_lock, NULL);
+  pthread_cond_init(&x.idle_cond, NULL);
+  for (size_t i = 0; i < nthreads; ++i) {
+    struct search_worker *w = &x.workers[i];
+    w->search = &x;
+    w->index = i;
+    w->solver = NULL;
+    w->segment = NULL;
+    w->steals = 0;
+    w->idle = 0.0;
+    w->table_hits = 0;
+    w->solutions = 0.0;
+  }
+
+  // Let the first thread start at the root of the search tree. If not
+  // all threads can be created, stop the search early.
+  bool (*solver_callback)(const struct il_solution *, void *) = NULL;
+  if (callback != NULL)
+    solver_callback = x.ordered ? search_ordered_callback : search_callback;
+  bool success = (x.workers[0].solver =
+                      il_solver_create(p, solver_callback, &x)) != NULL;
+  size_t started = 0;
+  if (success) {
+    il_solver_set_table(x.workers[0].solver, x.table);
+    if ((flags & IL_PARALLEL_ORDERED) != 0)
+      il_solver_set_deterministic(x.workers[0].solver);
+    x.workers[0].segment = x.order;
+    while (started < nthreads &&
+           pthread_create(&x.workers[started].thread, NULL, search_worker,
+                          &x.workers[started]) == 0)
+      ++started;
+    if (started == 0)
+      il_solver_destroy(x.workers[0].solver);
+    if (started < nthreads) {
+      pthread_mutex_lock(&x.callback_lock);
+      search_stop(&x);
+      pthread_mutex_unlock(&x.callback_lock);
+      success = false;
+    }
+  }
+  for (size_t i = 0; i < started; ++i)
+    pthread_join(x.workers[i].thread, NULL);
+
+  if (stats != NULL) {
+    stats->steals = 0;
+    stats->idle = 0.0;
+    stats->table_hits = 0;
+    for (size_t i = 0; i < nthreads; ++i) {
+      stats->steals += x.workers[i].steals;
+      stats->idle += x.workers[i].idle;
+      stats->table_hits += x.workers[i].table_hits;
+    }
+  }
+  if (count != NULL) {
+    *count = 0.0;
+    for (size_t i = 0; i < nthreads; ++i)
+      *count += x.workers[i].solutions;
+  }
+  pthread_mutex_destroy(&x.callback_lock);
+  pthread_mutex_destroy(&x.idle_lock);
+  pthread_cond_destroy(&x.idle_cond);
+  if (x.ordered) {
+    // Segments are only left behind if not all threads could be created.
+    while (x.order != NULL) {
+      struct search_segment *next = x.order->next;
+      free(x.order);
+      x.order = next;
+    }
+    free(x.buffers);
+    pthread_cond_destroy(&x.order_cond);
+  }
+  if (x.table != NULL)
+    il_table_destroy(x.table);
+  free(x.workers);
+  return success;
+}
+
+bool il_problem_solve_parallel(
+    const struct il_problem *p, size_t nthreads, int flags,
+    struct il_parallel_stats *stats,
+    bool (*callback)(const struct il_solution *, void *), void *thunk) {
+  return search_run(p, nthreads, flags, stats, callback, thunk, NULL);
+}
+
+bool il_problem_count_parallel(const struct il_problem *p, size_t nthreads,
+                               int flags, struct il_parallel_stats *stats,
+                               double *count) {
+  return search_run(p, nthreads, flags, stats, NULL, NULL, count);
+}
+
+struct batch;
+
+// Queue of puzzles that still need to be solved. Without
+// IL_PARALLEL_NUMA, every thread has its own queue. With it, all
+// threads on the same NUMA node share a queue, and the puzzles that are
+// initially placed in the queue are copied to memory local to the node.
+struct batch_queue {
+  pthread_mutex_t lock;
+  size_t begin;
+  size_t end;
+
+  // Puzzles initially placed in this queue. Puzzles stolen from other
+  // queues are read from the memory of the queue they came from.
+  size_t base;
+  size_t count;
+  const struct il_problem *problems;
+  struct il_problem *copy;
+
+  // Other queues, in the order in which work is stolen from them.
+  size_t *victims;
+  size_t nworkers;
+};
+
+struct batch_worker {
+  struct batch *batch;
+  size_t index;
+  pthread_t thread;
+  size_t queue;
+
+  // CPU to which the thread is pinned, if any, and the puzzles it needs
+  // to copy to memory local to its node before starting.
+  size_t cpu;
+  size_t copy_begin;
+  size_t copy_end;
+
+  unsigned long steals;
+  double idle;
+
+  bool pinned;
+  unsigned char padding[7];
+};
+
+struct batch {
+  bool (*callback)(size_t, const struct il_solution *, void *);
+  void *thunk;
+
+  size_t nqueues;
+  struct batch_queue *queues;
+  size_t nworkers;
+  struct batch_worker *workers;
+
+  // Number of threads that have copied their share of the puzzles.
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  size_t copied;
+
+  int flags;
+  unsigned char padding[4];
+};
+
+// Puzzle that is currently being solved.
+struct batch_call {
+  struct batch *batch;
+  size_t index;
+};
+
+static bool batch_callback(const struct il_solution *s, void *thunk) {
+  const struct batch_call *call = thunk;
+  return call->batch->callback(call->index, s, call->batch->thunk);
+}
+
+// Copies the share of puzzles of a thread to the memory of its queue.
+// As pages are allocated on the node of the thread that touches them
+// first, this places them on the node of the thread.
+static void batch_copy(struct batch *b, struct batch_worker *w) {
+  struct batch_queue *q = &b->queues[w->queue];
+  if (q->copy != NULL)
+    for (size_t i = w->copy_begin; i < w->copy_end; ++i)
+      q->copy[i] = q->problems[i];
+  pthread_mutex_lock(&b->lock);
+  if (++b->copied == b->nworkers)
+    pthread_cond_broadcast(&b->cond);
+  pthread_mutex_unlock(&b->lock);
+}
+
+// Takes over half of the remaining puzzles of another queue, preferring
+// queues that are close by. As no new puzzles are added while solving,
+// there is no more work to be done if all other queues are empty.
+// Returns true if the queue of the thread has puzzles left afterwards.
+//
+// With IL_PARALLEL_NUMA, other threads may refill the same queue in the
+// meantime. Both queues are therefore locked while moving puzzles, in
+// the order in which they are stored to prevent deadlocks, and nothing
+// is moved if the queue is no longer empty.
+static bool batch_steal(struct batch_worker *w) {
+  struct batch *b = w->batch;
+  struct batch_queue *q = &b->queues[w->queue];
+  for (size_t i = 0; i < b->nqueues - 1; ++i) {
+    struct batch_queue *v = &b->queues[q->victims[i]];
+    pthread_mutex_lock(q < v ? &q->lock : &v->lock);
+    pthread_mutex_lock(q < v ? &v->lock : &q->lock);
+    bool refilled = q->begin < q->end;
+    size_t count = refilled ? 0 : (v->end - v->begin + 1) / 2;
+    if (count > 0) {
+      q->begin = v->end - count;
+      q->end = v->end;
+      v->end -= count;
+      ++w->steals;
+    }
+    pthread_mutex_unlock(&v->lock);
+    pthread_mutex_unlock(&q->lock);
+    if (refilled || count > 0)
+      return true;
+  }
+  return false;
+}
+
+// Copies a puzzle onto the stack of the thread solving it, reading it
+// from the queue in which it was placed initially.
+static void batch_fetch(const struct batch *b, size_t index,
+                        struct il_problem *p) {
+  size_t lo = 0, hi = b->nqueues - 1;
+  while (lo < hi) {
+    size_t mid = (lo + hi + 1) / 2;
+    if (b->queues[mid].base <= index)
+      lo = mid;
+    else
+      hi = mid - 1;
+  }
+  const struct batch_queue *q = &b->queues[lo];
+  *p = q->copy != NULL ? q->copy[index - q->base]
+                       : q->problems[index - q->base];
+}
+
+static void *batch_worker(void *arg) {
+  struct batch_worker *w = arg;
+  struct batch *b = w->batch;
+  struct batch_queue *q = &b->queues[w->queue];
+  if (w->pinned)
+    pin_thread(w->cpu);
+
+  // Wait for all puzzles to be copied.
+  batch_copy(b, w);
+  pthread_mutex_lock(&b->lock);
+  while (b->copied < b->nworkers)
+    pthread_cond_wait(&b->cond, &b->lock);
+  pthread_mutex_unlock(&b->lock);
+
+  for (;;) {
+    pthread_mutex_lock(&q->lock);
+    if (q->begin < q->end) {
+      struct batch_call call = {.batch = b, .index = q->begin++};
+      pthread_mutex_unlock(&q->lock);
+      struct il_problem p;
+      batch_fetch(b, call.index, &p);
+      il_problem_solve(&p, batch_callback, &call);
+      continue;
+    }
+    pthread_mutex_unlock(&q->lock);
+
+    double start = now();
+    bool found = batch_steal(w);
+    w->idle += now() - start;
+    if (!found)
+      break;
+  }
+  return NULL;
+}
+
+bool il_problem_solve_batch_numa(
+    const struct il_problem *problems, size_t nproblems, size_t nthreads,
+    size_t nfake, int flags, struct il_parallel_stats *stats,
+    bool (*callback)(size_t, const struct il_solution *, void *),
+    void *thunk) {
+  if (nthreads == 0)
+    nthreads = 1;
+
+  // Without IL_PARALLEL_NUMA, every thread has its own queue. With it,
+  // threads are spread out over the NUMA nodes round-robin, and every
+  // node has its own queue.
+  struct topology *t = NULL;
+  size_t nqueues = nthreads;
+  if ((flags & IL_PARALLEL_NUMA) != 0) {
+    t = malloc(sizeof(*t));
+    if (t == NULL)
+      return false;
+    topology_discover(t, nfake);
+    if (nqueues > t->nnodes)
+      nqueues = t->nnodes;
+  }
+  struct batch b = {
+      .flags = flags,
+      .callback = callback,
+      .thunk = thunk,
+      .nqueues = nqueues,
+      .nworkers = nthreads,
+      .copied = 0,
+  };
+  b.queues = malloc(nqueues * sizeof(*b.queues));
+  b.workers = malloc(nthreads * sizeof(*b.workers));
+  size_t *victims = malloc(nqueues * nqueues * sizeof(*victims));
+  if (b.queues == NULL || b.workers == NULL || victims == NULL) {
+    free(t);
+    free(b.queues);
+    free(b.workers);
+    free(victims);
+    return false;
+  }
+  pthread_mutex_init(&b.lock, NULL);
+  pthread_cond_init(&b.cond, NULL);
+
+  // Distribute the puzzles over the queues, proportional to the number
+  // of threads processing them.
+  for (size_t i = 0; i < nqueues; ++i) {
+    struct batch_queue *q = &b.queues[i];
+    pthread_mutex_init(&q->lock, NULL);
+    q->nworkers = nthreads / nqueues + (i < nthreads % nqueues ? 1 : 0);
+  }
+  size_t assigned = 0;
+  for (size_t i = 0; i < nqueues; ++i) {
+    struct batch_queue *q = &b.queues[i];
+    q->base = nproblems * assigned / nthreads;
+    assigned += q->nworkers;
+    q->count = nproblems * assigned / nthreads - q->base;
+    q->begin = q->base;
+    q->end = q->base + q->count;
+    q->problems = problems + q->base;
+    q->copy = NULL;
+    if (t != NULL && q->count > 0) {
+      void *copy = mmap(NULL, q->count * sizeof(*q->copy),
+                        PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+      if (copy != MAP_FAILED)
+        q->copy = copy;
+    }
+
+    // Steal from nearby queues first. Ties are broken by picking the
+    // next queue, so that not all threads pick the same victim.
+    q->victims = &victims[i * nqueues];
+    size_t nvictims = 0;
+    for (size_t j = 1; j < nqueues; ++j) {
+      size_t v = (i + j) % nqueues, k = nvictims++;
+      while (t != NULL && k > 0 &&
+             t->distance[i][q->victims[k - 1]] > t->distance[i][v]) {
+        q->victims[k] = q->victims[k - 1];
+        --k;
+      }
+      q->victims[k] = v;
+    }
+  }
+
+  // Assign threads to queues and CPUs. Threads sharing a queue each
+  // copy an equal part of its puzzles.
+  for (size_t i = 0; i < nthreads; ++i) {
+    struct batch_worker *w = &b.workers[i];
+    w->batch = &b;
+    w->index = i;
+    w->queue = i % nqueues;
+    struct batch_queue *q = &b.queues[w->queue];
+    size_t rank = i / nqueues;
+    w->copy_begin = q->count * rank / q->nworkers;
+    w->copy_end = q->count * (rank + 1) / q->nworkers;
+    if (t != NULL)
+      w->pinned = topology_cpu(t, w->queue, rank, &w->cpu);
+    else
+      w->pinned = (flags & IL_PARALLEL_PIN_THREADS) != 0 &&
+                  allowed_cpu(i, &w->cpu);
+    w->steals = 0;
+    w->idle = 0.0;
+  }
+
+  // Puzzles of threads that could not be created are copied by the
+  // calling thread and stolen by the other threads.
+  size_t started = 0;
+  while (started < nthreads &&
+         pthread_create(&b.workers[started].thread, NULL, batch_worker,
+                        &b.workers[started]) == 0)
+    ++started;
+  for (size_t i = started; i < nthreads; ++i)
+    batch_copy(&b, &b.workers[i]);
+  for (size_t i = 0; i < started; ++i)
+    pthread_join(b.workers[i].thread, NULL);
+
+  if (stats != NULL) {
+    stats->steals = 0;
+    stats->idle = 0.0;
+    stats->table_hits = 0;
+    for (size_t i = 0; i < nthreads; ++i) {
+      stats->steals += b.workers[i].steals;
+      stats->idle += b.workers[i].idle;
+    }
+  }
+  for (size_t i = 0; i < nqueues; ++i) {
+    struct batch_queue *q = &b.queues[i];
+    pthread_mutex_destroy(&q->lock);
+    if (q->copy != NULL)
+      munmap(q->copy, q->count * sizeof(*q->copy));
+  }
+  pthread_cond_destroy(&b.cond);
+  pthread_mutex_destroy(&b.lock);
+  free(victims);
+  free(b.workers);
+  free(b.queues);
+  free(t);
+  return started > 0;
+}
+
+bool il_problem_solve_batch(
+    const struct il_problem *problems, size_t nproblems, size_t nthreads,
+    int flags, struct il_parallel_stats *stats,
+    bool (*callback)(size_t, const struct il_solution *, void *),
+    void *thunk) {
+  return il_problem_solve_batch_numa(problems, nproblems, nthreads, 0, flags,
+                                     stats, callback, thunk);
+}
@@ -0,0 +1,159 @@
+// Copyright (c) 2016 Ed Schouten <ed@nuxi.nl>
+//
+// This file is distributed under a 2-clause BSD license.
+// See the LICENSE file for details.
+
+// Checker for refutations written by il_problem_refute().
+//
+// A refutation is a text file with one step per line. Lines starting
+// with 'c' are comments. All other lines have the form "k x y m", where
+// k is the kind of step, x and y are the coordinates of a cell and m is
+// a hexadecimal bitmask of the rotations of the cell that remain:
+//
+// - 'e': an elimination, reducing the rotations of the cell to m. It
+//   must not remove any rotation that is still consistent with the
+//   neighbours of the cell. If m is zero, the current node of the
+//   search tree is refuted and checking continues at the next node.
+// - 'b': a branch, splitting the current node into one child for every
+//   rotation of the cell. m must match the rotations of the cell, of
+//   which there need to be at least two. The children are refuted in
+//   order of increasing rotation.
+//
+// Every step only requires looking at the neighbours of a single cell,
+// meaning that checking takes time linear in the size of a refutation,
+// without performing any search.
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "infiniteloop.h"
+#include "infiniteloop_impl.h"
+
+// Node of the search tree whose children are being refuted.
+struct check_frame {
+  unsigned char options[IL_AXIS][IL_AXIS];
+  size_t x;
+  size_t y;
+  unsigned char remaining;
+  unsigned char padding[7];
+};
+
+// Parses a number in a given base, preceded by spaces.
+static bool parse_number(const char **in, const char *end, unsigned int base,
+                         size_t *value) {
+  while (*in < end && **in == ' ')
+    ++*in;
+  *value = 0;
+  bool found = false;
+  for (; *in < end; ++*in) {
+    unsigned int digit;
+    if (**in >= '0' && **in <= '9')
+      digit = (unsigned int)(**in - '0');
+    else if (**in >= 'a' && **in <= 'f')
+      digit = (unsigned int)(**in - 'a' + 10);
+    else
+      break;
+    if (digit >= base || *value > IL_AXIS * IL_AXIS)
+      return false;
+    *value = *value * base + digit;
+    found = true;
+  }
+  return found;
+}
+
+bool il_refutation_check(const struct il_problem *p, const char *in,
+                         size_t len) {
+  // Every branch places a cell that had multiple rotations left, which
+  // bounds the depth of the search tree by the number of cells.
+  struct check_frame *frames =
+      malloc((IL_AXIS - 2) * (IL_AXIS - 2) * sizeof(*frames));
+  if (frames == NULL)
+    return false;
+  size_t depth = 0;
+
+  unsigned char options[IL_AXIS][IL_AXIS];
+  for (size_t x = 0; x < IL_AXIS; ++x)
+    for (size_t y = 0; y < IL_AXIS; ++y)
+      options[x][y] = initial_option(p->board[x][y]);
+
+  const char *end = in + len;
+  bool valid = true, refuted = false;
+  while (valid && in < end) {
+    // Skip empty lines and comments.
+    const char *line = in, *eol = memchr(in, '\n', (size_t)(end - in));
+    if (eol == NULL)
+      eol = end;
+    in = eol < end ? eol + 1 : end;
+    if (line == eol || *line == 'c')
+      continue;
+
+    // Parse the coordinates of the cell and its remaining rotations.
+    char kind = *line++;
+    size_t x, y, m;
+    if (refuted || !parse_number(&line, eol, 10, &x) ||
+        !parse_number(&line, eol, 10, &y) ||
+        !parse_number(&line, eol, 16, &m) || line != eol ||
+        x >= IL_AXIS - 2 || y >= IL_AXIS - 2 || m > 0xf) {
+      valid = false;
+      break;
+    }
+    ++x;
+    ++y;
+    unsigned char remaining = (unsigned char)m;
+
+    switch (kind) {
+      case 'e':
+        // Eliminations may only remove rotations that are inconsistent
+        // with the neighbours of the cell.
+        if ((remaining & ~options[x][y]) != 0 || remaining == options[x][y] ||
+            (restrict_cell(p, options, x, y) & ~remaining) != 0) {
+          valid = false;
+          break;
+        }
+        options[x][y] = remaining;
+        if (remaining != 0)
+          break;
+
+        // The current node has been refuted. Continue with the next
+        // child of the closest node that has any left.
+        for (;;) {
+          if (depth == 0) {
+            refuted = true;
+            break;
+          }
+          struct check_frame *f = &frames[depth - 1];
+          if (f->remaining == 0) {
+            --depth;
+            continue;
+          }
+          unsigned char option = f->remaining & (unsigned char)-f->remaining;
+          f->remaining &= (unsigned char)~option;
+          memcpy(options, f->options, sizeof(options));
+          options[f->x][f->y] = option;
+          break;
+        }
+        break;
+      case 'b': {
+        // Branches need to cover all rotations of a cell.
+        if (remaining != options[x][y] || single_bit_set(remaining)) {
+          valid = false;
+          break;
+        }
+        struct check_frame *f = &frames[depth++];
+        memcpy(f->options, options, sizeof(f->options));
+        f->x = x;
+        f->y = y;
+        unsigned char option = remaining & (unsigned char)-remaining;
+        f->remaining = remaining & (unsigned char)~option;
+        options[x][y] = option;
+        break;
+      }
+      default:
+        valid = false;
+        break;
+    }
+  }
+  free(frames);
+  return valid && refuted;
+}
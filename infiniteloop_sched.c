@@ -0,0 +1,233 @@
+// Copyright (c) 2016 Ed Schouten <ed@nuxi.nl>
+//
+// This file is distributed under a 2-clause BSD license.
+// See the LICENSE file for details.
+
+// Scheduler for solving many puzzles on a pool of threads.
+//
+// Requests are first placed in a foreground queue, where they are given
+// a single time slice. Most puzzles are solved within that slice.
+// Requests that need more time are demoted to a background queue, where
+// they are processed round-robin, one slice at a time. This prevents a
+// single pathological puzzle from delaying the trivial puzzles that are
+// submitted after it.
+
+#include <limits.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "infiniteloop.h"
+
+struct request {
+  struct il_problem problem;
+  struct il_solver *solver;
+  unsigned long budget;
+  void (*done)(enum il_request_status, void *);
+  void *thunk;
+  struct request *next;
+};
+
+// Singly linked FIFO queue of requests.
+struct queue {
+  struct request *head;
+  struct request **tail;
+};
+
+struct il_scheduler {
+  pthread_mutex_t lock;
+  pthread_cond_t foreground_cond;
+  pthread_cond_t background_cond;
+  struct queue foreground;
+  struct queue background;
+  size_t pending;
+  size_t max_pending;
+  unsigned long slice;
+
+  size_t nthreads;
+  pthread_t *threads;
+
+  bool shutdown;
+  unsigned char padding[7];
+};
+
+static void queue_push(struct queue *q, struct request *r) {
+  r->next = NULL;
+  *q->tail = r;
+  q->tail = &r->next;
+}
+
+static struct request *queue_pop(struct queue *q) {
+  struct request *r = q->head;
+  if (r != NULL) {
+    q->head = r->next;
+    if (q->head == NULL)
+      q->tail = &q->head;
+  }
+  return r;
+}
+
+// Runs a request for a single time slice. Returns true if the request
+// has completed and has been freed.
+static bool run_slice(struct il_scheduler *s, struct request *r) {
+  unsigned long nodes = r->budget < s->slice ? r->budget : s->slice;
+  enum il_request_status status;
+  if (il_solver_run(r->solver, nodes)) {
+    status = IL_REQUEST_COMPLETED;
+  } else {
+    r->budget -= nodes;
+    if (r->budget > 0)
+      return false;
+    status = IL_REQUEST_BUDGET_EXHAUSTED;
+  }
+
+  il_solver_destroy(r->solver);
+  r->done(status, r->thunk);
+  free(r);
+  pthread_mutex_lock(&s->lock);
+  --s->pending;
+  pthread_mutex_unlock(&s->lock);
+  return true;
+}
+
+// Worker thread processing requests. Foreground workers prefer new
+// requests, but help out with demoted requests if there are none.
+// Background workers only process demoted requests.
+static void worker_run(struct il_scheduler *s, bool foreground) {
+  pthread_mutex_lock(&s->lock);
+  for (;;) {
+    struct request *r = foreground ? queue_pop(&s->foreground) : NULL;
+    if (r == NULL)
+      r = queue_pop(&s->background);
+    if (r == NULL) {
+      // No work left. Terminate if the scheduler is being destroyed.
+      if (s->shutdown && s->pending == 0)
+        break;
+      pthread_cond_wait(foreground ? &s->foreground_cond : &s->background_cond,
+                        &s->lock);
+      continue;
+    }
+    pthread_mutex_unlock(&s->lock);
+
+    bool completed = run_slice(s, r);
+
+    pthread_mutex_lock(&s->lock);
+    if (!completed) {
+      // Demote the request to the background queue. Requests that were
+      // already there are placed at the end, so that long-running
+      // requests get an equal share of time.
+      queue_push(&s->background, r);
+      pthread_cond_signal(&s->background_cond);
+      pthread_cond_signal(&s->foreground_cond);
+    } else if (s->shutdown && s->pending == 0) {
+      pthread_cond_broadcast(&s->foreground_cond);
+      pthread_cond_broadcast(&s->background_cond);
+    }
+  }
+  pthread_mutex_unlock(&s->lock);
+}
+
+static void *foreground_main(void *arg) {
+  worker_run(arg, true);
+  return NULL;
+}
+
+static void *background_main(void *arg) {
+  worker_run(arg, false);
+  return NULL;
+}
+
+struct il_scheduler *il_scheduler_create(size_t foreground_threads,
+                                         size_t background_threads,
+                                         size_t max_pending,
+                                         unsigned long slice) {
+  // Without foreground threads, requests would never be processed.
+  // Without a time slice, workers would make no progress.
+  if (foreground_threads == 0 || slice == 0)
+    return NULL;
+  struct il_scheduler *s = malloc(sizeof(*s));
+  if (s == NULL)
+    return NULL;
+  pthread_mutex_init(&s->lock, NULL);
+  pthread_cond_init(&s->foreground_cond, NULL);
+  pthread_cond_init(&s->background_cond, NULL);
+  s->foreground = (struct queue){.head = NULL, .tail = &s->foreground.head};
+  s->background = (struct queue){.head = NULL, .tail = &s->background.head};
+  s->pending = 0;
+  s->max_pending = max_pending == 0 ? SIZE_MAX : max_pending;
+  s->slice = slice;
+  s->shutdown = false;
+
+  // Spawn worker threads.
+  s->nthreads = 0;
+  s->threads = malloc((foreground_threads + background_threads) *
+                      sizeof(*s->threads));
+  if (s->threads == NULL) {
+    il_scheduler_destroy(s);
+    return NULL;
+  }
+  for (size_t i = 0; i < foreground_threads + background_threads; ++i) {
+    if (pthread_create(&s->threads[s->nthreads], NULL,
+                       i < foreground_threads ? foreground_main
+                                              : background_main,
+                       s) != 0) {
+      il_scheduler_destroy(s);
+      return NULL;
+    }
+    ++s->nthreads;
+  }
+  return s;
+}
+
+bool il_scheduler_submit(struct il_scheduler *s, const struct il_problem *p,
+                         unsigned long budget,
+                         bool (*callback)(const struct il_solution *, void *),
+                         void (*done)(enum il_request_status, void *),
+                         void *thunk) {
+  struct request *r = malloc(sizeof(*r));
+  if (r == NULL)
+    return false;
+  r->problem = *p;
+  r->solver = il_solver_create(&r->problem, callback, thunk);
+  if (r->solver == NULL) {
+    free(r);
+    return false;
+  }
+  r->budget = budget == 0 ? ULONG_MAX : budget;
+  r->done = done;
+  r->thunk = thunk;
+
+  // Apply backpressure by rejecting requests if too many are pending.
+  pthread_mutex_lock(&s->lock);
+  bool accepted = s->pending < s->max_pending;
+  if (accepted) {
+    ++s->pending;
+    queue_push(&s->foreground, r);
+    pthread_cond_signal(&s->foreground_cond);
+  }
+  pthread_mutex_unlock(&s->lock);
+
+  if (!accepted) {
+    il_solver_destroy(r->solver);
+    free(r);
+  }
+  return accepted;
+}
+
+void il_scheduler_destroy(struct il_scheduler *s) {
+  // Let worker threads process the remaining requests and terminate.
+  pthread_mutex_lock(&s->lock);
+  s->shutdown = true;
+  pthread_cond_broadcast(&s->foreground_cond);
+  pthread_cond_broadcast(&s->background_cond);
+  pthread_mutex_unlock(&s->lock);
+  for (size_t i = 0; i < s->nthreads; ++i)
+    pthread_join(s->threads[i], NULL);
+
+  pthread_cond_destroy(&s->foreground_cond);
+  pthread_cond_destroy(&s->background_cond);
+  pthread_mutex_destroy(&s->lock);
+  free(s->threads);
+  free(s);
+}
@@ -0,0 +1,348 @@
+// Copyright (c) 2016 Ed Schouten <ed@nuxi.nl>
+//
+// This file is distributed under a 2-clause BSD license.
+// See the LICENSE file for details.
+
+// Generates scrambled game states, for load testing servers that
+// accept taps from players.
+//
+// Every state is created by picking a random solution, converting it
+// back to a problem using il_solution_unsolve() and turning every cell
+// counterclockwise by a random number of quarter turns, smaller than
+// the number of turns after which the shape of the cell looks the same
+// again. States whose turns add up to fewer taps than requested are
+// scrambled further, starting at a random cell.
+//
+// As a puzzle may have other solutions than the one generated, some of
+// which may need fewer taps, the number of taps needed to solve a state
+// is computed by enumerating all of its solutions and taking the
+// minimum of il_problem_taps(). States that can be solved in fewer taps
+// than requested are discarded.
+//
+// States are written to stdout as fixed size records. Each record
+// holds the cells of the board, stored column by column at four bits
+// per cell with the first cell of every pair in the low bits, followed
+// by the number of taps as a 16-bit integer in host byte order.
+//
+// States are generated in blocks, each having its own seed derived
+// from the seed provided with -s. The same seed thus yields the same
+// states, though blocks may be written in any order.
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "infiniteloop.h"
+
+// Number of states generated by a thread at once.
+#define SCRAMBLE_BLOCK_STATES 4096
+
+// Number of solutions picked for a single state before giving up on
+// finding one that can be scrambled to need enough taps.
+#define SCRAMBLE_MAX_ATTEMPTS 10000
+
+// Number of bytes needed to store a board at four bits per cell.
+#define SCRAMBLE_BOARD_SIZE (((IL_AXIS - 2) * (IL_AXIS - 2) + 1) / 2)
+
+// Number of bytes needed to store a state.
+#define SCRAMBLE_RECORD_SIZE (SCRAMBLE_BOARD_SIZE + sizeof(uint16_t))
+
+struct scramble {
+  uint64_t count;
+  uint64_t seed;
+  unsigned int density;
+  unsigned int min_taps;
+
+  pthread_mutex_t lock;
+  uint64_t next_block;
+
+  // Statistics.
+  uint64_t taps;
+
+  bool failed;
+  unsigned char padding[7];
+};
+
+static bool write_all(int fd, const void *buf, size_t len) {
+  const char *in = buf;
+  while (len > 0) {
+    ssize_t written = write(fd, in, len);
+    if (written < 0) {
+      if (errno == EINTR)
+        continue;
+      return false;
+    }
+    in += written;
+    len -= (size_t)written;
+  }
+  return true;
+}
+
+static void board_pack(const struct il_problem *p, unsigned char *out) {
+  memset(out, 0, SCRAMBLE_BOARD_SIZE);
+  size_t i = 0;
+  for (size_t x = 1; x < IL_AXIS - 1; ++x)
+    for (size_t y = 1; y < IL_AXIS - 1; ++y, ++i)
+      out[i / 2] |= (unsigned char)(p->board[x][y] << (i % 2 * 4));
+}
+
+// Derives the seed of a block using SplitMix64, so that neighbouring
+// blocks get unrelated seeds.
+static uint64_t block_seed(uint64_t seed, uint64_t block) {
+  uint64_t z = seed + (block + 1) * 0x9e3779b97f4a7c15;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+  return z ^ (z >> 31);
+}
+
+static uint64_t scramble_random(uint64_t *state) {
+  uint64_t x = *state;
+  x ^= x << 13;
+  x ^= x >> 7;
+  x ^= x << 17;
+  return *state = x;
+}
+
+// Number of quarter turns after which a cell looks the same again,
+// indexed by its edges. A table is used, as shapes tend to be random.
+static const unsigned char periods[16] = {1, 4, 4, 4, 4, 2, 4, 4,
+                                          4, 4, 2, 4, 4, 4, 4, 1};
+
+// Minimum number of taps needed to solve a state, over the solutions
+// enumerated so far.
+struct min_taps_param {
+  const struct il_problem *p;
+  unsigned int taps;
+  unsigned int limit;
+};
+
+static bool min_taps_callback(const struct il_solution *s, void *thunk) {
+  struct min_taps_param *param = thunk;
+  unsigned int taps;
+  if (il_problem_taps(param->p, s, &taps) && taps < param->taps)
+    param->taps = taps;
+
+  // Stop as soon as the state turns out to be too easy.
+  return param->taps >= param->limit;
+}
+
+// Creates a single scrambled state. Returns false if the solution
+// picked has too few cells that can be turned to need the minimum
+// number of taps, or if the state can be solved in fewer taps by
+// turning it into another solution.
+static bool scramble_state(const struct scramble *sc, uint64_t *random,
+                           struct il_problem *p, unsigned int *taps) {
+  // Pick a random solution, setting every edge with the requested
+  // probability. Any set of edges forms a valid solution.
+  struct il_solution s;
+  uint64_t threshold = (uint64_t)sc->density * 0x10000 / 100;
+  uint64_t bits = 0;
+  unsigned int nbits = 0;
+  for (size_t x = 0; x < IL_AXIS - 3; ++x) {
+    for (size_t y = 0; y < IL_AXIS - 2; ++y) {
+      if (nbits == 0) {
+        bits = scramble_random(random);
+        nbits = 4;
+      }
+      s.horizontal[x][y] = (bits & 0xffff) < threshold;
+      bits >>= 16;
+      --nbits;
+    }
+  }
+  for (size_t x = 0; x < IL_AXIS - 2; ++x) {
+    for (size_t y = 0; y < IL_AXIS - 3; ++y) {
+      if (nbits == 0) {
+        bits = scramble_random(random);
+        nbits = 4;
+      }
+      s.vertical[x][y] = (bits & 0xffff) < threshold;
+      bits >>= 16;
+      --nbits;
+    }
+  }
+  il_solution_unsolve(&s, p);
+
+  // Pick the number of turns of every cell.
+  unsigned char turns[IL_AXIS - 2][IL_AXIS - 2];
+  unsigned int total = 0, max = 0;
+  nbits = 0;
+  for (size_t x = 0; x < IL_AXIS - 2; ++x) {
+    for (size_t y = 0; y < IL_AXIS - 2; ++y) {
+      if (nbits == 0) {
+        bits = scramble_random(random);
+        nbits = 32;
+      }
+      unsigned int period = periods[p->board[x + 1][y + 1]];
+      turns[x][y] = (unsigned char)(bits & (period - 1));
+      total += turns[x][y];
+      max += period - 1;
+      bits >>= 2;
+      --nbits;
+    }
+  }
+  if (max < sc->min_taps)
+    return false;
+
+  // Turn cells further if the state is too easy to solve.
+  size_t ncells = (IL_AXIS - 2) * (IL_AXIS - 2);
+  size_t i = (size_t)(scramble_random(random) % ncells);
+  while (total < sc->min_taps) {
+    size_t x = i / (IL_AXIS - 2), y = i % (IL_AXIS - 2);
+    unsigned int room = periods[p->board[x + 1][y + 1]] - 1u - turns[x][y];
+    if (room > sc->min_taps - total)
+      room = sc->min_taps - total;
+    turns[x][y] = (unsigned char)(turns[x][y] + room);
+    total += room;
+    i = (i + 1) % ncells;
+  }
+
+  // Turn every cell counterclockwise, so that the same number of
+  // clockwise taps brings it back.
+  for (size_t x = 0; x < IL_AXIS - 2; ++x) {
+    for (size_t y = 0; y < IL_AXIS - 2; ++y) {
+      unsigned int c = p->board[x + 1][y + 1];
+      unsigned int t = turns[x][y];
+      p->board[x + 1][y + 1] =
+          (unsigned char)((c >> t | c << (4 - t)) & 0xf);
+    }
+  }
+
+  struct min_taps_param param = {.p = p, .taps = total, .limit = sc->min_taps};
+  il_problem_solve(p, min_taps_callback, &param);
+  if (param.taps < sc->min_taps)
+    return false;
+  *taps = param.taps;
+  return true;
+}
+
+static void *scramble_worker(void *arg) {
+  struct scramble *sc = arg;
+  unsigned char *buf = malloc(SCRAMBLE_BLOCK_STATES * SCRAMBLE_RECORD_SIZE);
+  if (buf == NULL) {
+    pthread_mutex_lock(&sc->lock);
+    perror("malloc");
+    sc->failed = true;
+    pthread_mutex_unlock(&sc->lock);
+    return NULL;
+  }
+
+  for (;;) {
+    // Claim the next block of states.
+    pthread_mutex_lock(&sc->lock);
+    uint64_t block = sc->next_block++;
+    bool failed = sc->failed;
+    pthread_mutex_unlock(&sc->lock);
+    uint64_t first = block * SCRAMBLE_BLOCK_STATES;
+    if (failed || first >= sc->count)
+      break;
+    uint64_t nstates = sc->count - first < SCRAMBLE_BLOCK_STATES
+                           ? sc->count - first
+                           : SCRAMBLE_BLOCK_STATES;
+
+    // Generate the states of the block.
+    uint64_t random = block_seed(sc->seed, block);
+    uint64_t taps_sum = 0;
+    size_t len = 0;
+    for (uint64_t i = 0; i < nstates; ++i) {
+      struct il_problem p;
+      unsigned int taps;
+      unsigned int attempts = 0;
+      while (!scramble_state(sc, &random, &p, &taps)) {
+        if (++attempts == SCRAMBLE_MAX_ATTEMPTS) {
+          pthread_mutex_lock(&sc->lock);
+          if (!sc->failed)
+            fprintf(stderr, "Minimum number of taps too high for density\n");
+          sc->failed = true;
+          pthread_mutex_unlock(&sc->lock);
+          free(buf);
+          return NULL;
+        }
+      }
+      taps_sum += taps;
+      board_pack(&p, buf + len);
+      uint16_t taps16 = (uint16_t)taps;
+      memcpy(buf + len + SCRAMBLE_BOARD_SIZE, &taps16, sizeof(taps16));
+      len += SCRAMBLE_RECORD_SIZE;
+    }
+
+    pthread_mutex_lock(&sc->lock);
+    if (!sc->failed && !write_all(STDOUT_FILENO, buf, len)) {
+      perror("write");
+      sc->failed = true;
+    }
+    sc->taps += taps_sum;
+    pthread_mutex_unlock(&sc->lock);
+  }
+  free(buf);
+  return NULL;
+}
+
+int main(int argc, char *argv[]) {
+  long nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+  struct scramble sc = {
+      .count = 1000000,
+      .density = 50,
+      .lock = PTHREAD_MUTEX_INITIALIZER,
+  };
+  bool seeded = false;
+  int c;
+  while ((c = getopt(argc, argv, "d:j:m:n:s:")) != -1) {
+    switch (c) {
+      case 'd':
+        sc.density = (unsigned int)strtoul(optarg, NULL, 10);
+        break;
+      case 'j':
+        nthreads = strtol(optarg, NULL, 10);
+        break;
+      case 'm':
+        sc.min_taps = (unsigned int)strtoul(optarg, NULL, 10);
+        break;
+      case 'n':
+        sc.count = strtoull(optarg, NULL, 10);
+        break;
+      case 's':
+        sc.seed = strtoull(optarg, NULL, 0);
+        seeded = true;
+        break;
+      default:
+        goto usage;
+    }
+  }
+  if (optind != argc || sc.density > 100) {
+  usage:
+    fprintf(stderr,
+            "usage: infiniteloop_scramble [-d density] [-j threads] "
+            "[-m min_taps] [-n count] [-s seed]\n");
+    return 1;
+  }
+  if (!seeded)
+    sc.seed = (uint64_t)arc4random() << 32 | arc4random();
+  size_t threads = nthreads > 0 ? (size_t)nthreads : 1;
+
+  pthread_t *workers = malloc(threads * sizeof(*workers));
+  if (workers == NULL) {
+    perror("malloc");
+    return 1;
+  }
+  for (size_t i = 0; i < threads; ++i) {
+    if (pthread_create(&workers[i], NULL, scramble_worker, &sc) != 0) {
+      perror("pthread_create");
+      return 1;
+    }
+  }
+  for (size_t i = 0; i < threads; ++i)
+    pthread_join(workers[i], NULL);
+  free(workers);
+
+  if (sc.failed)
+    return 1;
+  fprintf(stderr, "%llu states, seed %#llx, %.2f taps on average\n",
+          (unsigned long long)sc.count, (unsigned long long)sc.seed,
+          sc.count > 0 ? (double)sc.taps / (double)sc.count : 0.0);
+  return 0;
+}
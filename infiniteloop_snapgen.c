@@ -0,0 +1,67 @@
+// Copyright (c) 2016 Ed Schouten <ed@nuxi.nl>
+//
+// This file is distributed under a 2-clause BSD license.
+// See the LICENSE file for details.
+
+// Builds a snapshot of precomputed solutions from a corpus of puzzle
+// files, in the same format as accepted by infiniteloop_cmd.
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "infiniteloop.h"
+
+int main(int argc, char *argv[]) {
+  // Parse command line arguments.
+  size_t max_solutions = 1024;
+  int c;
+  while ((c = getopt(argc, argv, "m:")) != -1) {
+    switch (c) {
+      case 'm':
+        max_solutions = strtoul(optarg, NULL, 10);
+        break;
+      default:
+        goto usage;
+    }
+  }
+  if (argc - optind < 1) {
+  usage:
+    fprintf(stderr,
+            "usage: infiniteloop_snapgen [-m max_solutions] snapshot "
+            "puzzle ...\n");
+    return 1;
+  }
+
+  // Parse all puzzles.
+  size_t nproblems = (size_t)(argc - optind - 1);
+  struct il_problem *problems = malloc(nproblems * sizeof(*problems) + 1);
+  if (problems == NULL) {
+    fprintf(stderr, "Failed to allocate puzzles\n");
+    return 1;
+  }
+  for (size_t i = 0; i < nproblems; ++i) {
+    const char *path = argv[optind + 1 + (int)i];
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+      perror(path);
+      return 1;
+    }
+    char buf[1024];
+    size_t len = fread(buf, 1, sizeof(buf) - 1, f);
+    buf[len] = '\0';
+    fclose(f);
+    if (!il_problem_parse(buf, &problems[i])) {
+      fprintf(stderr, "%s: Failed to parse input\n", path);
+      return 1;
+    }
+  }
+
+  if (!il_snapshot_build(argv[optind], problems, nproblems, max_solutions)) {
+    fprintf(stderr, "Failed to write snapshot\n");
+    return 1;
+  }
+  free(problems);
+  return 0;
+}
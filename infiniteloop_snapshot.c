@@ -0,0 +1,320 @@
+// Copyright (c) 2016 Ed Schouten <ed@nuxi.nl>
+//
+// This file is distributed under a 2-clause BSD license.
+// See the LICENSE file for details.
+
+// Precomputed solutions of puzzles, stored in a file that can be mapped
+// into memory and used without any further processing.
+//
+// The file starts with a header, followed by the sorted hashes of all
+// puzzles, the location of their solutions and finally the solutions
+// themselves. Solutions are packed as bit strings of all horizontal
+// edges, followed by all vertical edges. Integers are stored in native
+// byte order, as snapshots are built on the machines that use them.
+
+#include <fcntl.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "infiniteloop.h"
+#include "infiniteloop_impl.h"
+
+// Number of edges in a solution and the size of a packed solution.
+#define SNAPSHOT_EDGES \
+  ((IL_AXIS - 3) * (IL_AXIS - 2) + (IL_AXIS - 2) * (IL_AXIS - 3))
+#define SNAPSHOT_SOLUTION_SIZE ((SNAPSHOT_EDGES + 7) / 8)
+
+#define SNAPSHOT_MAGIC "ILSNAP01"
+#define SNAPSHOT_BYTE_ORDER 0x01020304
+
+struct snapshot_header {
+  char magic[8];
+  uint32_t byte_order;
+  uint32_t solution_size;
+  uint64_t nproblems;
+  uint64_t nsolutions;
+};
+
+struct snapshot_entry {
+  uint32_t offset;
+  uint32_t count;
+};
+
+struct il_snapshot {
+  void *base;
+  size_t size;
+  size_t nproblems;
+  uint64_t nsolutions;
+  const uint64_t *hashes;
+  const struct snapshot_entry *entries;
+  const unsigned char *solutions;
+};
+
+// Computes the FNV-1a hash of the shapes of the cells of a puzzle. As
+// the orientation of the cells in the input is irrelevant, puzzles that
+// only differ in orientation share their solutions.
+static uint64_t problem_hash(const struct il_problem *p) {
+  uint64_t hash = 0xcbf29ce484222325;
+  for (size_t x = 1; x < IL_AXIS - 1; ++x) {
+    for (size_t y = 1; y < IL_AXIS - 1; ++y) {
+      hash ^= shape(p->board[x][y]);
+      hash *= 0x100000001b3;
+    }
+  }
+  return hash;
+}
+
+static void solution_pack(const struct il_solution *s, unsigned char *out) {
+  memset(out, 0, SNAPSHOT_SOLUTION_SIZE);
+  const bool *edges = &s->horizontal[0][0];
+  for (size_t i = 0; i < SNAPSHOT_EDGES / 2; ++i)
+    if (edges[i])
+      out[i / 8] |= (unsigned char)(1 << i % 8);
+  edges = &s->vertical[0][0];
+  for (size_t i = 0; i < SNAPSHOT_EDGES / 2; ++i)
+    if (edges[i])
+      out[(i + SNAPSHOT_EDGES / 2) / 8] |=
+          (unsigned char)(1 << (i + SNAPSHOT_EDGES / 2) % 8);
+}
+
+static void solution_unpack(const unsigned char *in, struct il_solution *s) {
+  bool *edges = &s->horizontal[0][0];
+  for (size_t i = 0; i < SNAPSHOT_EDGES / 2; ++i)
+    edges[i] = (in[i / 8] & 1 << i % 8) != 0;
+  edges = &s->vertical[0][0];
+  for (size_t i = 0; i < SNAPSHOT_EDGES / 2; ++i)
+    edges[i] = (in[(i + SNAPSHOT_EDGES / 2) / 8] &
+                1 << (i + SNAPSHOT_EDGES / 2) % 8) != 0;
+}
+
+// Returns true if a solution places a piece of the right shape in every
+// cell of a puzzle. This protects against collisions of hashes.
+static bool solution_matches(const struct il_solution *s,
+                             const struct il_problem *p) {
+  for (size_t x = 1; x < IL_AXIS - 1; ++x)
+    for (size_t y = 1; y < IL_AXIS - 1; ++y)
+      if (shape(solution_edges(s, x, y)) != shape(p->board[x][y]))
+        return false;
+  return true;
+}
+
+// Solutions of a single puzzle gathered while building a snapshot.
+struct build_problem {
+  uint64_t hash;
+  size_t offset;
+  size_t count;
+};
+
+struct build_state {
+  unsigned char *solutions;
+  size_t nsolutions;
+  size_t capacity;
+  size_t count;
+  size_t max_solutions;
+  bool failed;
+  unsigned char padding[7];
+};
+
+static bool build_callback(const struct il_solution *s, void *thunk) {
+  struct build_state *b = thunk;
+  if (++b->count > b->max_solutions)
+    return false;
+  if (b->nsolutions == b->capacity) {
+    size_t capacity = b->capacity == 0 ? 1024 : b->capacity * 2;
+    unsigned char *solutions =
+        realloc(b->solutions, capacity * SNAPSHOT_SOLUTION_SIZE);
+    if (solutions == NULL) {
+      b->failed = true;
+      return false;
+    }
+    b->solutions = solutions;
+    b->capacity = capacity;
+  }
+  solution_pack(s, b->solutions + b->nsolutions++ * SNAPSHOT_SOLUTION_SIZE);
+  return true;
+}
+
+static int compare_problems(const void *a, const void *b) {
+  const struct build_problem *pa = a, *pb = b;
+  if (pa->hash != pb->hash)
+    return pa->hash < pb->hash ? -1 : 1;
+  return pa->offset < pb->offset ? -1 : pa->offset > pb->offset;
+}
+
+bool il_snapshot_build(const char *path, const struct il_problem *problems,
+                       size_t nproblems, size_t max_solutions) {
+  struct build_problem *entries = malloc(nproblems * sizeof(*entries) + 1);
+  if (entries == NULL)
+    return false;
+  struct build_state b = {.max_solutions = max_solutions};
+
+  // Solve all puzzles, discarding the ones that have too many solutions.
+  // Puzzles without any solutions are discarded as well, as there would
+  // be no way to detect collisions of hashes for them.
+  size_t nentries = 0;
+  for (size_t i = 0; i < nproblems && !b.failed; ++i) {
+    size_t offset = b.nsolutions;
+    b.count = 0;
+    il_problem_solve(&problems[i], build_callback, &b);
+    if (b.count == 0 || b.count > max_solutions) {
+      b.nsolutions = offset;
+    } else {
+      entries[nentries++] = (struct build_problem){
+          .hash = problem_hash(&problems[i]),
+          .offset = offset,
+          .count = b.count,
+      };
+    }
+  }
+
+  // Sort the puzzles by hash. Only keep the first puzzle for every
+  // hash. Puzzles with colliding hashes will simply be solved again.
+  qsort(entries, nentries, sizeof(entries[0]), compare_problems);
+  size_t nunique = 0;
+  for (size_t i = 0; i < nentries; ++i)
+    if (nunique == 0 || entries[i].hash != entries[nunique - 1].hash)
+      entries[nunique++] = entries[i];
+
+  // Write the snapshot, placing the solutions in the same order as the
+  // hashes. The snapshot is first written to a temporary file, so that
+  // processes never observe a partially written snapshot.
+  char tmp[4096];
+  int fd = -1;
+  FILE *f = NULL;
+  if (!b.failed && b.nsolutions <= UINT32_MAX &&
+      snprintf(tmp, sizeof(tmp), "%s.XXXXXX", path) < (int)sizeof(tmp) &&
+      (fd = mkstemp(tmp)) >= 0 && fchmod(fd, 0644) == 0 &&
+      (f = fdopen(fd, "wb")) != NULL) {
+    struct snapshot_header header = {
+        .byte_order = SNAPSHOT_BYTE_ORDER,
+        .solution_size = SNAPSHOT_SOLUTION_SIZE,
+        .nproblems = nunique,
+        .nsolutions = 0,
+    };
+    memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(header.magic));
+    for (size_t i = 0; i < nunique; ++i)
+      header.nsolutions += entries[i].count;
+    bool success = fwrite(&header, sizeof(header), 1, f) == 1;
+    for (size_t i = 0; i < nunique && success; ++i)
+      success = fwrite(&entries[i].hash, sizeof(uint64_t), 1, f) == 1;
+    uint32_t offset = 0;
+    for (size_t i = 0; i < nunique && success; ++i) {
+      struct snapshot_entry e = {.offset = offset,
+                                 .count = (uint32_t)entries[i].count};
+      success = fwrite(&e, sizeof(e), 1, f) == 1;
+      offset += e.count;
+    }
+    for (size_t i = 0; i < nunique && success; ++i)
+      success = fwrite(b.solutions + entries[i].offset * SNAPSHOT_SOLUTION_SIZE,
+                       SNAPSHOT_SOLUTION_SIZE, entries[i].count,
+                       f) == entries[i].count;
+    if (fclose(f) == 0 && success && rename(tmp, path) == 0) {
+      free(b.solutions);
+      free(entries);
+      return true;
+    }
+    unlink(tmp);
+  } else if (fd >= 0) {
+    close(fd);
+    unlink(tmp);
+  }
+  free(b.solutions);
+  free(entries);
+  return false;
+}
+
+struct il_snapshot *il_snapshot_open(const char *path) {
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0)
+    return NULL;
+  struct stat sb;
+  if (fstat(fd, &sb) != 0 ||
+      (size_t)sb.st_size < sizeof(struct snapshot_header)) {
+    close(fd);
+    return NULL;
+  }
+  size_t size = (size_t)sb.st_size;
+  void *base = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (base == MAP_FAILED)
+    return NULL;
+
+  // Validate the header and the size of the file.
+  const struct snapshot_header *header = base;
+  const size_t problem_size = sizeof(uint64_t) + sizeof(struct snapshot_entry);
+  size_t remaining = size - sizeof(*header);
+  size_t nproblems = (size_t)header->nproblems;
+  if (memcmp(header->magic, SNAPSHOT_MAGIC, sizeof(header->magic)) != 0 ||
+      header->byte_order != SNAPSHOT_BYTE_ORDER ||
+      header->solution_size != SNAPSHOT_SOLUTION_SIZE ||
+      header->nproblems > remaining / problem_size ||
+      header->nsolutions >
+          (remaining - nproblems * problem_size) / SNAPSHOT_SOLUTION_SIZE) {
+    munmap(base, size);
+    return NULL;
+  }
+
+  struct il_snapshot *s = malloc(sizeof(*s));
+  if (s == NULL) {
+    munmap(base, size);
+    return NULL;
+  }
+  s->base = base;
+  s->size = size;
+  s->nproblems = nproblems;
+  s->nsolutions = header->nsolutions;
+  s->hashes = (const uint64_t *)(header + 1);
+  s->entries = (const struct snapshot_entry *)(s->hashes + nproblems);
+  s->solutions = (const unsigned char *)(s->entries + nproblems);
+  return s;
+}
+
+bool il_snapshot_lookup(const struct il_snapshot *s, const struct il_problem *p,
+                        bool (*callback)(const struct il_solution *, void *),
+                        void *thunk) {
+  // Binary search for the hash of the puzzle.
+  uint64_t hash = problem_hash(p);
+  size_t lo = 0, hi = s->nproblems;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (s->hashes[mid] < hash)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  if (lo == s->nproblems || s->hashes[lo] != hash)
+    return false;
+
+  // Entries are only validated when used, so that opening a snapshot
+  // doesn't need to touch all of it. Reject entries referring to
+  // solutions outside of the file.
+  const struct snapshot_entry *e = &s->entries[lo];
+  if (e->count == 0 || (uint64_t)e->offset + e->count > s->nsolutions)
+    return false;
+
+  // Only report solutions if they actually belong to this puzzle.
+  const unsigned char *packed =
+      s->solutions + (size_t)e->offset * SNAPSHOT_SOLUTION_SIZE;
+  struct il_solution solution;
+  solution_unpack(packed, &solution);
+  if (!solution_matches(&solution, p))
+    return false;
+  for (size_t i = 0; i < e->count; ++i) {
+    solution_unpack(packed + i * SNAPSHOT_SOLUTION_SIZE, &solution);
+    if (!callback(&solution, thunk))
+      break;
+  }
+  return true;
+}
+
+void il_snapshot_close(struct il_snapshot *s) {
+  munmap(s->base, s->size);
+  free(s);
+}
@@ -0,0 +1,4614 @@
+// Generated by infiniteloop_tablegen. Do not edit.
+
+static const uint32_t tablebase_solutions[] = {
+    0x00000082, 0x000008a2, 0x00008282, 0x00008aa2, 0x00000186, 0x00001824,
+    0x000018a6, 0x00018286, 0x00018a24, 0x00018aa6, 0x000018e2, 0x000182c2,
+    0x00018ae2, 0x00001144, 0x00008282, 0x000011c6, 0x00008282, 0x00011864,
+    0x000828a2, 0x000118e6, 0x00118244, 0x00828282, 0x001182c6, 0x000828a2,
+    0x00118a64, 0x00828aa2, 0x00118ae6, 0x00083824, 0x000838a6, 0x00838286,
+    0x00838a24, 0x00838aa6, 0x00009286, 0x000928e2, 0x00092824, 0x009282c2,
+    0x000928a6, 0x00928ae2, 0x000093c6, 0x00093864, 0x000938e6, 0x00938244,
+    0x009382c6, 0x00938a64, 0x00938ae6, 0x00011486, 0x00011ca6, 0x00118686,
+    0x00118e24, 0x00118ea6, 0x00828282, 0x001186c2, 0x00828aa2, 0x00118ee2,
+    0x00111444, 0x00182482, 0x00821824, 0x001114c6, 0x008218a6, 0x00111ce6,
+    0x00821824, 0x08218286, 0x01118644, 0x01828682, 0x011186c6, 0x08218a24,
+    0x08218aa6, 0x001828e2, 0x01118e64, 0x01828ea2, 0x01118ee6, 0x00183486,
+    0x00183c24, 0x00183ca6, 0x00183864, 0x01838686, 0x01838e24, 0x01838ea6,
+    0x008382c2, 0x00838ae2, 0x001924c2, 0x00831864, 0x008318e6, 0x08318244,
+    0x083182c6, 0x00192864, 0x019286c2, 0x08318a64, 0x08318ae6, 0x001928e6,
+    0x01928ee2, 0x001934c6, 0x00193c64, 0x00193ce6, 0x01938644, 0x019386c6,
+    0x01938e64, 0x01938ee6, 0x008a28a2, 0x08a28282, 0x008a28a2, 0x08a28aa2,
+    0x008a38a6, 0x008a3824, 0x08a38286, 0x08a38a24, 0x08a38aa6, 0x008b28e2,
+    0x08b282c2, 0x008b28a6, 0x08b28ae2, 0x008b38e6, 0x08b38244, 0x08b382c6,
+    0x08b38a64, 0x08b38ae6, 0x00921864, 0x09218686, 0x09218e24, 0x09218ea6,
+    0x009386c2, 0x00938ee2, 0x09318644, 0x093186c6, 0x09318e64, 0x09318ee6,
+    0x09a28682, 0x09a28ea2, 0x009a3ca6, 0x009a3864, 0x09a38686, 0x09a38e24,
+    0x09a38ea6, 0x09b286c2, 0x009b28e6, 0x09b28ee2, 0x009b3ce6, 0x09b38644,
+    0x09b386c6, 0x09b38e64, 0x09b38ee6, 0x00114824, 0x001148a6, 0x0011c286,
+    0x0011caa6, 0x01114864, 0x018248a2, 0x011148e6, 0x0111c244, 0x0182c282,
+    0x0111c2c6, 0x0111ca64, 0x0182caa2, 0x0111cae6, 0x01834824, 0x018348a6,
+    0x0183c286, 0x0183ca24, 0x0183caa6, 0x019248e2, 0x0192c2c2, 0x0192cae2,
+    0x01934864, 0x019348e6, 0x0193c244, 0x0193c2c6, 0x0193ca64, 0x0193cae6,
+    0x11114444, 0x11824482, 0x18214824, 0x82118244, 0x82828282, 0x111144c6,
+    0x821182c6, 0x182148a6, 0x11114c64, 0x11824ca2, 0x11114ce6, 0x82828aa2,
+    0x82118ae6, 0x1821c286, 0x1111c6c6, 0x1821caa6, 0x1111cee6, 0x11834486,
+    0x82838286, 0x11834c24, 0x11834ca6, 0x82838a24, 0x82838aa6, 0x1183c686,
+    0x1183ce24, 0x1183cea6, 0x119244c2, 0x18314864, 0x829282c2, 0x183148e6,
+    0x11924ce2, 0x82928ae2, 0x1831c2c6, 0x1192c6c2, 0x1831ca64, 0x1831cae6,
+    0x1192cee2, 0x119344c6, 0x829382c6, 0x11934c64, 0x11934ce6, 0x82938a64,
+    0x82938ae6, 0x1193c644, 0x1193c6c6, 0x1193ce64, 0x1193cee6, 0x18a248a2,
+    0x18a2caa2, 0x18a348a6, 0x18a3c286, 0x18a3ca24, 0x18a3caa6, 0x18b248e2,
+    0x18b2c2c2, 0x18b2cae2, 0x18b348e6, 0x18b3c2c6, 0x18b3ca64, 0x18b3cae6,
+    0x83838686, 0x83838ea6, 0x19314c64, 0x839286c2, 0x19314ce6, 0x83928ee2,
+    0x1931c6c6, 0x1931cee6, 0x839386c6, 0x83938e64, 0x83938ee6, 0x19a24ca2,
+    0x19a2cea2, 0x19a34ca6, 0x19a3c686, 0x19a3cea6, 0x19b24ce2, 0x19b2cee2,
+    0x19b34ce6, 0x19b3c6c6, 0x19b3ce64, 0x19b3cee6, 0x8aa28aa2, 0x8aa38aa6,
+    0x8ab28ae2, 0x8ab38ae6, 0x8ba38ea6, 0x8bb28ee2, 0x8bb38ee6, 0x9283c286,
+    0x9283caa6, 0x9293c2c6, 0x9293cae6, 0x9393c6c6, 0x9393cee6, 0x9aa3caa6,
+    0x9ab3cae6, 0x9bb3cee6, 0x000148a2, 0x00148282, 0x00148aa2, 0x000158a6,
+    0x00158286, 0x00158a24, 0x00158aa6, 0x00011486, 0x001148e2, 0x00114824,
+    0x011482c2, 0x001148a6, 0x01148ae2, 0x001868a2, 0x01868282, 0x001868a2,
+    0x01868aa2, 0x001158e6, 0x01158244, 0x011582c6, 0x01158a64, 0x01158ae6,
+    0x01878286, 0x01878a24, 0x01878aa6, 0x00019686, 0x001968e2, 0x00196824,
+    0x019682c2, 0x001968a6, 0x01968ae2, 0x001978e6, 0x01978244, 0x019782c6,
+    0x01978a64, 0x01978ae6, 0x00114482, 0x00114ca2, 0x01148682, 0x01148ea2,
+    0x00115486, 0x00115c24, 0x00115ca6, 0x01158686, 0x01158e24, 0x01158ea6,
+    0x00182482, 0x00111444, 0x00182482, 0x011144c2, 0x018248a2, 0x001114c6,
+    0x01114ce2, 0x00182482, 0x18248282, 0x01114864, 0x111486c2, 0x018248a2,
+    0x18248aa2, 0x011148e6, 0x11148ee2, 0x00011864, 0x01186482, 0x001186c2,
+    0x01186ca2, 0x00118686, 0x11868682, 0x011868e2, 0x11868ea2, 0x00018254,
+    0x00182586, 0x01115444, 0x01825824, 0x011154c6, 0x018258a6, 0x01115c64,
+    0x01115ce6, 0x01825824, 0x18258286, 0x11158644, 0x111586c6, 0x18258a24,
+    0x18258aa6, 0x11158e64, 0x11158ee6, 0x00118744, 0x01187486, 0x01187c24,
+    0x01187ca6, 0x01187864, 0x11878686, 0x11878e24, 0x11878ea6, 0x00018344,
+    0x001834c2, 0x00183486, 0x018348e2, 0x01834824, 0x183482c2, 0x018348a6,
+    0x18348ae2, 0x00119644, 0x011964c2, 0x001196c6, 0x01196ce2, 0x01196864,
+    0x119686c2, 0x011968e6, 0x11968ee2, 0x00183544, 0x001835c6, 0x01835864,
+    0x018358e6, 0x18358244, 0x183582c6, 0x18358a64, 0x18358ae6, 0x01197444,
+    0x011974c6, 0x01197c64, 0x01197ce6, 0x11978644, 0x119786c6, 0x11978e64,
+    0x11978ee6, 0x0018a682, 0x0018a682, 0x018a68a2, 0x0018a682, 0x18a68282,
+    0x018a68a2, 0x18a68aa2, 0x00018a74, 0x0018a786, 0x018a7824, 0x018a78a6,
+    0x018a7824, 0x18a78286, 0x18a78a24, 0x18a78aa6, 0x00018b64, 0x0018b6c2,
+    0x0018b686, 0x018b68e2, 0x018b6824, 0x18b682c2, 0x018b68a6, 0x18b68ae2,
+    0x0018b744, 0x0018b7c6, 0x018b7864, 0x018b78e6, 0x18b78244, 0x18b782c6,
+    0x18b78a64, 0x18b78ae6, 0x01924482, 0x001924c2, 0x01924ca2, 0x00192486,
+    0x19248682, 0x019248e2, 0x19248ea2, 0x00192544, 0x01925486, 0x01925c24,
+    0x01925ca6, 0x01925864, 0x19258686, 0x19258e24, 0x19258ea6, 0x00193444,
+    0x019344c2, 0x001934c6, 0x01934ce2, 0x01934864, 0x193486c2, 0x019348e6,
+    0x19348ee2, 0x01935444, 0x019354c6, 0x01935c64, 0x01935ce6, 0x19358644,
+    0x193586c6, 0x19358e64, 0x19358ee6, 0x00019a64, 0x019a6482, 0x0019a6c2,
+    0x019a6ca2, 0x0019a686, 0x19a68682, 0x019a68e2, 0x19a68ea2, 0x0019a744,
+    0x019a7486, 0x019a7c24, 0x019a7ca6, 0x019a7864, 0x19a78686, 0x19a78e24,
+    0x19a78ea6, 0x0019b644, 0x019b64c2, 0x0019b6c6, 0x019b6ce2, 0x019b6864,
+    0x19b686c2, 0x019b68e6, 0x19b68ee2, 0x019b7444, 0x019b74c6, 0x019b7c64,
+    0x019b7ce6, 0x19b78644, 0x19b786c6, 0x19b78e64, 0x19b78ee6, 0x011448a2,
+    0x0114c282, 0x0114caa2, 0x01154824, 0x011548a6, 0x0115c286, 0x0115ca24,
+    0x0115caa6, 0x01114486, 0x111448e2, 0x01114c24, 0x1114c2c2, 0x01114ca6,
+    0x1114cae2, 0x01186482, 0x118648a2, 0x1186c282, 0x01186ca2, 0x1186caa2,
+    0x11154864, 0x111548e6, 0x1115c244, 0x1115c2c6, 0x1115ca64, 0x1115cae6,
+    0x11874824, 0x118748a6, 0x1187c286, 0x1187ca24, 0x1187caa6, 0x01196486,
+    0x119648e2, 0x01196c24, 0x1196c2c2, 0x01196ca6, 0x1196cae2, 0x11974864,
+    0x119748e6, 0x1197c244, 0x1197c2c6, 0x1197ca64, 0x1197cae6, 0x018248a2,
+    0x11144482, 0x18248282, 0x11144ca2, 0x18248aa2, 0x1114c682, 0x1114cea2,
+    0x01825824, 0x018258a6, 0x11154486, 0x18258286, 0x11154c24, 0x11154ca6,
+    0x18258a24, 0x18258aa6, 0x1115c686, 0x1115ce24, 0x1115cea6, 0x00182144,
+    0x018214c2, 0x01821486, 0x182148e2, 0x00118244, 0x11824482, 0x11114444,
+    0x11824482, 0x18214824, 0x111144c6, 0x182148a6, 0x011824c2, 0x11114c64,
+    0x11824ca2, 0x11114ce6, 0x01828682, 0x01828682, 0x182868a2, 0x01118644,
+    0x01828682, 0x111864c2, 0x182868a2, 0x011186c6, 0x11186ce2, 0x01821544,
+    0x018215c6, 0x18215864, 0x182158e6, 0x01182544, 0x11825486, 0x11825c24,
+    0x00182874, 0x01828786, 0x18287824, 0x182878a6, 0x11187444, 0x18287824,
+    0x11187c64, 0x01183444, 0x118344c2, 0x11834486, 0x11834c24, 0x11834ca6,
+    0x00182964, 0x018296c2, 0x01829686, 0x182968e2, 0x11196444, 0x18296824,
+    0x111964c6, 0x182968a6, 0x11196c64, 0x11196ce6, 0x11835444, 0x118354c6,
+    0x01829744, 0x018297c6, 0x18297864, 0x182978e6, 0x00118a64, 0x118a6482,
+    0x118a6482, 0x0118a6c2, 0x118a6ca2, 0x0118a744, 0x118a7486, 0x118a7c24,
+    0x0118b644, 0x118b64c2, 0x118b6486, 0x118b6c24, 0x118b6ca6, 0x118b7444,
+    0x118b74c6, 0x01834482, 0x01834ca2, 0x18348682, 0x18348ea2, 0x01835486,
+    0x01835c24, 0x01835ca6, 0x18358686, 0x18358e24, 0x18358ea6, 0x01831444,
+    0x183144c2, 0x018314c6, 0x18314ce2, 0x01192444, 0x119244c2, 0x18314864,
+    0x183148e6, 0x011924c6, 0x11924ce2, 0x00183864, 0x18386482, 0x018386c2,
+    0x18386ca2, 0x01838686, 0x183868e2, 0x18315444, 0x183154c6, 0x18315c64,
+    0x18315ce6, 0x11925444, 0x11925c64, 0x01838744, 0x18387486, 0x18387c24,
+    0x18387ca6, 0x18387864, 0x11934444, 0x119344c6, 0x11934c64, 0x11934ce6,
+    0x01839644, 0x183964c2, 0x018396c6, 0x18396ce2, 0x18396864, 0x183968e6,
+    0x18397444, 0x183974c6, 0x18397c64, 0x18397ce6, 0x0119a644, 0x119a64c2,
+    0x0119a6c6, 0x119a6ce2, 0x119a7444, 0x119a7c64, 0x119b6444, 0x119b64c6,
+    0x119b6c64, 0x119b6ce6, 0x018a2482, 0x018a2482, 0x18a248a2, 0x018a2482,
+    0x18a248a2, 0x0018a254, 0x018a2586, 0x18a25824, 0x18a258a6, 0x18a25824,
+    0x0018a344, 0x018a34c2, 0x018a3486, 0x18a348e2, 0x18a34824, 0x18a348a6,
+    0x018a3544, 0x018a35c6, 0x18a35864, 0x18a358e6, 0x018aa682, 0x018aa682,
+    0x18aa68a2, 0x018aa682, 0x18aa68a2, 0x0018aa74, 0x018aa786, 0x18aa7824,
+    0x18aa78a6, 0x18aa7824, 0x0018ab64, 0x018ab6c2, 0x018ab686, 0x18ab68e2,
+    0x18ab6824, 0x18ab68a6, 0x018ab744, 0x018ab7c6, 0x18ab7864, 0x18ab78e6,
+    0x0018b244, 0x18b24482, 0x018b24c2, 0x18b24ca2, 0x018b2486, 0x18b248e2,
+    0x018b2544, 0x18b25486, 0x18b25c24, 0x18b25ca6, 0x18b25864, 0x018b3444,
+    0x18b344c2, 0x018b34c6, 0x18b34ce2, 0x18b34864, 0x18b348e6, 0x18b35444,
+    0x18b354c6, 0x18b35c64, 0x18b35ce6, 0x0018ba64, 0x18ba6482, 0x018ba6c2,
+    0x18ba6ca2, 0x018ba686, 0x18ba68e2, 0x018ba744, 0x18ba7486, 0x18ba7c24,
+    0x18ba7ca6, 0x18ba7864, 0x018bb644, 0x18bb64c2, 0x018bb6c6, 0x18bb6ce2,
+    0x18bb6864, 0x18bb68e6, 0x18bb7444, 0x18bb74c6, 0x18bb7c64, 0x18bb7ce6,
+    0x192448a2, 0x1924c282, 0x1924caa2, 0x19254824, 0x192548a6, 0x1925c286,
+    0x1925ca24, 0x1925caa6, 0x01921444, 0x192144c2, 0x19214486, 0x19214c24,
+    0x19214ca6, 0x00192864, 0x19286482, 0x19286482, 0x019286c2, 0x19286ca2,
+    0x19215444, 0x192154c6, 0x01928744, 0x19287486, 0x19287c24, 0x01929644,
+    0x192964c2, 0x19296486, 0x19296c24, 0x19296ca6, 0x19297444, 0x192974c6,
+    0x19344482, 0x19344ca2, 0x1934c682, 0x1934cea2, 0x19354486, 0x19354c24,
+    0x19354ca6, 0x1935c686, 0x1935ce24, 0x1935cea6, 0x19314444, 0x193144c6,
+    0x19314c64, 0x19314ce6, 0x01938644, 0x193864c2, 0x019386c6, 0x19386ce2,
+    0x19387444, 0x19387c64, 0x19396444, 0x193964c6, 0x19396c64, 0x19396ce6,
+    0x19a24482, 0x19a24482, 0x019a24c2, 0x19a24ca2, 0x019a2544, 0x19a25486,
+    0x19a25c24, 0x019a3444, 0x19a344c2, 0x19a34486, 0x19a34c24, 0x19a34ca6,
+    0x19a35444, 0x19a354c6, 0x0019aa64, 0x19aa6482, 0x19aa6482, 0x019aa6c2,
+    0x19aa6ca2, 0x019aa744, 0x19aa7486, 0x19aa7c24, 0x019ab644, 0x19ab64c2,
+    0x19ab6486, 0x19ab6c24, 0x19ab6ca6, 0x19ab7444, 0x19ab74c6, 0x019b2444,
+    0x19b244c2, 0x019b24c6, 0x19b24ce2, 0x19b25444, 0x19b25c64, 0x19b34444,
+    0x19b344c6, 0x19b34c64, 0x19b34ce6, 0x019ba644, 0x19ba64c2, 0x019ba6c6,
+    0x19ba6ce2, 0x19ba7444, 0x19ba7c64, 0x19bb6444, 0x19bb64c6, 0x19bb6c64,
+    0x19bb6ce6, 0x00148282, 0x00148aa2, 0x01418286, 0x01418a24, 0x01418aa6,
+    0x01c28282, 0x001c28a2, 0x01c28aa2, 0x01c38286, 0x01c38a24, 0x01c38aa6,
+    0x001582c2, 0x00158ae2, 0x01518244, 0x015182c6, 0x01518a64, 0x01518ae6,
+    0x001d2824, 0x01d282c2, 0x001d28a6, 0x01d28ae2, 0x01d38244, 0x01d382c6,
+    0x01d38a64, 0x01d38ae6, 0x01148682, 0x01148ea2, 0x00114144, 0x01141486,
+    0x01141ca6, 0x01141864, 0x11418686, 0x11418e24, 0x11418ea6, 0x01868282,
+    0x01868aa2, 0x00186186, 0x011c2482, 0x01861824, 0x018618a6, 0x01861824,
+    0x18618286, 0x0011c286, 0x11c28682, 0x18618a24, 0x18618aa6, 0x011c28e2,
+    0x11c28ea2, 0x0011c344, 0x011c3486, 0x011c3c24, 0x011c3ca6, 0x011c3864,
+    0x11c38686, 0x11c38e24, 0x11c38ea6, 0x011586c2, 0x01158ee2, 0x01151444,
+    0x011514c6, 0x01151ce6, 0x11518644, 0x115186c6, 0x11518e64, 0x11518ee6,
+    0x018782c2, 0x01878ae2, 0x00187144, 0x0018e282, 0x001871c6, 0x011d24c2,
+    0x01871864, 0x018e28a2, 0x018718e6, 0x0018e282, 0x18718244, 0x18e28282,
+    0x187182c6, 0x011d2864, 0x11d286c2, 0x018e28a2, 0x18718a64, 0x18e28aa2,
+    0x18718ae6, 0x011d28e6, 0x11d28ee2, 0x011d3444, 0x018e3824, 0x011d34c6,
+    0x018e38a6, 0x011d3c64, 0x011d3ce6, 0x018e3824, 0x18e38286, 0x11d38644,
+    0x11d386c6, 0x18e38a24, 0x18e38aa6, 0x11d38e64, 0x11d38ee6, 0x00018f24,
+    0x0018f2c2, 0x018f28e2, 0x018f2824, 0x18f282c2, 0x018f28a6, 0x18f28ae2,
+    0x0018f3c6, 0x018f3864, 0x018f38e6, 0x18f38244, 0x18f382c6, 0x18f38a64,
+    0x18f38ae6, 0x01968682, 0x01968ea2, 0x01961864, 0x19618686, 0x19618e24,
+    0x19618ea6, 0x019786c2, 0x01978ee2, 0x0019e286, 0x19718644, 0x19e28682,
+    0x197186c6, 0x019e28e2, 0x19718e64, 0x19e28ea2, 0x19718ee6, 0x0019e344,
+    0x019e3486, 0x019e3ca6, 0x019e3864, 0x19e38686, 0x19e38e24, 0x19e38ea6,
+    0x019f2864, 0x19f286c2, 0x019f28e6, 0x19f28ee2, 0x019f3444, 0x019f34c6,
+    0x019f3ce6, 0x19f38644, 0x19f386c6, 0x19f38e64, 0x19f38ee6, 0x011448a2,
+    0x0114c282, 0x0114caa2, 0x11414824, 0x114148a6, 0x1141c286, 0x1141ca24,
+    0x1141caa6, 0x011c2482, 0x11c248a2, 0x11c2c282, 0x011c2ca2, 0x11c2caa2,
+    0x11c34824, 0x11c348a6, 0x11c3c286, 0x11c3ca24, 0x11c3caa6, 0x011548e2,
+    0x0115c2c2, 0x0115cae2, 0x11514864, 0x115148e6, 0x1151c244, 0x1151c2c6,
+    0x1151ca64, 0x1151cae6, 0x011d2486, 0x11d248e2, 0x011d2c24, 0x11d2c2c2,
+    0x011d2ca6, 0x11d2cae2, 0x11d34864, 0x11d348e6, 0x11d3c244, 0x11d3c2c6,
+    0x11d3ca64, 0x11d3cae6, 0x00182482, 0x018248a2, 0x11144482, 0x18248282,
+    0x11144ca2, 0x18248aa2, 0x1114c682, 0x1114cea2, 0x01824186, 0x18241824,
+    0x182418a6, 0x11141444, 0x18241824, 0x11141c64, 0x01186482, 0x118648a2,
+    0x1186c282, 0x1186caa2, 0x0182c282, 0x0182c282, 0x182c28a2, 0x01186144,
+    0x11861486, 0x0111c244, 0x0182c282, 0x111c24c2, 0x182c28a2, 0x11861c24,
+    0x0111c2c6, 0x111c2ce2, 0x0182c386, 0x182c3824, 0x182c38a6, 0x111c3444,
+    0x182c3824, 0x111c3c64, 0x001825c2, 0x018258e2, 0x111544c2, 0x182582c2,
+    0x11154ce2, 0x18258ae2, 0x1115c6c2, 0x1115cee2, 0x01825144, 0x018251c6,
+    0x18251864, 0x182518e6, 0x011874c2, 0x118748e2, 0x1187c2c2, 0x1187cae2,
+    0x00182d24, 0x0182d2c2, 0x0182d286, 0x182d28e2, 0x11871444, 0x118e2482,
+    0x118714c6, 0x111d2444, 0x118e2482, 0x182d2824, 0x111d24c6, 0x182d28a6,
+    0x0118e2c2, 0x111d2c64, 0x118e2ca2, 0x111d2ce6, 0x0182d344, 0x0182d3c6,
+    0x182d3864, 0x182d38e6, 0x0118e344, 0x118e3486, 0x118e3c24, 0x0118f244,
+    0x118f24c2, 0x118f2486, 0x118f2c24, 0x118f2ca6, 0x118f3444, 0x118f34c6,
+    0x01834482, 0x01834ca2, 0x18348682, 0x18348ea2, 0x01834144, 0x18341486,
+    0x18341c24, 0x18341ca6, 0x18341864, 0x11964482, 0x11964ca2, 0x1196c682,
+    0x1196cea2, 0x00183c24, 0x183c2482, 0x0183c2c2, 0x183c2ca2, 0x11961444,
+    0x0183c286, 0x183c28e2, 0x11961c64, 0x0183c344, 0x183c3486, 0x183c3c24,
+    0x183c3ca6, 0x183c3864, 0x018354c2, 0x01835ce2, 0x183586c2, 0x18358ee2,
+    0x18351444, 0x183514c6, 0x18351c64, 0x18351ce6, 0x119744c2, 0x11974ce2,
+    0x1197c6c2, 0x1197cee2, 0x0183d244, 0x183d24c2, 0x0183d2c6, 0x183d2ce2,
+    0x0119e244, 0x119e24c2, 0x183d2864, 0x183d28e6, 0x0119e2c6, 0x119e2ce2,
+    0x183d3444, 0x183d34c6, 0x183d3c64, 0x183d3ce6, 0x119e3444, 0x119e3c64,
+    0x119f2444, 0x119f24c6, 0x119f2c64, 0x119f2ce6, 0x0018a682, 0x018a68a2,
+    0x18a68282, 0x18a68aa2, 0x018a6186, 0x18a61824, 0x18a618a6, 0x18a61824,
+    0x0018a7c2, 0x018a78e2, 0x18a782c2, 0x18a78ae2, 0x018a7144, 0x018ae282,
+    0x018a71c6, 0x018ae282, 0x18a71864, 0x18ae28a2, 0x18a718e6, 0x018ae282,
+    0x18ae28a2, 0x018ae386, 0x18ae3824, 0x18ae38a6, 0x18ae3824, 0x0018af24,
+    0x018af2c2, 0x018af286, 0x18af28e2, 0x18af2824, 0x18af28a6, 0x018af344,
+    0x018af3c6, 0x18af3864, 0x18af38e6, 0x018b6482, 0x018b6ca2, 0x18b68682,
+    0x18b68ea2, 0x018b6144, 0x18b61486, 0x18b61c24, 0x18b61ca6, 0x18b61864,
+    0x018b74c2, 0x018b7ce2, 0x18b786c2, 0x18b78ee2, 0x0018be24, 0x18b71444,
+    0x18be2482, 0x18b714c6, 0x018be2c2, 0x18b71c64, 0x18be2ca2, 0x18b71ce6,
+    0x018be286, 0x18be28e2, 0x018be344, 0x18be3486, 0x18be3c24, 0x18be3ca6,
+    0x18be3864, 0x018bf244, 0x18bf24c2, 0x018bf2c6, 0x18bf2ce2, 0x18bf2864,
+    0x18bf28e6, 0x18bf3444, 0x18bf34c6, 0x18bf3c64, 0x18bf3ce6, 0x01924482,
+    0x192448a2, 0x1924c282, 0x1924caa2, 0x01924144, 0x19241486, 0x19241c24,
+    0x192c2482, 0x192c2482, 0x0192c2c2, 0x192c2ca2, 0x0192c344, 0x192c3486,
+    0x192c3c24, 0x019254c2, 0x192548e2, 0x1925c2c2, 0x1925cae2, 0x19251444,
+    0x192514c6, 0x0192d244, 0x192d24c2, 0x192d2486, 0x192d2c24, 0x192d2ca6,
+    0x192d3444, 0x192d34c6, 0x19344482, 0x19344ca2, 0x1934c682, 0x1934cea2,
+    0x19341444, 0x19341c64, 0x0193c244, 0x193c24c2, 0x0193c2c6, 0x193c2ce2,
+    0x193c3444, 0x193c3c64, 0x193544c2, 0x19354ce2, 0x1935c6c2, 0x1935cee2,
+    0x193d2444, 0x193d24c6, 0x193d2c64, 0x193d2ce6, 0x019a6482, 0x19a648a2,
+    0x19a6c282, 0x19a6caa2, 0x019a6144, 0x19a61486, 0x19a61c24, 0x019a74c2,
+    0x19a748e2, 0x19a7c2c2, 0x19a7cae2, 0x19a71444, 0x19ae2482, 0x19a714c6,
+    0x19ae2482, 0x019ae2c2, 0x19ae2ca2, 0x019ae344, 0x19ae3486, 0x19ae3c24,
+    0x019af244, 0x19af24c2, 0x19af2486, 0x19af2c24, 0x19af2ca6, 0x19af3444,
+    0x19af34c6, 0x19b64482, 0x19b64ca2, 0x19b6c682, 0x19b6cea2, 0x19b61444,
+    0x19b61c64, 0x19b744c2, 0x19b74ce2, 0x19b7c6c2, 0x19b7cee2, 0x019be244,
+    0x19be24c2, 0x019be2c6, 0x19be2ce2, 0x19be3444, 0x19be3c64, 0x19bf2444,
+    0x19bf24c6, 0x19bf2c64, 0x19bf2ce6, 0x08218286, 0x08218a24, 0x08218aa6,
+    0x00821824, 0x082182c2, 0x008218a6, 0x08218ae2, 0x11448282, 0x82118244,
+    0x82828282, 0x821182c6, 0x011448a2, 0x082828a2, 0x82118a64, 0x11448aa2,
+    0x82828aa2, 0x82118ae6, 0x82838286, 0x82838a24, 0x82838aa6, 0x11458286,
+    0x11458a24, 0x11458aa6, 0x08292824, 0x829282c2, 0x082928a6, 0x82928ae2,
+    0x11c68282, 0x82938244, 0x829382c6, 0x011c68a2, 0x82938a64, 0x11c68aa2,
+    0x82938ae6, 0x11c78286, 0x11c78a24, 0x11c78aa6, 0x01154824, 0x115482c2,
+    0x011548a6, 0x11548ae2, 0x11558244, 0x115582c6, 0x11558a64, 0x11558ae6,
+    0x011d6824, 0x11d682c2, 0x011d68a6, 0x11d68ae2, 0x11d78244, 0x11d782c6,
+    0x11d78a64, 0x11d78ae6, 0x08211486, 0x08211c24, 0x08211ca6, 0x82118686,
+    0x82118e24, 0x82118ea6, 0x082114c2, 0x082828a2, 0x08211ce2, 0x00828282,
+    0x82828282, 0x08211864, 0x821186c2, 0x082828a2, 0x82828aa2, 0x082118e6,
+    0x82118ee2, 0x11144482, 0x82111444, 0x82182482, 0x82821824, 0x821114c6,
+    0x828218a6, 0x011144c2, 0x082182c2, 0x82111c64, 0x11144ca2, 0x82182ca2,
+    0x82111ce6, 0x82821824, 0x01114486, 0x08218286, 0x111448e2, 0x821828e2,
+    0x82183c24, 0x82183ca6, 0x82183864, 0x11145c24, 0x11145ca6, 0x11145864,
+    0x082838e2, 0x08283824, 0x828382c2, 0x082838a6, 0x82838ae2, 0x01186482,
+    0x08219244, 0x821924c2, 0x82831864, 0x118648a2, 0x828318e6, 0x082192c6,
+    0x82192ce2, 0x01186482, 0x82192864, 0x118648a2, 0x821928e6, 0x821934c6,
+    0x0111c6c2, 0x82193c64, 0x111c6ca2, 0x82193ce6, 0x0111c686, 0x111c68e2,
+    0x118658a6, 0x11865824, 0x111c7c24, 0x111c7ca6, 0x111c7864, 0x01115444,
+    0x0828a282, 0x111544c2, 0x828a28a2, 0x011154c6, 0x11154ce2, 0x0828a282,
+    0x11154864, 0x828a28a2, 0x111548e6, 0x828a38a6, 0x828a3824, 0x11155c64,
+    0x11155ce6, 0x01187486, 0x0828b286, 0x118748e2, 0x828b28e2, 0x11874824,
+    0x828b2824, 0x118748a6, 0x828b28a6, 0x111d64c2, 0x828b3864, 0x118e68a2,
+    0x828b38e6, 0x0111d6c6, 0x111d6ce2, 0x0118e682, 0x111d6864, 0x118e68a2,
+    0x111d68e6, 0x118758e6, 0x111d7c64, 0x111d7ce6, 0x118e7824, 0x0118f686,
+    0x118f68e2, 0x118f6824, 0x118f68a6, 0x118f78e6, 0x08292482, 0x08292ca2,
+    0x00829286, 0x82928682, 0x082928e2, 0x82928ea2, 0x08292144, 0x82921486,
+    0x82921c24, 0x82921ca6, 0x82921864, 0x082934c2, 0x08293ce2, 0x08293864,
+    0x829386c2, 0x082938e6, 0x82938ee2, 0x11964482, 0x82931444, 0x829314c6,
+    0x82931c64, 0x11964ca2, 0x82931ce6, 0x01196486, 0x119648e2, 0x01196544,
+    0x11965486, 0x11965c24, 0x11965ca6, 0x11965864, 0x829a2482, 0x829a2ca2,
+    0x0829a286, 0x829a28e2, 0x0829a344, 0x829a3486, 0x829a3c24, 0x829a3ca6,
+    0x829a3864, 0x119744c2, 0x829b24c2, 0x011974c6, 0x0829b2c6, 0x11974ce2,
+    0x829b2ce2, 0x11974864, 0x829b2864, 0x119748e6, 0x829b28e6, 0x119e6482,
+    0x829b3444, 0x829b34c6, 0x0119e6c2, 0x829b3c64, 0x119e6ca2, 0x829b3ce6,
+    0x0119e686, 0x119e68e2, 0x11975444, 0x119754c6, 0x11975c64, 0x11975ce6,
+    0x0119e744, 0x119e7486, 0x119e7c24, 0x119e7ca6, 0x119e7864, 0x0119f644,
+    0x119f64c2, 0x0119f6c6, 0x119f6ce2, 0x119f6864, 0x119f68e6, 0x119f7444,
+    0x119f74c6, 0x119f7c64, 0x119f7ce6, 0x82114824, 0x821148a6, 0x8211c286,
+    0x8211ca24, 0x8211caa6, 0x08211486, 0x821148e2, 0x08211c24, 0x8211c2c2,
+    0x08211ca6, 0x8211cae2, 0x11144482, 0x82182482, 0x11144ca2, 0x82182ca2,
+    0x82192486, 0x82192c24, 0x82192ca6, 0x111c6482, 0x111c6ca2, 0x11154486,
+    0x11154c24, 0x11154ca6, 0x111d6486, 0x111d6c24, 0x111d6ca6, 0x82821824,
+    0x828218a6, 0x082821c2, 0x08282186, 0x828218e2, 0x82182482, 0x82111444,
+    0x82182482, 0x82821824, 0x821114c6, 0x828218a6, 0x082182c2, 0x82111c64,
+    0x82182ca2, 0x82111ce6, 0x11824482, 0x82821144, 0x82828282, 0x828211c6,
+    0x11824482, 0x82828282, 0x82182144, 0x11114444, 0x11824482, 0x82118244,
+    0x82828282, 0x111144c6, 0x821182c6, 0x82828386, 0x11824586, 0x08218344,
+    0x821834c2, 0x82183486, 0x82183c24, 0x82183ca6, 0x828292c2, 0x82829286,
+    0x111864c2, 0x1182c682, 0x82829344, 0x828293c6, 0x1182c682, 0x1111c644,
+    0x1182c682, 0x1111c6c6, 0x11186544, 0x1182c786, 0x118254c2, 0x11825486,
+    0x8218a2c2, 0x8218a344, 0x11825544, 0x118255c6, 0x11187444, 0x8218b244,
+    0x1182d6c2, 0x1182d686, 0x1118e6c2, 0x1182d744, 0x1182d7c6, 0x1118e744,
+    0x1118f644, 0x82831486, 0x82831c24, 0x82831ca6, 0x08283144, 0x828314c2,
+    0x082831c6, 0x82831ce2, 0x821924c2, 0x82831864, 0x828318e6, 0x082192c6,
+    0x82192ce2, 0x118344c2, 0x828382c2, 0x11834486, 0x82838286, 0x82838344,
+    0x11834544, 0x82193444, 0x821934c6, 0x82193c64, 0x82193ce6, 0x82839244,
+    0x828392c6, 0x11196444, 0x111964c6, 0x1183c6c2, 0x1183c686, 0x1183c744,
+    0x11835444, 0x118354c6, 0x8219a244, 0x8219a2c6, 0x1183d644, 0x1183d6c6,
+    0x1119e644, 0x1119e6c6, 0x0828a282, 0x0828a282, 0x828a28a2, 0x828a28a2,
+    0x828a2186, 0x0828a3c2, 0x0828a386, 0x828a38e2, 0x828a3824, 0x828a38a6,
+    0x118a6482, 0x828a3144, 0x828a31c6, 0x118a6482, 0x118a6586, 0x828aa282,
+    0x828aa282, 0x828aa282, 0x828aa386, 0x118a74c2, 0x828ab2c2, 0x118a7486,
+    0x828ab286, 0x118ae682, 0x828ab344, 0x828ab3c6, 0x118ae682, 0x118ae682,
+    0x118a7544, 0x118a75c6, 0x118ae786, 0x118af6c2, 0x118af686, 0x118af744,
+    0x118af7c6, 0x828b2482, 0x0828b2c2, 0x828b2ca2, 0x0828b286, 0x828b28e2,
+    0x828b2144, 0x0828b344, 0x828b34c2, 0x0828b3c6, 0x828b3ce2, 0x828b3864,
+    0x828b38e6, 0x118b64c2, 0x118b6486, 0x118b6544, 0x828ba2c2, 0x828ba286,
+    0x828ba344, 0x118b7444, 0x828bb244, 0x118b74c6, 0x828bb2c6, 0x118be6c2,
+    0x118be686, 0x118be744, 0x118bf644, 0x118bf6c6, 0x08292144, 0x829214c2,
+    0x82921486, 0x82921c24, 0x82921ca6, 0x119244c2, 0x829282c2, 0x82928344,
+    0x11924544, 0x82929244, 0x1192c6c2, 0x1192c744, 0x11925444, 0x1192d644,
+    0x82931444, 0x829314c6, 0x82931c64, 0x82931ce6, 0x119344c6, 0x829382c6,
+    0x1193c644, 0x1193c6c6, 0x829a2482, 0x829a2482, 0x0829a2c2, 0x829a2ca2,
+    0x829a2144, 0x0829a344, 0x829a34c2, 0x829a3486, 0x829a3c24, 0x829a3ca6,
+    0x119a64c2, 0x119a6544, 0x829aa2c2, 0x829aa344, 0x119a7444, 0x829ab244,
+    0x119ae6c2, 0x119ae744, 0x119af644, 0x829b24c2, 0x0829b2c6, 0x829b2ce2,
+    0x829b3444, 0x829b34c6, 0x829b3c64, 0x829b3ce6, 0x119b64c6, 0x829ba2c6,
+    0x119be644, 0x119be6c6, 0x08348282, 0x08348aa2, 0x08358286, 0x08358a24,
+    0x08358aa6, 0x08314824, 0x831482c2, 0x083148a6, 0x83148ae2, 0x83868282,
+    0x083868a2, 0x83868aa2, 0x83158244, 0x831582c6, 0x83158a64, 0x83158ae6,
+    0x83878286, 0x83878a24, 0x83878aa6, 0x08396824, 0x839682c2, 0x083968a6,
+    0x83968ae2, 0x83978244, 0x839782c6, 0x83978a64, 0x83978ae6, 0x08314ca2,
+    0x83148682, 0x83148ea2, 0x08315ca6, 0x83158686, 0x83158e24, 0x83158ea6,
+    0x083114c6, 0x83114ce2, 0x83114864, 0x838248a2, 0x831148e6, 0x83186ca2,
+    0x08318686, 0x831868e2, 0x83115ce6, 0x83825824, 0x83187864, 0x83834824,
+    0x838348a6, 0x083196c6, 0x83196ce2, 0x83196864, 0x831968e6, 0x83197ce6,
+    0x838a68a2, 0x838a7824, 0x838b6824, 0x838b68a6, 0x83924482, 0x83924ca2,
+    0x08392486, 0x839248e2, 0x08392544, 0x83925486, 0x83925c24, 0x83925ca6,
+    0x83925864, 0x839344c2, 0x083934c6, 0x83934ce2, 0x83934864, 0x839348e6,
+    0x83935444, 0x839354c6, 0x83935c64, 0x83935ce6, 0x839a6482, 0x0839a6c2,
+    0x839a6ca2, 0x0839a686, 0x839a68e2, 0x0839a744, 0x839a7486, 0x839a7c24,
+    0x839a7ca6, 0x839a7864, 0x839b64c2, 0x0839b6c6, 0x839b6ce2, 0x839b6864,
+    0x839b68e6, 0x839b7444, 0x839b74c6, 0x839b7c64, 0x839b7ce6, 0x831448a2,
+    0x8314c282, 0x8314caa2, 0x83154824, 0x831548a6, 0x8315c286, 0x8315ca24,
+    0x8315caa6, 0x83114486, 0x83114c24, 0x83114ca6, 0x83186482, 0x83186ca2,
+    0x83196486, 0x83196c24, 0x83196ca6, 0x838248a2, 0x83825824, 0x838258a6,
+    0x838214c2, 0x83821486, 0x831824c2, 0x83828682, 0x831186c6, 0x838215c6,
+    0x83182544, 0x83828786, 0x83183444, 0x838296c2, 0x83829686, 0x838297c6,
+    0x8318a6c2, 0x8318a744, 0x8318b644, 0x83834482, 0x83834ca2, 0x83835486,
+    0x83835c24, 0x83835ca6, 0x83831444, 0x838314c6, 0x831924c6, 0x838386c2,
+    0x83838686, 0x83838744, 0x83839644, 0x838396c6, 0x8319a6c6, 0x838a2482,
+    0x838a2586, 0x838a34c2, 0x838a3486, 0x838a35c6, 0x838aa682, 0x838aa786,
+    0x838ab6c2, 0x838ab686, 0x838ab7c6, 0x838b24c2, 0x838b2486, 0x838b2544,
+    0x838b3444, 0x838b34c6, 0x838ba6c2, 0x838ba686, 0x838ba744, 0x838bb644,
+    0x838bb6c6, 0x83921444, 0x839286c2, 0x83928744, 0x83929644, 0x839386c6,
+    0x839a2544, 0x839a3444, 0x839aa6c2, 0x839aa744, 0x839ab644, 0x839b24c6,
+    0x839ba6c6, 0x09248282, 0x009248a2, 0x09248aa2, 0x92418286, 0x92418a24,
+    0x92418aa6, 0x92c28282, 0x092c28a2, 0x92c28aa2, 0x92c38286, 0x92c38a24,
+    0x92c38aa6, 0x00925824, 0x092582c2, 0x009258a6, 0x09258ae2, 0x92518244,
+    0x925182c6, 0x92518a64, 0x92518ae6, 0x092d2824, 0x92d282c2, 0x092d28a6,
+    0x92d28ae2, 0x92d38244, 0x92d382c6, 0x92d38a64, 0x92d38ae6, 0x00921486,
+    0x92148682, 0x092148e2, 0x92148ea2, 0x92141864, 0x92868282, 0x092868a2,
+    0x92868aa2, 0x92861824, 0x0921c286, 0x921c28e2, 0x921c3864, 0x09215864,
+    0x921586c2, 0x092158e6, 0x92158ee2, 0x09287824, 0x928782c2, 0x092878a6,
+    0x92878ae2, 0x921d2864, 0x928e28a2, 0x921d28e6, 0x928e3824, 0x928f2824,
+    0x928f28a6, 0x09296482, 0x09296ca2, 0x00929686, 0x92968682, 0x092968e2,
+    0x92968ea2, 0x92961486, 0x92961c24, 0x92961ca6, 0x92961864, 0x092974c2,
+    0x09297ce2, 0x09297864, 0x929786c2, 0x092978e6, 0x92978ee2, 0x92971444,
+    0x929e2482, 0x929714c6, 0x92971c64, 0x929e2ca2, 0x92971ce6, 0x0929e286,
+    0x929e28e2, 0x929e3c24, 0x929e3ca6, 0x929e3864, 0x929f24c2, 0x929f2ce2,
+    0x929f2864, 0x929f28e6, 0x929f34c6, 0x929f3c64, 0x929f3ce6, 0x09214482,
+    0x921448a2, 0x9214c282, 0x09214ca2, 0x9214caa2, 0x921c2482, 0x921c2ca2,
+    0x09215486, 0x921548e2, 0x09215c24, 0x9215c2c2, 0x09215ca6, 0x9215cae2,
+    0x921d2486, 0x921d2c24, 0x921d2ca6, 0x09282482, 0x928248a2, 0x921144c2,
+    0x928248a2, 0x092114c6, 0x92114ce2, 0x92186482, 0x92186482, 0x92186ca2,
+    0x9282c282, 0x92186144, 0x9211c2c6, 0x092825c2, 0x09282586, 0x928258e2,
+    0x92115444, 0x92825824, 0x921154c6, 0x928258a6, 0x92115c64, 0x92115ce6,
+    0x928251c6, 0x09218744, 0x921874c2, 0x92187486, 0x92187c24, 0x92187ca6,
+    0x9282d2c2, 0x9282d286, 0x9282d3c6, 0x9218e344, 0x9218f244, 0x92834482,
+    0x092834c2, 0x92834ca2, 0x928348e2, 0x92834144, 0x921964c2, 0x092196c6,
+    0x92196ce2, 0x9283c2c2, 0x9283c286, 0x9283c344, 0x09283544, 0x928354c2,
+    0x092835c6, 0x92835ce2, 0x92835864, 0x928358e6, 0x92197444, 0x921974c6,
+    0x92197c64, 0x92197ce6, 0x9283d244, 0x9283d2c6, 0x9219e2c6, 0x0928a682,
+    0x928a68a2, 0x928a68a2, 0x0928a7c2, 0x0928a786, 0x928a78e2, 0x928a7824,
+    0x928a78a6, 0x928a71c6, 0x928ae282, 0x928af2c2, 0x928af286, 0x928af3c6,
+    0x928b6482, 0x0928b6c2, 0x928b6ca2, 0x928b68e2, 0x928b6144, 0x0928b744,
+    0x928b74c2, 0x0928b7c6, 0x928b7ce2, 0x928b7864, 0x928b78e6, 0x928be2c2,
+    0x928be286, 0x928be344, 0x928bf244, 0x928bf2c6, 0x92924482, 0x92924482,
+    0x92924ca2, 0x92924144, 0x9292c344, 0x09292544, 0x929254c2, 0x92925486,
+    0x92925c24, 0x92925ca6, 0x9292d244, 0x929344c2, 0x092934c6, 0x92934ce2,
+    0x9293c2c6, 0x92935444, 0x929354c6, 0x92935c64, 0x92935ce6, 0x929a6482,
+    0x929a6482, 0x929a6ca2, 0x929a6144, 0x0929a744, 0x929a74c2, 0x929a7486,
+    0x929a7c24, 0x929a7ca6, 0x929ae344, 0x929af244, 0x929b64c2, 0x0929b6c6,
+    0x929b6ce2, 0x929b7444, 0x929b74c6, 0x929b7c64, 0x929b7ce6, 0x929be2c6,
+    0x93448282, 0x093448a2, 0x93448aa2, 0x93458286, 0x93458a24, 0x93458aa6,
+    0x93c68282, 0x093c68a2, 0x93c68aa2, 0x93c78286, 0x93c78a24, 0x93c78aa6,
+    0x09354824, 0x935482c2, 0x093548a6, 0x93548ae2, 0x93558244, 0x935582c6,
+    0x93558a64, 0x93558ae6, 0x093d6824, 0x93d682c2, 0x093d68a6, 0x93d68ae2,
+    0x93d78244, 0x93d782c6, 0x93d78a64, 0x93d78ae6, 0x931448e2, 0x93145864,
+    0x938648a2, 0x931c68e2, 0x93865824, 0x931c7864, 0x93154864, 0x931548e6,
+    0x93874824, 0x938748a6, 0x931d6864, 0x938e68a2, 0x931d68e6, 0x938e7824,
+    0x938f6824, 0x938f68a6, 0x93964ca2, 0x939648e2, 0x93965ca6, 0x93965864,
+    0x93974ce2, 0x93974864, 0x939748e6, 0x939e6ca2, 0x939e68e2, 0x93975ce6,
+    0x939e7864, 0x0939f6c6, 0x939f6ce2, 0x939f6864, 0x939f68e6, 0x939f7ce6,
+    0x93144482, 0x93144ca2, 0x931c6482, 0x931c6ca2, 0x93154486, 0x93154c24,
+    0x93154ca6, 0x931d6486, 0x931d6c24, 0x931d6ca6, 0x93824482, 0x931144c6,
+    0x9382c682, 0x9311c6c6, 0x93186544, 0x93825486, 0x938255c6, 0x93187444,
+    0x9382d686, 0x9382d7c6, 0x9318e744, 0x9318f644, 0x938344c2, 0x93834544,
+    0x931964c6, 0x9383c6c2, 0x9383c744, 0x93835444, 0x938354c6, 0x9383d644,
+    0x9383d6c6, 0x9319e6c6, 0x938a6482, 0x938a7486, 0x938ae682, 0x938a75c6,
+    0x938af686, 0x938af7c6, 0x938b64c2, 0x938b6544, 0x938b7444, 0x938b74c6,
+    0x938be6c2, 0x938be744, 0x938bf644, 0x938bf6c6, 0x93924544, 0x9392c744,
+    0x93925444, 0x9392d644, 0x9393c6c6, 0x939a6544, 0x939a7444, 0x939ae744,
+    0x939af644, 0x939be6c6, 0x011448a2, 0x11448282, 0x11448aa2, 0x01145824,
+    0x011458a6, 0x11458286, 0x11458a24, 0x11458aa6, 0x114148e2, 0x11414824,
+    0x114148a6, 0x114868a2, 0x114868a2, 0x11415864, 0x114158e6, 0x11487824,
+    0x114878a6, 0x11487824, 0x114968e2, 0x11496824, 0x114968a6, 0x11497864,
+    0x114978e6, 0x11c248a2, 0x11c25824, 0x11c258a6, 0x11c25824, 0x11c34824,
+    0x11c348a6, 0x11c35864, 0x11c358e6, 0x11ca68a2, 0x11ca68a2, 0x11ca7824,
+    0x11ca78a6, 0x11ca7824, 0x11cb68e2, 0x11cb6824, 0x11cb68a6, 0x11cb7864,
+    0x11cb78e6, 0x11548682, 0x11548ea2, 0x01155486, 0x01155ca6, 0x11558686,
+    0x11558e24, 0x11558ea6, 0x11514864, 0x115148e6, 0x115868e2, 0x11515444,
+    0x115154c6, 0x11515ce6, 0x01158744, 0x11587486, 0x11587c24, 0x11587ca6,
+    0x11587864, 0x11596864, 0x115968e6, 0x11597444, 0x115974c6, 0x11597c64,
+    0x11597ce6, 0x11d248e2, 0x11d25864, 0x11d34864, 0x11d348e6, 0x11da68e2,
+    0x011da744, 0x11da7486, 0x11da7ca6, 0x11da7864, 0x11db6864, 0x11db68e6,
+    0x11db7444, 0x11db74c6, 0x11db7ce6, 0x11141444, 0x11148744, 0x11149644,
+    0x118648a2, 0x11865824, 0x118658a6, 0x11861486, 0x11868682, 0x111c2544,
+    0x111c3444, 0x11869686, 0x111ca744, 0x111cb644, 0x11874482, 0x11874ca2,
+    0x11875486, 0x11875c24, 0x11875ca6, 0x11871444, 0x118e2482, 0x118714c6,
+    0x118786c2, 0x11878744, 0x118e3486, 0x11879644, 0x118796c6, 0x118ea682,
+    0x118eb686, 0x118f24c2, 0x118f2544, 0x118f3444, 0x118f34c6, 0x118fa6c2,
+    0x118fa744, 0x118fb644, 0x118fb6c6, 0x11968744, 0x11969644, 0x119e2544,
+    0x119ea744, 0x119eb644, 0x082182c2, 0x08218ae2, 0x82118244, 0x82828282,
+    0x821182c6, 0x082828a2, 0x82118a64, 0x82828aa2, 0x82118ae6, 0x82838286,
+    0x82838a24, 0x82838aa6, 0x08292824, 0x829282c2, 0x082928a6, 0x82928ae2,
+    0x82938244, 0x829382c6, 0x82938a64, 0x82938ae6, 0x82118686, 0x82118e24,
+    0x82118ea6, 0x11448282, 0x82828282, 0x821186c2, 0x11448aa2, 0x82828aa2,
+    0x82118ee2, 0x11441824, 0x82821824, 0x821828e2, 0x82183864, 0x828382c2,
+    0x82838ae2, 0x82192864, 0x114c28a2, 0x821928e6, 0x114c3824, 0x114582c2,
+    0x11458ae2, 0x828a28a2, 0x828a3824, 0x114d2824, 0x828b2824, 0x114d28a6,
+    0x828b28a6, 0x82921864, 0x11c68282, 0x829386c2, 0x11c68aa2, 0x82938ee2,
+    0x11c61824, 0x829a28e2, 0x829a3864, 0x11c782c2, 0x11c78ae2, 0x829b2864,
+    0x11ce28a2, 0x829b28e6, 0x11ce3824, 0x11cf2824, 0x11cf28a6, 0x11541864,
+    0x115c28e2, 0x115c3864, 0x115586c2, 0x11558ee2, 0x115d2864, 0x115d28e6,
+    0x11d61864, 0x11d786c2, 0x11d78ee2, 0x11de28e2, 0x11de3864, 0x11df2864,
+    0x11df28e6, 0x82182482, 0x82182ca2, 0x82192486, 0x82192c24, 0x82192ca6,
+    0x82828282, 0x11144144, 0x82182144, 0x82829286, 0x1114c344, 0x8218a344,
+    0x1186c282, 0x82839244, 0x828392c6, 0x111c6144, 0x1186d286, 0x111ce344,
+    0x828aa282, 0x828ab286, 0x1187d244, 0x118ee282, 0x828bb244, 0x1187d2c6,
+    0x828bb2c6, 0x118ef286, 0x118ff244, 0x118ff2c6, 0x82928344, 0x1196c344,
+    0x829aa344, 0x119ee344, 0x82148282, 0x82148aa2, 0x82158286, 0x82158a24,
+    0x82158aa6, 0x82114824, 0x821148a6, 0x821868a2, 0x82196824, 0x821968a6,
+    0x18248282, 0x018248a2, 0x18248aa2, 0x18241824, 0x82114482, 0x182418a6,
+    0x18241824, 0x821148e2, 0x82115c24, 0x82115ca6, 0x82115864, 0x18241824,
+    0x182418a6, 0x182c28a2, 0x182c3824, 0x182c38a6, 0x18258682, 0x018258e2,
+    0x18258ea2, 0x18251864, 0x18251864, 0x182518e6, 0x182d28e2, 0x182d3864,
+    0x182d38e6, 0x18214ca2, 0x18214144, 0x182868a2, 0x182868a2, 0x821834c2,
+    0x18286186, 0x182154c2, 0x18215ce2, 0x18287482, 0x018287c2, 0x18287ca2,
+    0x182878e2, 0x182871c6, 0x1828e386, 0x1828f2c2, 0x1828f3c6, 0x82192544,
+    0x18296ca2, 0x18296144, 0x182974c2, 0x18297ce2, 0x183448a2, 0x18345824,
+    0x18354ca2, 0x183548e2, 0x18355486, 0x18355c24, 0x18355ca6, 0x18355864,
+    0x18314544, 0x183874c2, 0x18396544, 0x08348282, 0x08348aa2, 0x83418286,
+    0x83418a24, 0x83418aa6, 0x83c28282, 0x083c28a2, 0x83c28aa2, 0x83c38286,
+    0x83c38a24, 0x83c38aa6, 0x083582c2, 0x08358ae2, 0x83518244, 0x835182c6,
+    0x83518a64, 0x83518ae6, 0x83d282c2, 0x083d28a6, 0x83d28ae2, 0x83d38244,
+    0x83d382c6, 0x83d38a64, 0x83d38ae6, 0x83148682, 0x83148ea2, 0x83141864,
+    0x83868282, 0x83868aa2, 0x83861824, 0x831c28e2, 0x831c3864, 0x831586c2,
+    0x83158ee2, 0x838782c2, 0x83878ae2, 0x831d2864, 0x838e28a2, 0x831d28e6,
+    0x838e3824, 0x838f28a6, 0x83968682, 0x83968ea2, 0x83961864, 0x839786c2,
+    0x83978ee2, 0x839e28e2, 0x839e3864, 0x839f2864, 0x839f28e6, 0x831448a2,
+    0x8314c282, 0x8314caa2, 0x831c2ca2, 0x831548e2, 0x8315c2c2, 0x8315cae2,
+    0x831d2486, 0x831d2ca6, 0x838248a2, 0x83186482, 0x83186144, 0x838258e2,
+    0x831874c2, 0x8382d286, 0x8318e344, 0x83834ca2, 0x8383c2c2, 0x838354c2,
+    0x83835ce2, 0x8383d2c6, 0x838a68a2, 0x838a78e2, 0x838af286, 0x838b6ca2,
+    0x838b74c2, 0x838b7ce2, 0x838be2c2, 0x838bf2c6, 0x83924482, 0x83924144,
+    0x8392c344, 0x839254c2, 0x839a6482, 0x839a6144, 0x839a74c2, 0x839ae344,
+    0x831448a2, 0x831c68a2, 0x831548a6, 0x831d68a6, 0x192448a2, 0x192458a6,
+    0x192c68a2, 0x192c78a6, 0x192548e2, 0x19255864, 0x192558e6, 0x192d68e2,
+    0x192d7864, 0x192d78e6, 0x192875c6, 0x1928f7c6, 0x8a218286, 0x8a218a24,
+    0x8a218aa6, 0x8a2182c2, 0x08a218a6, 0x8a218ae2, 0x8a2828a2, 0x8a2928a6,
+    0x8a218682, 0x08a218e2, 0x8a218ea2, 0x8a211864, 0x8a2828a2, 0x8a2118e6,
+    0x8a2838a6, 0x8a2928e2, 0x8a2938e6, 0x8a211486, 0x8a211ca6, 0x8a2828a2,
+    0x8a211ce2, 0x8a283ca2, 0x8a2838e2, 0x8a2831c6, 0x8a28b3c6, 0x8a292ca2,
+    0x8a292144, 0x8a293ce2, 0x8a348282, 0x8a348aa2, 0x8a358286, 0x8a358a24,
+    0x8a358aa6, 0x8a3148a6, 0x8a3968a6, 0x8a3148e2, 0x8a315864, 0x8a392544,
+    0x8b248282, 0x8b248aa2, 0x8b2582c2, 0x08b258a6, 0x8b258ae2, 0x8b2d28a6,
+    0x8b2148e2, 0x8b2158e6, 0x8b2878a6, 0x8b2968e2, 0x8b2978e6, 0x8b215486,
+    0x8b215ca6, 0x8b2835c6, 0x8b28b7c6, 0x8b3548a6, 0x8b3d68a6, 0x92145824,
+    0x92155864, 0x92114544, 0x92196544, 0x93448282, 0x93448aa2, 0x93441824,
+    0x934c3824, 0x934582c2, 0x93458ae2, 0x934d28a6, 0x93c68282, 0x93c68aa2,
+    0x93c61824, 0x93c782c2, 0x93c78ae2, 0x93ce3824, 0x93cf28a6, 0x93541864,
+    0x935c3864, 0x935586c2, 0x93558ee2, 0x935d28e6, 0x93d61864, 0x93d786c2,
+    0x93d78ee2, 0x93de3864, 0x93df28e6, 0x93144144, 0x9314c344, 0x931c6144,
+    0x931ce344, 0x9387d2c6, 0x938ff2c6, 0x9396c344, 0x939ee344, 0x9a248282,
+    0x9a248aa2, 0x9a241824, 0x9a2418a6, 0x9a2c38a6, 0x9a258682, 0x9a258ea2,
+    0x9a251864, 0x9a2518e6, 0x9a2d38e6, 0x9a214144, 0x9a287ca2, 0x9a296144,
+    0x9a345824, 0x9a355ca6, 0x9a355864, 0x9a314544, 0x9a396544, 0x9b2558e6,
+    0x9b2d78e6, 0x11448282, 0x11448aa2, 0x11458286, 0x11458a24, 0x11458aa6,
+    0x11554824, 0x115548a6, 0x1155c286, 0x1155caa6, 0x11582544, 0x1158a744,
+    0x11d28744, 0x11daa744, 0x01418286, 0x01418a24, 0x01418aa6, 0x14118244,
+    0x14828282, 0x141182c6, 0x014828a2, 0x14118a64, 0x14828aa2, 0x14118ae6,
+    0x14838a24, 0x14838aa6, 0x01492824, 0x149282c2, 0x014928a6, 0x14928ae2,
+    0x149382c6, 0x14938a64, 0x14938ae6, 0x14118686, 0x14118e24, 0x14118ea6,
+    0x14821824, 0x01418286, 0x141828e2, 0x14183864, 0x14192864, 0x141928e6,
+    0x0148a282, 0x148a28a2, 0x148a3824, 0x148b2824, 0x148b28a6, 0x14921864,
+    0x0149a286, 0x149a28e2, 0x149a3864, 0x149b2864, 0x149b28e6, 0x14114824,
+    0x141148a6, 0x1411c286, 0x1411ca24, 0x1411caa6, 0x14182482, 0x14182ca2,
+    0x14192486, 0x14192c24, 0x14192ca6, 0x14821824, 0x148218a6, 0x14821144,
+    0x14828282, 0x148211c6, 0x14828282, 0x14182144, 0x14118244, 0x14828282,
+    0x141182c6, 0x01482834, 0x14828386, 0x01482924, 0x148292c2, 0x14829286,
+    0x14829344, 0x148293c6, 0x01418a24, 0x1418a2c2, 0x1418a344, 0x1418b244,
+    0x14831486, 0x14831c24, 0x14831ca6, 0x01483824, 0x148382c2, 0x14838286,
+    0x14838344, 0x14839244, 0x148392c6, 0x1419a244, 0x1419a2c6, 0x0148a214,
+    0x148a2186, 0x148a3144, 0x148a31c6, 0x148aa282, 0x148aa282, 0x148aa282,
+    0x0148aa34, 0x148aa386, 0x0148ab24, 0x148ab2c2, 0x148ab286, 0x148ab344,
+    0x148ab3c6, 0x148b2144, 0x0148ba24, 0x148ba2c2, 0x148ba286, 0x148ba344,
+    0x148bb244, 0x148bb2c6, 0x01492824, 0x149282c2, 0x14928344, 0x14929244,
+    0x14938244, 0x149382c6, 0x149a2144, 0x0149aa24, 0x149aa2c2, 0x149aa344,
+    0x149ab244, 0x149ba244, 0x149ba2c6, 0x01548aa2, 0x01558aa6, 0x015148a6,
+    0x15148ae2, 0x15868aa2, 0x15158ae6, 0x015968a6, 0x15968ae2, 0x15978ae6,
+    0x15148682, 0x15148ea2, 0x15158686, 0x15158e24, 0x15158ea6, 0x01582482,
+    0x15114864, 0x158248a2, 0x151148e6, 0x01518686, 0x151868e2, 0x15825824,
+    0x15187864, 0x15834824, 0x158348a6, 0x15196864, 0x151968e6, 0x0158a682,
+    0x158a68a2, 0x158a7824, 0x158b6824, 0x158b68a6, 0x01592486, 0x159248e2,
+    0x15925864, 0x15934864, 0x159348e6, 0x0159a686, 0x159a68e2, 0x159a7864,
+    0x159b6864, 0x159b68e6, 0x151448a2, 0x1514c282, 0x1514caa2, 0x15154824,
+    0x151548a6, 0x1515c286, 0x1515ca24, 0x1515caa6, 0x15114486, 0x15114c24,
+    0x15114ca6, 0x15186482, 0x15186ca2, 0x15196486, 0x15196c24, 0x15196ca6,
+    0x158248a2, 0x15825824, 0x158258a6, 0x01582144, 0x158214c2, 0x15821486,
+    0x01518244, 0x151824c2, 0x15828682, 0x15828682, 0x15118644, 0x15828682,
+    0x151186c6, 0x15821544, 0x158215c6, 0x15182544, 0x01582874, 0x15828786,
+    0x15183444, 0x01582964, 0x158296c2, 0x15829686, 0x15829744, 0x158297c6,
+    0x01518a64, 0x1518a6c2, 0x1518a744, 0x1518b644, 0x15834482, 0x15834ca2,
+    0x15835486, 0x15835c24, 0x15835ca6, 0x15831444, 0x158314c6, 0x15192444,
+    0x151924c6, 0x01583864, 0x158386c2, 0x15838686, 0x15838744, 0x15839644,
+    0x158396c6, 0x1519a644, 0x1519a6c6, 0x158a2482, 0x158a2482, 0x158a2482,
+    0x0158a254, 0x158a2586, 0x0158a344, 0x158a34c2, 0x158a3486, 0x158a3544,
+    0x158a35c6, 0x158aa682, 0x158aa682, 0x158aa682, 0x0158aa74, 0x158aa786,
+    0x0158ab64, 0x158ab6c2, 0x158ab686, 0x158ab744, 0x158ab7c6, 0x0158b244,
+    0x158b24c2, 0x158b2486, 0x158b2544, 0x158b3444, 0x158b34c6, 0x0158ba64,
+    0x158ba6c2, 0x158ba686, 0x158ba744, 0x158bb644, 0x158bb6c6, 0x15921444,
+    0x01592864, 0x159286c2, 0x15928744, 0x15929644, 0x15938644, 0x159386c6,
+    0x0159a244, 0x159a24c2, 0x159a2544, 0x159a3444, 0x0159aa64, 0x159aa6c2,
+    0x159aa744, 0x159ab644, 0x159b2444, 0x159b24c6, 0x159ba644, 0x159ba6c6,
+    0x01141486, 0x114148e2, 0x01148682, 0x114868a2, 0x1141c286, 0x11415864,
+    0x114158e6, 0x11487824, 0x114878a6, 0x01149686, 0x114968e2, 0x11497864,
+    0x114978e6, 0x1149e286, 0x11414482, 0x11414ca2, 0x11415486, 0x11415c24,
+    0x11415ca6, 0x11482482, 0x11482482, 0x11411444, 0x11482482, 0x114114c6,
+    0x11482414, 0x01141864, 0x114186c2, 0x11482c34, 0x01148254, 0x114825c2,
+    0x11482586, 0x11418744, 0x11482d24, 0x11418e24, 0x01148344, 0x114834c2,
+    0x11483486, 0x11419644, 0x114196c6, 0x11483c24, 0x11483544, 0x114835c6,
+    0x1148a682, 0x1148a682, 0x1148a682, 0x1148a614, 0x01148a74, 0x1148a7c2,
+    0x1148a786, 0x1148ae34, 0x1148af24, 0x01148b64, 0x1148b6c2, 0x1148b686,
+    0x1148b744, 0x1148b7c6, 0x1148be24, 0x01149244, 0x114924c2, 0x11492c24,
+    0x11492544, 0x11493444, 0x114934c6, 0x01149a64, 0x1149a6c2, 0x1149a744,
+    0x1149ae24, 0x1149b644, 0x1149b6c6, 0x18611864, 0x186828a2, 0x186118e6,
+    0x186838a6, 0x01869286, 0x186928e2, 0x18693864, 0x186938e6, 0x1869a286,
+    0x18611486, 0x18611c24, 0x18611ca6, 0x01868214, 0x186821c2, 0x18682186,
+    0x01861824, 0x186182c2, 0x18682834, 0x18618344, 0x18682924, 0x18618a24,
+    0x18683144, 0x186831c6, 0x18619244, 0x186192c6, 0x18683824, 0x1868a282,
+    0x1868a282, 0x1868a282, 0x1868a214, 0x01868a34, 0x1868a3c2, 0x1868a386,
+    0x1868aa34, 0x1868ab24, 0x01868b24, 0x1868b2c2, 0x1868b286, 0x1868b344,
+    0x1868b3c6, 0x1868ba24, 0x18692144, 0x18692824, 0x01869a24, 0x1869a2c2,
+    0x1869a344, 0x1869aa24, 0x1869b244, 0x1869b2c6, 0x11596486, 0x1159e686,
+    0x11582454, 0x11518644, 0x11582c74, 0x11582544, 0x11582d64, 0x11518e64,
+    0x11583444, 0x11583c64, 0x1158a654, 0x1158a744, 0x1158ae74, 0x1158af64,
+    0x1158b644, 0x1158be64, 0x11592444, 0x11592c64, 0x1159a644, 0x1159ae64,
+    0x18792486, 0x1879a686, 0x18782144, 0x18718244, 0x18782874, 0x18782964,
+    0x18718a64, 0x18783864, 0x1878a254, 0x1878a344, 0x1878aa74, 0x1878ab64,
+    0x1878b244, 0x1878ba64, 0x18792864, 0x1879a244, 0x1879aa64, 0x01969686,
+    0x196968e2, 0x19697864, 0x196978e6, 0x19614482, 0x19614ca2, 0x19615486,
+    0x19615c24, 0x19615ca6, 0x19682482, 0x19682482, 0x19611444, 0x19682482,
+    0x196114c6, 0x19682414, 0x01961864, 0x196186c2, 0x19682c34, 0x01968254,
+    0x196825c2, 0x19682586, 0x19618744, 0x19682d24, 0x19618e24, 0x01968344,
+    0x196834c2, 0x19683486, 0x19619644, 0x196196c6, 0x19683c24, 0x19683544,
+    0x196835c6, 0x1968a682, 0x1968a682, 0x1968a682, 0x1968a614, 0x01968a74,
+    0x1968a7c2, 0x1968a786, 0x1968ae34, 0x1968af24, 0x01968b64, 0x1968b6c2,
+    0x1968b686, 0x1968b744, 0x1968b7c6, 0x1968be24, 0x01969244, 0x196924c2,
+    0x19692c24, 0x19692544, 0x19693444, 0x196934c6, 0x01969a64, 0x1969a6c2,
+    0x1969a744, 0x1969ae24, 0x1969b644, 0x1969b6c6, 0x19782454, 0x19718644,
+    0x19782c74, 0x19782544, 0x19782d64, 0x19718e64, 0x19783444, 0x19783c64,
+    0x1978a654, 0x1978a744, 0x1978ae74, 0x1978af64, 0x1978b644, 0x1978be64,
+    0x19792444, 0x19792c64, 0x1979a644, 0x1979ae64, 0x11448282, 0x114ca282,
+    0x11458286, 0x114da286, 0x11414824, 0x11486834, 0x11486924, 0x1141ca24,
+    0x1148e214, 0x11487824, 0x1148ea34, 0x1148eb24, 0x1148fa24, 0x11496824,
+    0x1149ea24, 0x11548682, 0x115c2482, 0x115ca682, 0x11558686, 0x115d2486,
+    0x115da686, 0x11514864, 0x11586144, 0x1151c244, 0x11586874, 0x11586964,
+    0x1151ca64, 0x11587864, 0x1158e254, 0x1158e344, 0x1158ea74, 0x1158eb64,
+    0x1158f244, 0x1158fa64, 0x11596864, 0x1159e244, 0x1159ea64, 0x01824186,
+    0x182418e2, 0x11144482, 0x18248282, 0x18249286, 0x1114c682, 0x11145486,
+    0x1114d686, 0x18248282, 0x18241144, 0x18248282, 0x182411c6, 0x18248214,
+    0x18248214, 0x11141444, 0x18241824, 0x01824834, 0x182483c2, 0x18248386,
+    0x11141c64, 0x11148654, 0x18248a34, 0x11148744, 0x18248b24, 0x11148e74,
+    0x11148f64, 0x182492c2, 0x18249344, 0x182493c6, 0x11149644, 0x18249a24,
+    0x11149e64, 0x118648a2, 0x1186c282, 0x01186586, 0x118658e2, 0x1186d286,
+    0x118614c2, 0x11868682, 0x11868682, 0x11868614, 0x11868614, 0x11861c24,
+    0x11861544, 0x118615c6, 0x01186874, 0x118687c2, 0x11868786, 0x11868e34,
+    0x11868f24, 0x118696c2, 0x11869744, 0x118697c6, 0x11869e24, 0x18258254,
+    0x18258344, 0x18259244, 0x11875486, 0x11871444, 0x11878654, 0x11878744,
+    0x11879644, 0x18349686, 0x18341864, 0x18348254, 0x18348344, 0x18348a74,
+    0x18348b64, 0x18349a64, 0x11965486, 0x1196d686, 0x11961c64, 0x11968654,
+    0x11968744, 0x11968e74, 0x11968f64, 0x11969644, 0x11969e64, 0x18a68282,
+    0x18a61144, 0x18a68282, 0x18a611c6, 0x18a68214, 0x18a68214, 0x018a6834,
+    0x18a683c2, 0x18a68386, 0x18a68a34, 0x18a68b24, 0x18a692c2, 0x18a69344,
+    0x18a693c6, 0x18a69a24, 0x18a78254, 0x18a78344, 0x18a79244, 0x18b61864,
+    0x18b68254, 0x18b68344, 0x18b68a74, 0x18b68b64, 0x18b69a64, 0x01924482,
+    0x192448a2, 0x1924c282, 0x01924586, 0x192458e2, 0x1924d286, 0x192414c2,
+    0x19248682, 0x19248682, 0x19248614, 0x19248614, 0x19241544, 0x192415c6,
+    0x01924874, 0x192487c2, 0x19248786, 0x19248e34, 0x19248f24, 0x192496c2,
+    0x19249744, 0x192497c6, 0x19255486, 0x19251444, 0x19258654, 0x19258744,
+    0x19259644, 0x1934c682, 0x19345486, 0x1934d686, 0x19341c64, 0x19348654,
+    0x19348744, 0x19348e74, 0x19348f64, 0x19349e64, 0x019a6586, 0x19a658e2,
+    0x19a6d286, 0x19a614c2, 0x19a68682, 0x19a68682, 0x19a68614, 0x19a68614,
+    0x19a61544, 0x19a615c6, 0x019a6874, 0x19a687c2, 0x19a68786, 0x19a68e34,
+    0x19a68f24, 0x19a696c2, 0x19a69744, 0x19a697c6, 0x19a71444, 0x19a78654,
+    0x19a78744, 0x19a79644, 0x19b6d686, 0x19b68654, 0x19b68744, 0x19b68e74,
+    0x19b68f64, 0x19b69e64, 0x11448214, 0x11441824, 0x11448a34, 0x11448b24,
+    0x11449a24, 0x114c2834, 0x114c2924, 0x114c3824, 0x114ca214, 0x114caa34,
+    0x114cab24, 0x114cba24, 0x11458a24, 0x114d2824, 0x114daa24, 0x11541864,
+    0x11548254, 0x11548344, 0x11548a74, 0x11548b64, 0x11549244, 0x11549a64,
+    0x115c2144, 0x115c2874, 0x115c2964, 0x115c3864, 0x115ca254, 0x115ca344,
+    0x115caa74, 0x115cab64, 0x115cb244, 0x115cba64, 0x11558244, 0x11558a64,
+    0x115d2864, 0x115da244, 0x115daa64, 0x11144144, 0x11144874, 0x11144964,
+    0x1114c254, 0x1114c344, 0x1114ca74, 0x1114cb64, 0x11864834, 0x11864924,
+    0x1186c214, 0x1186ca34, 0x1186cb24, 0x11964144, 0x11964874, 0x11964964,
+    0x1196c254, 0x1196c344, 0x1196ca74, 0x1196cb64, 0x18241824, 0x18248b24,
+    0x18249a24, 0x18251864, 0x18258344, 0x18258b64, 0x18259244, 0x18259a64,
+    0x18214482, 0x18214482, 0x01821454, 0x182145c2, 0x18214586, 0x18214d24,
+    0x18214144, 0x18214874, 0x18214964, 0x11824482, 0x11824414, 0x11824414,
+    0x11824c34, 0x118245c2, 0x18286186, 0x01828614, 0x182861c2, 0x18286186,
+    0x18286924, 0x01828614, 0x182861c2, 0x18286186, 0x18286834, 0x18286924,
+    0x182861c2, 0x18286834, 0x11186454, 0x11186c74, 0x18215544, 0x18215d64,
+    0x18287482, 0x18287586, 0x18287144, 0x18287964, 0x18287144, 0x11834454,
+    0x18296482, 0x18296482, 0x01829654, 0x182965c2, 0x18296586, 0x18296d24,
+    0x18296144, 0x18296874, 0x18296964, 0x18297544, 0x18297d64, 0x118a6482,
+    0x118a6414, 0x118a6414, 0x118a6c34, 0x118a65c2, 0x118b6454, 0x18344924,
+    0x1834cb24, 0x18345824, 0x1834da24, 0x18354144, 0x18354964, 0x1835c344,
+    0x1835cb64, 0x18355864, 0x1835d244, 0x1835da64, 0x18314454, 0x18314c74,
+    0x18314544, 0x18314d64, 0x11924454, 0x11924c74, 0x18386482, 0x18386482,
+    0x18386414, 0x18386c34, 0x01838654, 0x183865c2, 0x18386586, 0x18386d24,
+    0x18386874, 0x18387544, 0x18396454, 0x18396c74, 0x18396544, 0x18396d64,
+    0x119a6454, 0x119a6c74, 0x18a24186, 0x018a2414, 0x18a241c2, 0x18a24186,
+    0x18a24924, 0x018a2414, 0x18a241c2, 0x18a24186, 0x18a24834, 0x18a24924,
+    0x18a241c2, 0x18a24834, 0x18a25482, 0x18a25586, 0x18a25144, 0x18a25964,
+    0x18a25144, 0x18a34482, 0x18a34482, 0x018a3454, 0x18a345c2, 0x18a34586,
+    0x18a34d24, 0x18a34144, 0x18a34874, 0x18a34964, 0x18a35544, 0x18a35d64,
+    0x18aa6186, 0x018aa614, 0x18aa61c2, 0x18aa6186, 0x18aa6924, 0x018aa614,
+    0x18aa61c2, 0x18aa6186, 0x18aa6834, 0x18aa6924, 0x18aa61c2, 0x18aa6834,
+    0x18aa7482, 0x18aa7586, 0x18aa7144, 0x18aa7964, 0x18aa7144, 0x18ab6482,
+    0x18ab6482, 0x018ab654, 0x18ab65c2, 0x18ab6586, 0x18ab6d24, 0x18ab6144,
+    0x18ab6874, 0x18ab6964, 0x18ab7544, 0x18ab7d64, 0x18b24482, 0x18b24482,
+    0x18b24414, 0x18b24c34, 0x018b2454, 0x18b245c2, 0x18b24586, 0x18b24d24,
+    0x18b24874, 0x18b25544, 0x18b34454, 0x18b34c74, 0x18b34544, 0x18b34d64,
+    0x18ba6482, 0x18ba6482, 0x18ba6414, 0x18ba6c34, 0x018ba654, 0x18ba65c2,
+    0x18ba6586, 0x18ba6d24, 0x18ba6874, 0x18ba7544, 0x18bb6454, 0x18bb6c74,
+    0x18bb6544, 0x18bb6d64, 0x19214454, 0x19286482, 0x19286414, 0x19286414,
+    0x19286c34, 0x192865c2, 0x19296454, 0x19386454, 0x19386c74, 0x19a24482,
+    0x19a24414, 0x19a24414, 0x19a24c34, 0x19a245c2, 0x19a34454, 0x19aa6482,
+    0x19aa6414, 0x19aa6414, 0x19aa6c34, 0x19aa65c2, 0x19ab6454, 0x19b24454,
+    0x19b24c74, 0x19ba6454, 0x19ba6c74, 0x14182482, 0x14182ca2, 0x14192486,
+    0x14192c24, 0x14192ca6, 0x14821144, 0x14828282, 0x148211c6, 0x14828282,
+    0x14182144, 0x14118244, 0x14828282, 0x141182c6, 0x01482924, 0x148292c2,
+    0x14829286, 0x148293c6, 0x1418a2c2, 0x1418a344, 0x1418b244, 0x01483824,
+    0x148382c2, 0x14838286, 0x14838344, 0x14839244, 0x148392c6, 0x1419a244,
+    0x1419a2c6, 0x148a2186, 0x148a3144, 0x148a31c6, 0x148aa282, 0x148aa282,
+    0x148aa282, 0x148aa386, 0x0148ab24, 0x148ab2c2, 0x148ab286, 0x148ab344,
+    0x148ab3c6, 0x148b2144, 0x0148ba24, 0x148ba2c2, 0x148ba286, 0x148ba344,
+    0x148bb244, 0x148bb2c6, 0x149282c2, 0x14928344, 0x14929244, 0x14938244,
+    0x149382c6, 0x149a2144, 0x149aa2c2, 0x149aa344, 0x149ab244, 0x149ba244,
+    0x149ba2c6, 0x14183864, 0x1418a344, 0x1418ab64, 0x1418b244, 0x1418ba64,
+    0x1c211486, 0x1c211c24, 0x1c211ca6, 0x1c2182c2, 0x1c218344, 0x1c283144,
+    0x1c2831c6, 0x1c219244, 0x1c2192c6, 0x1c28a282, 0x1c28a282, 0x1c28a282,
+    0x01c28a34, 0x1c28a3c2, 0x1c28a386, 0x1c28ab24, 0x01c28b24, 0x1c28b2c2,
+    0x1c28b286, 0x1c28b344, 0x1c28b3c6, 0x1c28ba24, 0x1c292144, 0x1c29a2c2,
+    0x1c29a344, 0x1c29b244, 0x1c29b2c6, 0x1c38a344, 0x1c38ab64, 0x1c38b244,
+    0x1c38ba64, 0x151c2482, 0x151c2ca2, 0x151d2486, 0x151d2c24, 0x151d2ca6,
+    0x15186144, 0x1511c244, 0x1582c282, 0x1511c2c6, 0x1518e2c2, 0x1518e344,
+    0x1518f244, 0x1583c286, 0x1519e244, 0x1519e2c6, 0x158a6186, 0x158a7144,
+    0x158ae282, 0x158a71c6, 0x158ae282, 0x158ae282, 0x0158af24, 0x158af2c2,
+    0x158af286, 0x158af3c6, 0x158b6144, 0x0158be24, 0x158be2c2, 0x158be286,
+    0x158be344, 0x158bf244, 0x158bf2c6, 0x15924144, 0x1592c2c2, 0x1592c344,
+    0x1592d244, 0x1593c244, 0x1593c2c6, 0x159a6144, 0x159ae2c2, 0x159ae344,
+    0x159af244, 0x159be244, 0x159be2c6, 0x1518b644, 0x1518be64, 0x1d214482,
+    0x1d214ca2, 0x1d215486, 0x1d215c24, 0x1d215ca6, 0x1d211444, 0x1d282482,
+    0x1d2114c6, 0x1d2186c2, 0x1d218744, 0x1d283486, 0x1d219644, 0x1d2196c6,
+    0x1d28a682, 0x01d28b64, 0x1d28b6c2, 0x1d28b686, 0x1d28b744, 0x1d28b7c6,
+    0x1d2924c2, 0x1d292544, 0x1d293444, 0x1d2934c6, 0x1d29a6c2, 0x1d29a744,
+    0x1d29b644, 0x1d29b6c6, 0x11486924, 0x11487824, 0x1148eb24, 0x1148fa24,
+    0x11418744, 0x18683824, 0x1868ab24, 0x1868ba24, 0x11c28682, 0x11c287c2,
+    0x11c28e34, 0x11c28f24, 0x11c38744, 0x11587c24, 0x1158ef24, 0x1158fe24,
+    0x1878be24, 0x11d28744, 0x18e28b24, 0x11d28f64, 0x19686924, 0x19687824,
+    0x1968eb24, 0x1968fa24, 0x19618744, 0x19787c24, 0x1978ef24, 0x1978fe24,
+    0x19e287c2, 0x19f28f64, 0x11441824, 0x11448b24, 0x11449a24, 0x114c2924,
+    0x114c3824, 0x114cab24, 0x114cba24, 0x11c24834, 0x11c2c214, 0x11c2ca34,
+    0x11541c24, 0x11548f24, 0x11549e24, 0x115c2d24, 0x115c3c24, 0x115caf24,
+    0x115cbe24, 0x11d24874, 0x11d2c254, 0x11d2ca74, 0x18241824, 0x18249a24,
+    0x18259e24, 0x18355c24, 0x1835de24, 0x18b7de24,
+};
+
+static const struct tablebase_entry tablebase_entries[] = {
+    {0x000000000009, 0, 1},
+    {0x000000000059, 1, 1},
+    {0x000000000249, 2, 1},
+    {0x0000000002d9, 3, 1},
+    {0x00000000100a, 4, 1},
+    {0x000000001049, 5, 1},
+    {0x00000000105a, 6, 1},
+    {0x00000000124a, 7, 1},
+    {0x0000000012c9, 8, 1},
+    {0x0000000012da, 9, 1},
+    {0x000000008061, 10, 1},
+    {0x000000008251, 11, 1},
+    {0x0000000082e1, 12, 1},
+    {0x000000009009, 13, 2},
+    {0x000000009012, 15, 1},
+    {0x000000009048, 16, 1},
+    {0x000000009051, 17, 1},
+    {0x000000009059, 18, 1},
+    {0x000000009062, 19, 1},
+    {0x000000009249, 20, 2},
+    {0x000000009252, 22, 1},
+    {0x0000000092c8, 23, 1},
+    {0x0000000092d1, 24, 1},
+    {0x0000000092d9, 25, 1},
+    {0x0000000092e2, 26, 1},
+    {0x00000000a049, 27, 1},
+    {0x00000000a05a, 28, 1},
+    {0x00000000a24a, 29, 1},
+    {0x00000000a2c9, 30, 1},
+    {0x00000000a2da, 31, 1},
+    {0x000000011050, 32, 1},
+    {0x000000011061, 33, 1},
+    {0x000000011248, 34, 1},
+    {0x000000011251, 35, 1},
+    {0x0000000112d0, 36, 1},
+    {0x0000000112e1, 37, 1},
+    {0x000000012012, 38, 1},
+    {0x000000012051, 39, 1},
+    {0x000000012062, 40, 1},
+    {0x000000012249, 41, 1},
+    {0x000000012252, 42, 1},
+    {0x0000000122d1, 43, 1},
+    {0x0000000122e2, 44, 1},
+    {0x00000004104a, 45, 1},
+    {0x00000004109a, 46, 1},
+    {0x00000004128a, 47, 1},
+    {0x000000041309, 48, 1},
+    {0x00000004131a, 49, 1},
+    {0x000000048249, 50, 1},
+    {0x000000048291, 51, 1},
+    {0x0000000482d9, 52, 1},
+    {0x000000048321, 53, 1},
+    {0x000000049049, 54, 3},
+    {0x000000049052, 57, 1},
+    {0x00000004905a, 58, 1},
+    {0x0000000490a2, 59, 1},
+    {0x000000049241, 60, 1},
+    {0x00000004924a, 61, 1},
+    {0x000000049289, 62, 2},
+    {0x000000049292, 64, 1},
+    {0x0000000492c9, 65, 1},
+    {0x0000000492da, 66, 1},
+    {0x000000049308, 67, 1},
+    {0x000000049311, 68, 1},
+    {0x000000049319, 69, 1},
+    {0x000000049322, 70, 1},
+    {0x00000004a04a, 71, 1},
+    {0x00000004a089, 72, 1},
+    {0x00000004a09a, 73, 1},
+    {0x00000004a281, 74, 1},
+    {0x00000004a28a, 75, 1},
+    {0x00000004a309, 76, 1},
+    {0x00000004a31a, 77, 1},
+    {0x000000050251, 78, 1},
+    {0x0000000502e1, 79, 1},
+    {0x000000051051, 80, 2},
+    {0x000000051062, 82, 1},
+    {0x000000051249, 83, 1},
+    {0x000000051252, 84, 1},
+    {0x000000051288, 85, 1},
+    {0x000000051291, 86, 1},
+    {0x0000000512d1, 87, 1},
+    {0x0000000512e2, 88, 1},
+    {0x000000051310, 89, 1},
+    {0x000000051321, 90, 1},
+    {0x000000052052, 91, 1},
+    {0x000000052091, 92, 1},
+    {0x0000000520a2, 93, 1},
+    {0x000000052289, 94, 1},
+    {0x000000052292, 95, 1},
+    {0x000000052311, 96, 1},
+    {0x000000052322, 97, 1},
+    {0x000000059059, 98, 1},
+    {0x000000059249, 99, 1},
+    {0x0000000592c8, 100, 1},
+    {0x0000000592d9, 101, 1},
+    {0x00000005a05a, 102, 1},
+    {0x00000005a241, 103, 1},
+    {0x00000005a24a, 104, 1},
+    {0x00000005a2c9, 105, 1},
+    {0x00000005a2da, 106, 1},
+    {0x000000061061, 107, 1},
+    {0x000000061251, 108, 1},
+    {0x0000000612d0, 109, 1},
+    {0x0000000612e1, 110, 1},
+    {0x000000062062, 111, 1},
+    {0x000000062249, 112, 1},
+    {0x000000062252, 113, 1},
+    {0x0000000622d1, 114, 1},
+    {0x0000000622e2, 115, 1},
+    {0x000000089281, 116, 1},
+    {0x00000008928a, 117, 1},
+    {0x000000089309, 118, 1},
+    {0x00000008931a, 119, 1},
+    {0x000000090291, 120, 1},
+    {0x000000090321, 121, 1},
+    {0x000000091289, 122, 1},
+    {0x000000091292, 123, 1},
+    {0x000000091311, 124, 1},
+    {0x000000091322, 125, 1},
+    {0x000000099289, 126, 1},
+    {0x000000099319, 127, 1},
+    {0x00000009a09a, 128, 1},
+    {0x00000009a281, 129, 1},
+    {0x00000009a28a, 130, 1},
+    {0x00000009a309, 131, 1},
+    {0x00000009a31a, 132, 1},
+    {0x0000000a1291, 133, 1},
+    {0x0000000a1310, 134, 1},
+    {0x0000000a1321, 135, 1},
+    {0x0000000a20a2, 136, 1},
+    {0x0000000a2289, 137, 1},
+    {0x0000000a2292, 138, 1},
+    {0x0000000a2311, 139, 1},
+    {0x0000000a2322, 140, 1},
+    {0x000000201249, 141, 1},
+    {0x00000020125a, 142, 1},
+    {0x00000020144a, 143, 1},
+    {0x0000002014da, 144, 1},
+    {0x000000209251, 145, 1},
+    {0x000000209259, 146, 1},
+    {0x000000209262, 147, 1},
+    {0x000000209449, 148, 2},
+    {0x000000209452, 150, 1},
+    {0x0000002094d1, 151, 1},
+    {0x0000002094d9, 152, 1},
+    {0x0000002094e2, 153, 1},
+    {0x00000020a249, 154, 1},
+    {0x00000020a25a, 155, 1},
+    {0x00000020a44a, 156, 1},
+    {0x00000020a4c9, 157, 1},
+    {0x00000020a4da, 158, 1},
+    {0x000000211261, 159, 1},
+    {0x000000211451, 160, 1},
+    {0x0000002114e1, 161, 1},
+    {0x000000212251, 162, 1},
+    {0x000000212262, 163, 1},
+    {0x000000212449, 164, 1},
+    {0x000000212452, 165, 1},
+    {0x0000002124d1, 166, 1},
+    {0x0000002124e2, 167, 1},
+    {0x000000249249, 168, 5},
+    {0x000000249252, 173, 2},
+    {0x00000024925a, 175, 1},
+    {0x000000249291, 176, 1},
+    {0x000000249299, 177, 1},
+    {0x0000002492a2, 178, 1},
+    {0x0000002492d9, 179, 1},
+    {0x0000002492e2, 180, 1},
+    {0x00000024944a, 181, 1},
+    {0x000000249492, 182, 1},
+    {0x0000002494da, 183, 1},
+    {0x000000249522, 184, 1},
+    {0x00000024a24a, 185, 2},
+    {0x00000024a289, 187, 1},
+    {0x00000024a29a, 188, 1},
+    {0x00000024a2c9, 189, 1},
+    {0x00000024a2da, 190, 1},
+    {0x00000024a48a, 191, 1},
+    {0x00000024a509, 192, 1},
+    {0x00000024a51a, 193, 1},
+    {0x000000251251, 194, 3},
+    {0x000000251262, 197, 1},
+    {0x0000002512a1, 198, 1},
+    {0x0000002512e1, 199, 1},
+    {0x000000251452, 200, 1},
+    {0x000000251491, 201, 1},
+    {0x0000002514d1, 202, 1},
+    {0x0000002514e2, 203, 1},
+    {0x000000251521, 204, 1},
+    {0x000000252252, 205, 2},
+    {0x000000252291, 207, 1},
+    {0x0000002522a2, 208, 1},
+    {0x0000002522d1, 209, 1},
+    {0x0000002522e2, 210, 1},
+    {0x000000252489, 211, 1},
+    {0x000000252492, 212, 1},
+    {0x000000252511, 213, 1},
+    {0x000000252522, 214, 1},
+    {0x000000259259, 215, 1},
+    {0x0000002594d9, 216, 1},
+    {0x00000025a25a, 217, 1},
+    {0x00000025a44a, 218, 1},
+    {0x00000025a4c9, 219, 1},
+    {0x00000025a4da, 220, 1},
+    {0x000000261261, 221, 1},
+    {0x000000261451, 222, 1},
+    {0x0000002614e1, 223, 1},
+    {0x000000262262, 224, 1},
+    {0x000000262452, 225, 1},
+    {0x0000002624d1, 226, 1},
+    {0x0000002624e2, 227, 1},
+    {0x00000028a28a, 228, 1},
+    {0x00000028a31a, 229, 1},
+    {0x000000291291, 230, 2},
+    {0x0000002912a2, 232, 1},
+    {0x000000291321, 233, 1},
+    {0x000000291492, 234, 1},
+    {0x000000291522, 235, 1},
+    {0x000000292292, 236, 1},
+    {0x000000292311, 237, 1},
+    {0x000000292322, 238, 1},
+    {0x000000299299, 239, 1},
+    {0x000000299519, 240, 1},
+    {0x00000029a29a, 241, 1},
+    {0x00000029a48a, 242, 1},
+    {0x00000029a51a, 243, 1},
+    {0x0000002a12a1, 244, 1},
+    {0x0000002a1521, 245, 1},
+    {0x0000002a22a2, 246, 1},
+    {0x0000002a2492, 247, 1},
+    {0x0000002a2511, 248, 1},
+    {0x0000002a2522, 249, 1},
+    {0x0000002d92d9, 250, 1},
+    {0x0000002da2da, 251, 1},
+    {0x0000002e12e1, 252, 1},
+    {0x0000002e22e2, 253, 1},
+    {0x00000031a31a, 254, 1},
+    {0x000000321321, 255, 1},
+    {0x000000322322, 256, 1},
+    {0x00000044a44a, 257, 1},
+    {0x00000044a4da, 258, 1},
+    {0x000000452452, 259, 1},
+    {0x0000004524e2, 260, 1},
+    {0x000000492492, 261, 1},
+    {0x000000492522, 262, 1},
+    {0x0000004da4da, 263, 1},
+    {0x0000004e24e2, 264, 1},
+    {0x000000522522, 265, 1},
+    {0x000001001059, 266, 1},
+    {0x000001001249, 267, 1},
+    {0x0000010012d9, 268, 1},
+    {0x00000100305a, 269, 1},
+    {0x00000100324a, 270, 1},
+    {0x0000010032c9, 271, 1},
+    {0x0000010032da, 272, 1},
+    {0x000001009050, 273, 1},
+    {0x000001009061, 274, 1},
+    {0x000001009248, 275, 1},
+    {0x000001009251, 276, 1},
+    {0x0000010092d0, 277, 1},
+    {0x0000010092e1, 278, 1},
+    {0x00000100a059, 279, 1},
+    {0x00000100a249, 280, 1},
+    {0x00000100a2c8, 281, 1},
+    {0x00000100a2d9, 282, 1},
+    {0x00000100b062, 283, 1},
+    {0x00000100b249, 284, 1},
+    {0x00000100b252, 285, 1},
+    {0x00000100b2d1, 286, 1},
+    {0x00000100b2e2, 287, 1},
+    {0x00000100c24a, 288, 1},
+    {0x00000100c2c9, 289, 1},
+    {0x00000100c2da, 290, 1},
+    {0x000001012050, 291, 1},
+    {0x000001012061, 292, 1},
+    {0x000001012248, 293, 1},
+    {0x000001012251, 294, 1},
+    {0x0000010122d0, 295, 1},
+    {0x0000010122e1, 296, 1},
+    {0x000001014062, 297, 1},
+    {0x000001014249, 298, 1},
+    {0x000001014252, 299, 1},
+    {0x0000010142d1, 300, 1},
+    {0x0000010142e2, 301, 1},
+    {0x000001041049, 302, 1},
+    {0x000001041099, 303, 1},
+    {0x000001041289, 304, 1},
+    {0x000001041319, 305, 1},
+    {0x00000104304a, 306, 1},
+    {0x000001043089, 307, 1},
+    {0x00000104309a, 308, 1},
+    {0x00000104328a, 309, 1},
+    {0x000001043309, 310, 1},
+    {0x00000104331a, 311, 1},
+    {0x000001049009, 312, 1},
+    {0x000001049048, 313, 2},
+    {0x000001049051, 315, 1},
+    {0x000001049059, 316, 1},
+    {0x000001049090, 317, 1},
+    {0x0000010490a1, 318, 1},
+    {0x000001049240, 319, 1},
+    {0x000001049249, 320, 1},
+    {0x000001049288, 321, 1},
+    {0x000001049291, 322, 1},
+    {0x0000010492c8, 323, 1},
+    {0x0000010492d9, 324, 1},
+    {0x000001049310, 325, 1},
+    {0x000001049321, 326, 1},
+    {0x00000104a040, 327, 1},
+    {0x00000104a049, 328, 1},
+    {0x00000104a088, 329, 1},
+    {0x00000104a099, 330, 1},
+    {0x00000104a280, 331, 1},
+    {0x00000104a289, 332, 1},
+    {0x00000104a308, 333, 1},
+    {0x00000104a319, 334, 1},
+    {0x00000104b001, 335, 1},
+    {0x00000104b00a, 336, 1},
+    {0x00000104b049, 337, 2},
+    {0x00000104b052, 339, 1},
+    {0x00000104b05a, 340, 1},
+    {0x00000104b091, 341, 1},
+    {0x00000104b0a2, 342, 1},
+    {0x00000104b241, 343, 1},
+    {0x00000104b24a, 344, 1},
+    {0x00000104b289, 345, 1},
+    {0x00000104b292, 346, 1},
+    {0x00000104b2c9, 347, 1},
+    {0x00000104b2da, 348, 1},
+    {0x00000104b311, 349, 1},
+    {0x00000104b322, 350, 1},
+    {0x00000104c041, 351, 1},
+    {0x00000104c04a, 352, 1},
+    {0x00000104c089, 353, 1},
+    {0x00000104c09a, 354, 1},
+    {0x00000104c281, 355, 1},
+    {0x00000104c28a, 356, 1},
+    {0x00000104c309, 357, 1},
+    {0x00000104c31a, 358, 1},
+    {0x000001051008, 359, 1},
+    {0x000001051011, 360, 1},
+    {0x000001051050, 361, 1},
+    {0x000001051061, 362, 1},
+    {0x000001051248, 363, 1},
+    {0x000001051251, 364, 1},
+    {0x0000010512d0, 365, 1},
+    {0x0000010512e1, 366, 1},
+    {0x000001052048, 367, 1},
+    {0x000001052051, 368, 1},
+    {0x000001052090, 369, 1},
+    {0x0000010520a1, 370, 1},
+    {0x000001052288, 371, 1},
+    {0x000001052291, 372, 1},
+    {0x000001052310, 373, 1},
+    {0x000001052321, 374, 1},
+    {0x000001053009, 375, 1},
+    {0x000001053012, 376, 1},
+    {0x000001053051, 377, 1},
+    {0x000001053062, 378, 1},
+    {0x000001053249, 379, 1},
+    {0x000001053252, 380, 1},
+    {0x0000010532d1, 381, 1},
+    {0x0000010532e2, 382, 1},
+    {0x000001054049, 383, 1},
+    {0x000001054052, 384, 1},
+    {0x000001054091, 385, 1},
+    {0x0000010540a2, 386, 1},
+    {0x000001054289, 387, 1},
+    {0x000001054292, 388, 1},
+    {0x000001054311, 389, 1},
+    {0x000001054322, 390, 1},
+    {0x00000105a009, 391, 1},
+    {0x00000105a048, 392, 1},
+    {0x00000105a059, 393, 1},
+    {0x00000105a240, 394, 1},
+    {0x00000105a249, 395, 1},
+    {0x00000105a2c8, 396, 1},
+    {0x00000105a2d9, 397, 1},
+    {0x00000105c001, 398, 1},
+    {0x00000105c00a, 399, 1},
+    {0x00000105c049, 400, 1},
+    {0x00000105c05a, 401, 1},
+    {0x00000105c241, 402, 1},
+    {0x00000105c24a, 403, 1},
+    {0x00000105c2c9, 404, 1},
+    {0x00000105c2da, 405, 1},
+    {0x000001062008, 406, 1},
+    {0x000001062011, 407, 1},
+    {0x000001062050, 408, 1},
+    {0x000001062061, 409, 1},
+    {0x000001062248, 410, 1},
+    {0x000001062251, 411, 1},
+    {0x0000010622d0, 412, 1},
+    {0x0000010622e1, 413, 1},
+    {0x000001064009, 414, 1},
+    {0x000001064012, 415, 1},
+    {0x000001064051, 416, 1},
+    {0x000001064062, 417, 1},
+    {0x000001064249, 418, 1},
+    {0x000001064252, 419, 1},
+    {0x0000010642d1, 420, 1},
+    {0x0000010642e2, 421, 1},
+    {0x000001089049, 422, 1},
+    {0x000001089088, 423, 1},
+    {0x000001089099, 424, 1},
+    {0x000001089280, 425, 1},
+    {0x000001089289, 426, 1},
+    {0x000001089308, 427, 1},
+    {0x000001089319, 428, 1},
+    {0x00000108b041, 429, 1},
+    {0x00000108b04a, 430, 1},
+    {0x00000108b089, 431, 1},
+    {0x00000108b09a, 432, 1},
+    {0x00000108b281, 433, 1},
+    {0x00000108b28a, 434, 1},
+    {0x00000108b309, 435, 1},
+    {0x00000108b31a, 436, 1},
+    {0x000001091048, 437, 1},
+    {0x000001091051, 438, 1},
+    {0x000001091090, 439, 1},
+    {0x0000010910a1, 440, 1},
+    {0x000001091288, 441, 1},
+    {0x000001091291, 442, 1},
+    {0x000001091310, 443, 1},
+    {0x000001091321, 444, 1},
+    {0x000001093049, 445, 1},
+    {0x000001093052, 446, 1},
+    {0x000001093091, 447, 1},
+    {0x0000010930a2, 448, 1},
+    {0x000001093289, 449, 1},
+    {0x000001093292, 450, 1},
+    {0x000001093311, 451, 1},
+    {0x000001093322, 452, 1},
+    {0x00000109a040, 453, 1},
+    {0x00000109a049, 454, 1},
+    {0x00000109a088, 455, 1},
+    {0x00000109a099, 456, 1},
+    {0x00000109a280, 457, 1},
+    {0x00000109a289, 458, 1},
+    {0x00000109a308, 459, 1},
+    {0x00000109a319, 460, 1},
+    {0x00000109c041, 461, 1},
+    {0x00000109c04a, 462, 1},
+    {0x00000109c089, 463, 1},
+    {0x00000109c09a, 464, 1},
+    {0x00000109c281, 465, 1},
+    {0x00000109c28a, 466, 1},
+    {0x00000109c309, 467, 1},
+    {0x00000109c31a, 468, 1},
+    {0x0000010a2048, 469, 1},
+    {0x0000010a2051, 470, 1},
+    {0x0000010a2090, 471, 1},
+    {0x0000010a20a1, 472, 1},
+    {0x0000010a2288, 473, 1},
+    {0x0000010a2291, 474, 1},
+    {0x0000010a2310, 475, 1},
+    {0x0000010a2321, 476, 1},
+    {0x0000010a4049, 477, 1},
+    {0x0000010a4052, 478, 1},
+    {0x0000010a4091, 479, 1},
+    {0x0000010a40a2, 480, 1},
+    {0x0000010a4289, 481, 1},
+    {0x0000010a4292, 482, 1},
+    {0x0000010a4311, 483, 1},
+    {0x0000010a4322, 484, 1},
+    {0x000001201259, 485, 1},
+    {0x000001201449, 486, 1},
+    {0x0000012014d9, 487, 1},
+    {0x000001203249, 488, 1},
+    {0x00000120325a, 489, 1},
+    {0x00000120344a, 490, 1},
+    {0x0000012034c9, 491, 1},
+    {0x0000012034da, 492, 1},
+    {0x000001209250, 493, 1},
+    {0x000001209261, 494, 1},
+    {0x000001209448, 495, 1},
+    {0x000001209451, 496, 1},
+    {0x0000012094d0, 497, 1},
+    {0x0000012094e1, 498, 1},
+    {0x00000120a248, 499, 1},
+    {0x00000120a259, 500, 1},
+    {0x00000120a449, 501, 1},
+    {0x00000120a4c8, 502, 1},
+    {0x00000120a4d9, 503, 1},
+    {0x00000120b251, 504, 1},
+    {0x00000120b262, 505, 1},
+    {0x00000120b449, 506, 1},
+    {0x00000120b452, 507, 1},
+    {0x00000120b4d1, 508, 1},
+    {0x00000120b4e2, 509, 1},
+    {0x00000120c249, 510, 1},
+    {0x00000120c25a, 511, 1},
+    {0x00000120c44a, 512, 1},
+    {0x00000120c4c9, 513, 1},
+    {0x00000120c4da, 514, 1},
+    {0x000001212250, 515, 1},
+    {0x000001212261, 516, 1},
+    {0x000001212448, 517, 1},
+    {0x000001212451, 518, 1},
+    {0x0000012124d0, 519, 1},
+    {0x0000012124e1, 520, 1},
+    {0x000001214251, 521, 1},
+    {0x000001214262, 522, 1},
+    {0x000001214449, 523, 1},
+    {0x000001214452, 524, 1},
+    {0x0000012144d1, 525, 1},
+    {0x0000012144e2, 526, 1},
+    {0x000001241059, 527, 1},
+    {0x000001241249, 528, 2},
+    {0x000001241299, 530, 1},
+    {0x0000012412d9, 531, 1},
+    {0x000001241489, 532, 1},
+    {0x000001241519, 533, 1},
+    {0x000001243049, 534, 1},
+    {0x00000124305a, 535, 1},
+    {0x00000124324a, 536, 2},
+    {0x000001243289, 538, 1},
+    {0x00000124329a, 539, 1},
+    {0x0000012432c9, 540, 1},
+    {0x0000012432da, 541, 1},
+    {0x00000124348a, 542, 1},
+    {0x000001243509, 543, 1},
+    {0x00000124351a, 544, 1},
+    {0x000001249008, 545, 1},
+    {0x000001249011, 546, 1},
+    {0x000001249050, 547, 1},
+    {0x000001249061, 548, 1},
+    {0x000001249200, 549, 1},
+    {0x000001249209, 550, 1},
+    {0x000001249248, 551, 3},
+    {0x000001249290, 554, 1},
+    {0x0000012492d0, 555, 1},
+    {0x000001249440, 556, 1},
+    {0x000001249488, 557, 1},
+    {0x0000012494c8, 558, 1},
+    {0x000001249510, 559, 1},
+    {0x00000124a009, 560, 1},
+    {0x00000124a048, 561, 1},
+    {0x00000124a059, 562, 1},
+    {0x00000124a240, 563, 2},
+    {0x00000124a288, 565, 1},
+    {0x00000124a2c8, 566, 1},
+    {0x00000124a480, 567, 1},
+    {0x00000124a508, 568, 1},
+    {0x00000124b009, 569, 1},
+    {0x00000124b012, 570, 1},
+    {0x00000124b051, 571, 1},
+    {0x00000124b062, 572, 1},
+    {0x00000124b201, 573, 1},
+    {0x00000124b20a, 574, 1},
+    {0x00000124b441, 575, 1},
+    {0x00000124c001, 576, 1},
+    {0x00000124c00a, 577, 1},
+    {0x00000124c049, 578, 1},
+    {0x00000124c05a, 579, 1},
+    {0x00000124c241, 580, 2},
+    {0x00000124c481, 582, 1},
+    {0x000001251208, 583, 1},
+    {0x000001251211, 584, 1},
+    {0x000001251250, 585, 1},
+    {0x000001251448, 586, 1},
+    {0x0000012514d0, 587, 1},
+    {0x000001252008, 588, 1},
+    {0x000001252011, 589, 1},
+    {0x000001252050, 590, 1},
+    {0x000001252061, 591, 1},
+    {0x000001252248, 592, 2},
+    {0x000001252290, 594, 1},
+    {0x0000012522d0, 595, 1},
+    {0x000001252488, 596, 1},
+    {0x000001252510, 597, 1},
+    {0x000001253209, 598, 1},
+    {0x000001253212, 599, 1},
+    {0x000001254009, 600, 1},
+    {0x000001254012, 601, 1},
+    {0x000001254051, 602, 1},
+    {0x000001254062, 603, 1},
+    {0x00000125a200, 604, 1},
+    {0x00000125a209, 605, 1},
+    {0x00000125a248, 606, 1},
+    {0x00000125a440, 607, 1},
+    {0x00000125a4c8, 608, 1},
+    {0x00000125c201, 609, 1},
+    {0x00000125c20a, 610, 1},
+    {0x00000125c441, 611, 1},
+    {0x000001262208, 612, 1},
+    {0x000001262211, 613, 1},
+    {0x000001262250, 614, 1},
+    {0x000001262448, 615, 1},
+    {0x0000012624d0, 616, 1},
+    {0x000001264209, 617, 1},
+    {0x000001264212, 618, 1},
+    {0x000001281049, 619, 1},
+    {0x000001281099, 620, 1},
+    {0x000001281289, 621, 1},
+    {0x000001281319, 622, 1},
+    {0x00000128304a, 623, 1},
+    {0x000001283089, 624, 1},
+    {0x00000128309a, 625, 1},
+    {0x00000128328a, 626, 1},
+    {0x000001283309, 627, 1},
+    {0x00000128331a, 628, 1},
+    {0x000001289048, 629, 1},
+    {0x000001289051, 630, 1},
+    {0x000001289090, 631, 1},
+    {0x0000012890a1, 632, 1},
+    {0x000001289240, 633, 1},
+    {0x000001289288, 634, 2},
+    {0x000001289310, 636, 1},
+    {0x000001289480, 637, 1},
+    {0x000001289508, 638, 1},
+    {0x00000128a040, 639, 1},
+    {0x00000128a049, 640, 1},
+    {0x00000128a088, 641, 1},
+    {0x00000128a099, 642, 1},
+    {0x00000128a280, 643, 1},
+    {0x00000128a308, 644, 1},
+    {0x00000128b049, 645, 1},
+    {0x00000128b052, 646, 1},
+    {0x00000128b091, 647, 1},
+    {0x00000128b0a2, 648, 1},
+    {0x00000128b241, 649, 1},
+    {0x00000128b481, 650, 1},
+    {0x00000128c041, 651, 1},
+    {0x00000128c04a, 652, 1},
+    {0x00000128c089, 653, 1},
+    {0x00000128c09a, 654, 1},
+    {0x00000128c281, 655, 1},
+    {0x000001291248, 656, 1},
+    {0x000001291290, 657, 1},
+    {0x000001291488, 658, 1},
+    {0x000001291510, 659, 1},
+    {0x000001292048, 660, 1},
+    {0x000001292051, 661, 1},
+    {0x000001292090, 662, 1},
+    {0x0000012920a1, 663, 1},
+    {0x000001292288, 664, 1},
+    {0x000001292310, 665, 1},
+    {0x000001294049, 666, 1},
+    {0x000001294052, 667, 1},
+    {0x000001294091, 668, 1},
+    {0x0000012940a2, 669, 1},
+    {0x00000129a240, 670, 1},
+    {0x00000129a288, 671, 1},
+    {0x00000129a480, 672, 1},
+    {0x00000129a508, 673, 1},
+    {0x00000129c241, 674, 1},
+    {0x00000129c481, 675, 1},
+    {0x0000012a2248, 676, 1},
+    {0x0000012a2290, 677, 1},
+    {0x0000012a2488, 678, 1},
+    {0x0000012a2510, 679, 1},
+    {0x0000012c9009, 680, 1},
+    {0x0000012c9048, 681, 1},
+    {0x0000012c9059, 682, 1},
+    {0x0000012c9240, 683, 1},
+    {0x0000012c92c8, 684, 1},
+    {0x0000012cb001, 685, 1},
+    {0x0000012cb00a, 686, 1},
+    {0x0000012cb049, 687, 1},
+    {0x0000012cb05a, 688, 1},
+    {0x0000012cb241, 689, 1},
+    {0x0000012d1008, 690, 1},
+    {0x0000012d1011, 691, 1},
+    {0x0000012d1050, 692, 1},
+    {0x0000012d1061, 693, 1},
+    {0x0000012d1248, 694, 1},
+    {0x0000012d12d0, 695, 1},
+    {0x0000012d3009, 696, 1},
+    {0x0000012d3012, 697, 1},
+    {0x0000012d3051, 698, 1},
+    {0x0000012d3062, 699, 1},
+    {0x0000012da009, 700, 1},
+    {0x0000012da048, 701, 1},
+    {0x0000012da059, 702, 1},
+    {0x0000012da240, 703, 1},
+    {0x0000012da2c8, 704, 1},
+    {0x0000012dc001, 705, 1},
+    {0x0000012dc00a, 706, 1},
+    {0x0000012dc049, 707, 1},
+    {0x0000012dc05a, 708, 1},
+    {0x0000012dc241, 709, 1},
+    {0x0000012e2008, 710, 1},
+    {0x0000012e2011, 711, 1},
+    {0x0000012e2050, 712, 1},
+    {0x0000012e2061, 713, 1},
+    {0x0000012e2248, 714, 1},
+    {0x0000012e22d0, 715, 1},
+    {0x0000012e4009, 716, 1},
+    {0x0000012e4012, 717, 1},
+    {0x0000012e4051, 718, 1},
+    {0x0000012e4062, 719, 1},
+    {0x000001309040, 720, 1},
+    {0x000001309049, 721, 1},
+    {0x000001309088, 722, 1},
+    {0x000001309099, 723, 1},
+    {0x000001309280, 724, 1},
+    {0x000001309308, 725, 1},
+    {0x00000130b041, 726, 1},
+    {0x00000130b04a, 727, 1},
+    {0x00000130b089, 728, 1},
+    {0x00000130b09a, 729, 1},
+    {0x00000130b281, 730, 1},
+    {0x000001311048, 731, 1},
+    {0x000001311051, 732, 1},
+    {0x000001311090, 733, 1},
+    {0x0000013110a1, 734, 1},
+    {0x000001311288, 735, 1},
+    {0x000001311310, 736, 1},
+    {0x000001313049, 737, 1},
+    {0x000001313052, 738, 1},
+    {0x000001313091, 739, 1},
+    {0x0000013130a2, 740, 1},
+    {0x00000131a040, 741, 1},
+    {0x00000131a049, 742, 1},
+    {0x00000131a088, 743, 1},
+    {0x00000131a099, 744, 1},
+    {0x00000131a280, 745, 1},
+    {0x00000131a308, 746, 1},
+    {0x00000131c041, 747, 1},
+    {0x00000131c04a, 748, 1},
+    {0x00000131c089, 749, 1},
+    {0x00000131c09a, 750, 1},
+    {0x00000131c281, 751, 1},
+    {0x000001322048, 752, 1},
+    {0x000001322051, 753, 1},
+    {0x000001322090, 754, 1},
+    {0x0000013220a1, 755, 1},
+    {0x000001322288, 756, 1},
+    {0x000001322310, 757, 1},
+    {0x000001324049, 758, 1},
+    {0x000001324052, 759, 1},
+    {0x000001324091, 760, 1},
+    {0x0000013240a2, 761, 1},
+    {0x000001441259, 762, 1},
+    {0x000001441449, 763, 1},
+    {0x0000014414d9, 764, 1},
+    {0x000001443249, 765, 1},
+    {0x00000144325a, 766, 1},
+    {0x00000144344a, 767, 1},
+    {0x0000014434c9, 768, 1},
+    {0x0000014434da, 769, 1},
+    {0x000001449208, 770, 1},
+    {0x000001449211, 771, 1},
+    {0x000001449250, 772, 1},
+    {0x000001449448, 773, 1},
+    {0x0000014494d0, 774, 1},
+    {0x00000144a200, 775, 1},
+    {0x00000144a209, 776, 1},
+    {0x00000144a248, 777, 1},
+    {0x00000144a440, 778, 1},
+    {0x00000144a4c8, 779, 1},
+    {0x00000144b209, 780, 1},
+    {0x00000144b212, 781, 1},
+    {0x00000144c201, 782, 1},
+    {0x00000144c20a, 783, 1},
+    {0x00000144c441, 784, 1},
+    {0x000001452208, 785, 1},
+    {0x000001452211, 786, 1},
+    {0x000001452250, 787, 1},
+    {0x000001452448, 788, 1},
+    {0x0000014524d0, 789, 1},
+    {0x000001454209, 790, 1},
+    {0x000001454212, 791, 1},
+    {0x000001481249, 792, 1},
+    {0x000001481299, 793, 1},
+    {0x000001481489, 794, 1},
+    {0x000001481519, 795, 1},
+    {0x00000148324a, 796, 1},
+    {0x000001483289, 797, 1},
+    {0x00000148329a, 798, 1},
+    {0x00000148348a, 799, 1},
+    {0x000001483509, 800, 1},
+    {0x00000148351a, 801, 1},
+    {0x000001489248, 802, 1},
+    {0x000001489290, 803, 1},
+    {0x000001489488, 804, 1},
+    {0x000001489510, 805, 1},
+    {0x00000148a240, 806, 1},
+    {0x00000148a288, 807, 1},
+    {0x00000148a480, 808, 1},
+    {0x00000148a508, 809, 1},
+    {0x00000148c241, 810, 1},
+    {0x00000148c481, 811, 1},
+    {0x000001492248, 812, 1},
+    {0x000001492290, 813, 1},
+    {0x000001492488, 814, 1},
+    {0x000001492510, 815, 1},
+    {0x0000014c9209, 816, 1},
+    {0x0000014c9248, 817, 1},
+    {0x0000014c9440, 818, 1},
+    {0x0000014c94c8, 819, 1},
+    {0x0000014cb201, 820, 1},
+    {0x0000014cb20a, 821, 1},
+    {0x0000014cb441, 822, 1},
+    {0x0000014d1208, 823, 1},
+    {0x0000014d1211, 824, 1},
+    {0x0000014d1250, 825, 1},
+    {0x0000014d1448, 826, 1},
+    {0x0000014d14d0, 827, 1},
+    {0x0000014d3209, 828, 1},
+    {0x0000014d3212, 829, 1},
+    {0x0000014da200, 830, 1},
+    {0x0000014da209, 831, 1},
+    {0x0000014da248, 832, 1},
+    {0x0000014da440, 833, 1},
+    {0x0000014da4c8, 834, 1},
+    {0x0000014dc201, 835, 1},
+    {0x0000014dc20a, 836, 1},
+    {0x0000014dc441, 837, 1},
+    {0x0000014e2208, 838, 1},
+    {0x0000014e2211, 839, 1},
+    {0x0000014e2250, 840, 1},
+    {0x0000014e2448, 841, 1},
+    {0x0000014e24d0, 842, 1},
+    {0x0000014e4209, 843, 1},
+    {0x0000014e4212, 844, 1},
+    {0x000001509240, 845, 1},
+    {0x000001509288, 846, 1},
+    {0x000001509480, 847, 1},
+    {0x000001509508, 848, 1},
+    {0x00000150b241, 849, 1},
+    {0x00000150b481, 850, 1},
+    {0x000001511248, 851, 1},
+    {0x000001511290, 852, 1},
+    {0x000001511488, 853, 1},
+    {0x000001511510, 854, 1},
+    {0x00000151a240, 855, 1},
+    {0x00000151a288, 856, 1},
+    {0x00000151a480, 857, 1},
+    {0x00000151a508, 858, 1},
+    {0x00000151c241, 859, 1},
+    {0x00000151c481, 860, 1},
+    {0x000001522248, 861, 1},
+    {0x000001522290, 862, 1},
+    {0x000001522488, 863, 1},
+    {0x000001522510, 864, 1},
+    {0x000008008249, 865, 1},
+    {0x0000080082d9, 866, 1},
+    {0x00000800924a, 867, 1},
+    {0x0000080092c9, 868, 1},
+    {0x0000080092da, 869, 1},
+    {0x000008011249, 870, 1},
+    {0x0000080112c8, 871, 1},
+    {0x0000080112d9, 872, 1},
+    {0x00000801224a, 873, 1},
+    {0x0000080122c9, 874, 1},
+    {0x0000080122da, 875, 1},
+    {0x000008018251, 876, 1},
+    {0x0000080182e1, 877, 1},
+    {0x000008019249, 878, 1},
+    {0x000008019252, 879, 1},
+    {0x0000080192d1, 880, 1},
+    {0x0000080192e2, 881, 1},
+    {0x000008021248, 882, 1},
+    {0x000008021251, 883, 1},
+    {0x0000080212d0, 884, 1},
+    {0x0000080212e1, 885, 1},
+    {0x000008022249, 886, 1},
+    {0x000008022252, 887, 1},
+    {0x0000080222d1, 888, 1},
+    {0x0000080222e2, 889, 1},
+    {0x000008048289, 890, 1},
+    {0x000008048319, 891, 1},
+    {0x000008049041, 892, 1},
+    {0x00000804904a, 893, 1},
+    {0x00000804909a, 894, 1},
+    {0x000008049281, 895, 1},
+    {0x00000804928a, 896, 1},
+    {0x000008049309, 897, 1},
+    {0x00000804931a, 898, 1},
+    {0x000008050249, 899, 1},
+    {0x0000080502d9, 900, 1},
+    {0x00000805100a, 901, 1},
+    {0x000008051049, 902, 2},
+    {0x00000805105a, 904, 1},
+    {0x000008051241, 905, 1},
+    {0x00000805124a, 906, 1},
+    {0x000008051280, 907, 1},
+    {0x000008051289, 908, 1},
+    {0x0000080512c9, 909, 1},
+    {0x0000080512da, 910, 1},
+    {0x000008051308, 911, 1},
+    {0x000008051319, 912, 1},
+    {0x000008052041, 913, 1},
+    {0x00000805204a, 914, 1},
+    {0x000008052089, 915, 1},
+    {0x00000805209a, 916, 1},
+    {0x000008052281, 917, 1},
+    {0x00000805228a, 918, 1},
+    {0x000008052309, 919, 1},
+    {0x00000805231a, 920, 1},
+    {0x000008058291, 921, 1},
+    {0x000008058321, 922, 1},
+    {0x000008059049, 923, 1},
+    {0x000008059052, 924, 1},
+    {0x0000080590a2, 925, 1},
+    {0x000008059289, 926, 1},
+    {0x000008059292, 927, 1},
+    {0x000008059311, 928, 1},
+    {0x000008059322, 929, 1},
+    {0x000008060251, 930, 1},
+    {0x0000080602e1, 931, 1},
+    {0x000008061009, 932, 2},
+    {0x000008061012, 934, 1},
+    {0x000008061051, 935, 2},
+    {0x000008061059, 937, 1},
+    {0x000008061062, 938, 1},
+    {0x000008061240, 939, 1},
+    {0x000008061249, 940, 2},
+    {0x000008061252, 942, 1},
+    {0x000008061288, 943, 1},
+    {0x000008061291, 944, 1},
+    {0x0000080612c8, 945, 1},
+    {0x0000080612d1, 946, 1},
+    {0x0000080612d9, 947, 1},
+    {0x0000080612e2, 948, 1},
+    {0x000008061310, 949, 1},
+    {0x000008061321, 950, 1},
+    {0x000008062049, 951, 2},
+    {0x000008062052, 953, 1},
+    {0x00000806205a, 954, 1},
+    {0x000008062091, 955, 1},
+    {0x0000080620a2, 956, 1},
+    {0x000008062241, 957, 1},
+    {0x00000806224a, 958, 1},
+    {0x000008062289, 959, 1},
+    {0x000008062292, 960, 1},
+    {0x0000080622c9, 961, 1},
+    {0x0000080622da, 962, 1},
+    {0x000008062311, 963, 1},
+    {0x000008062322, 964, 1},
+    {0x000008069008, 965, 1},
+    {0x000008069011, 966, 1},
+    {0x000008069061, 967, 1},
+    {0x000008069248, 968, 1},
+    {0x000008069251, 969, 1},
+    {0x0000080692d0, 970, 1},
+    {0x0000080692e1, 971, 1},
+    {0x00000806a012, 972, 1},
+    {0x00000806a051, 973, 1},
+    {0x00000806a062, 974, 1},
+    {0x00000806a249, 975, 1},
+    {0x00000806a252, 976, 1},
+    {0x00000806a2d1, 977, 1},
+    {0x00000806a2e2, 978, 1},
+    {0x000008090289, 979, 1},
+    {0x000008090319, 980, 1},
+    {0x000008091281, 981, 1},
+    {0x00000809128a, 982, 1},
+    {0x000008091309, 983, 1},
+    {0x00000809131a, 984, 1},
+    {0x0000080a0291, 985, 1},
+    {0x0000080a0321, 986, 1},
+    {0x0000080a1280, 987, 1},
+    {0x0000080a1289, 988, 2},
+    {0x0000080a1292, 990, 1},
+    {0x0000080a1308, 991, 1},
+    {0x0000080a1311, 992, 1},
+    {0x0000080a1319, 993, 1},
+    {0x0000080a1322, 994, 1},
+    {0x0000080a2041, 995, 1},
+    {0x0000080a204a, 996, 1},
+    {0x0000080a209a, 997, 1},
+    {0x0000080a2281, 998, 1},
+    {0x0000080a228a, 999, 1},
+    {0x0000080a2309, 1000, 1},
+    {0x0000080a231a, 1001, 1},
+    {0x0000080a9288, 1002, 1},
+    {0x0000080a9291, 1003, 1},
+    {0x0000080a9310, 1004, 1},
+    {0x0000080a9321, 1005, 1},
+    {0x0000080aa049, 1006, 1},
+    {0x0000080aa052, 1007, 1},
+    {0x0000080aa0a2, 1008, 1},
+    {0x0000080aa289, 1009, 1},
+    {0x0000080aa292, 1010, 1},
+    {0x0000080aa311, 1011, 1},
+    {0x0000080aa322, 1012, 1},
+    {0x000008208259, 1013, 1},
+    {0x000008208449, 1014, 1},
+    {0x0000082084d9, 1015, 1},
+    {0x000008209249, 1016, 1},
+    {0x00000820925a, 1017, 1},
+    {0x00000820944a, 1018, 1},
+    {0x0000082094c9, 1019, 1},
+    {0x0000082094da, 1020, 1},
+    {0x000008211248, 1021, 1},
+    {0x000008211259, 1022, 1},
+    {0x000008211449, 1023, 1},
+    {0x0000082114c8, 1024, 1},
+    {0x0000082114d9, 1025, 1},
+    {0x000008212249, 1026, 1},
+    {0x00000821225a, 1027, 1},
+    {0x00000821244a, 1028, 1},
+    {0x0000082124c9, 1029, 1},
+    {0x0000082124da, 1030, 1},
+    {0x000008218261, 1031, 1},
+    {0x000008218451, 1032, 1},
+    {0x0000082184e1, 1033, 1},
+    {0x000008219251, 1034, 1},
+    {0x000008219262, 1035, 1},
+    {0x000008219449, 1036, 1},
+    {0x000008219452, 1037, 1},
+    {0x0000082194d1, 1038, 1},
+    {0x0000082194e2, 1039, 1},
+    {0x000008221250, 1040, 1},
+    {0x000008221261, 1041, 1},
+    {0x000008221448, 1042, 1},
+    {0x000008221451, 1043, 1},
+    {0x0000082214d0, 1044, 1},
+    {0x0000082214e1, 1045, 1},
+    {0x000008222251, 1046, 1},
+    {0x000008222262, 1047, 1},
+    {0x000008222449, 1048, 1},
+    {0x000008222452, 1049, 1},
+    {0x0000082224d1, 1050, 1},
+    {0x0000082224e2, 1051, 1},
+    {0x000008248009, 1052, 1},
+    {0x000008248059, 1053, 1},
+    {0x000008248249, 1054, 2},
+    {0x000008248299, 1056, 1},
+    {0x0000082482d9, 1057, 1},
+    {0x000008248489, 1058, 1},
+    {0x000008248519, 1059, 1},
+    {0x00000824900a, 1060, 1},
+    {0x000008249049, 1061, 1},
+    {0x00000824905a, 1062, 1},
+    {0x000008249241, 1063, 2},
+    {0x000008249481, 1065, 1},
+    {0x000008250209, 1066, 1},
+    {0x000008250259, 1067, 1},
+    {0x000008250449, 1068, 1},
+    {0x0000082504d9, 1069, 1},
+    {0x000008251009, 1070, 1},
+    {0x000008251048, 1071, 1},
+    {0x000008251059, 1072, 1},
+    {0x000008251201, 1073, 1},
+    {0x00000825120a, 1074, 1},
+    {0x000008251240, 1075, 2},
+    {0x000008251288, 1077, 1},
+    {0x0000082512c8, 1078, 1},
+    {0x000008251441, 1079, 1},
+    {0x000008251480, 1080, 1},
+    {0x000008251508, 1081, 1},
+    {0x00000825200a, 1082, 1},
+    {0x000008252049, 1083, 1},
+    {0x00000825205a, 1084, 1},
+    {0x000008252241, 1085, 2},
+    {0x000008252481, 1087, 1},
+    {0x000008258011, 1088, 1},
+    {0x000008258061, 1089, 1},
+    {0x000008258251, 1090, 2},
+    {0x0000082582a1, 1092, 1},
+    {0x0000082582e1, 1093, 1},
+    {0x000008258491, 1094, 1},
+    {0x000008258521, 1095, 1},
+    {0x000008259009, 1096, 1},
+    {0x000008259012, 1097, 1},
+    {0x000008259051, 1098, 1},
+    {0x000008259062, 1099, 1},
+    {0x000008260211, 1100, 1},
+    {0x000008260261, 1101, 1},
+    {0x000008260451, 1102, 1},
+    {0x0000082604e1, 1103, 1},
+    {0x000008261008, 1104, 1},
+    {0x000008261011, 1105, 1},
+    {0x000008261050, 1106, 1},
+    {0x000008261061, 1107, 1},
+    {0x000008261209, 1108, 2},
+    {0x000008261212, 1110, 1},
+    {0x000008261248, 1111, 3},
+    {0x000008261290, 1114, 1},
+    {0x0000082612d0, 1115, 1},
+    {0x000008261440, 1116, 1},
+    {0x000008261488, 1117, 1},
+    {0x0000082614c8, 1118, 1},
+    {0x000008261510, 1119, 1},
+    {0x000008262009, 1120, 1},
+    {0x000008262012, 1121, 1},
+    {0x000008262051, 1122, 1},
+    {0x000008262062, 1123, 1},
+    {0x000008262201, 1124, 1},
+    {0x00000826220a, 1125, 1},
+    {0x000008262441, 1126, 1},
+    {0x000008269208, 1127, 1},
+    {0x000008269211, 1128, 1},
+    {0x000008269250, 1129, 1},
+    {0x000008269448, 1130, 1},
+    {0x0000082694d0, 1131, 1},
+    {0x00000826a209, 1132, 1},
+    {0x00000826a212, 1133, 1},
+    {0x000008288049, 1134, 1},
+    {0x000008288099, 1135, 1},
+    {0x000008288289, 1136, 1},
+    {0x000008288319, 1137, 1},
+    {0x000008289041, 1138, 1},
+    {0x00000828904a, 1139, 1},
+    {0x000008289089, 1140, 1},
+    {0x00000828909a, 1141, 1},
+    {0x000008289281, 1142, 1},
+    {0x000008290249, 1143, 1},
+    {0x000008290299, 1144, 1},
+    {0x000008290489, 1145, 1},
+    {0x000008290519, 1146, 1},
+    {0x000008291040, 1147, 1},
+    {0x000008291049, 1148, 1},
+    {0x000008291088, 1149, 1},
+    {0x000008291099, 1150, 1},
+    {0x000008291241, 1151, 1},
+    {0x000008291280, 1152, 1},
+    {0x000008291308, 1153, 1},
+    {0x000008291481, 1154, 1},
+    {0x000008292041, 1155, 1},
+    {0x00000829204a, 1156, 1},
+    {0x000008292089, 1157, 1},
+    {0x00000829209a, 1158, 1},
+    {0x000008292281, 1159, 1},
+    {0x000008298051, 1160, 1},
+    {0x0000082980a1, 1161, 1},
+    {0x000008298291, 1162, 1},
+    {0x000008298321, 1163, 1},
+    {0x000008299049, 1164, 1},
+    {0x000008299052, 1165, 1},
+    {0x000008299091, 1166, 1},
+    {0x0000082990a2, 1167, 1},
+    {0x0000082a0251, 1168, 1},
+    {0x0000082a02a1, 1169, 1},
+    {0x0000082a0491, 1170, 1},
+    {0x0000082a0521, 1171, 1},
+    {0x0000082a1048, 1172, 1},
+    {0x0000082a1051, 1173, 1},
+    {0x0000082a1090, 1174, 1},
+    {0x0000082a10a1, 1175, 1},
+    {0x0000082a1240, 1176, 1},
+    {0x0000082a1288, 1177, 2},
+    {0x0000082a1310, 1179, 1},
+    {0x0000082a1480, 1180, 1},
+    {0x0000082a1508, 1181, 1},
+    {0x0000082a2049, 1182, 1},
+    {0x0000082a2052, 1183, 1},
+    {0x0000082a2091, 1184, 1},
+    {0x0000082a20a2, 1185, 1},
+    {0x0000082a2241, 1186, 1},
+    {0x0000082a2481, 1187, 1},
+    {0x0000082a9248, 1188, 1},
+    {0x0000082a9290, 1189, 1},
+    {0x0000082a9488, 1190, 1},
+    {0x0000082a9510, 1191, 1},
+    {0x0000082d0009, 1192, 1},
+    {0x0000082d0059, 1193, 1},
+    {0x0000082d0249, 1194, 1},
+    {0x0000082d02d9, 1195, 1},
+    {0x0000082d100a, 1196, 1},
+    {0x0000082d1049, 1197, 1},
+    {0x0000082d105a, 1198, 1},
+    {0x0000082d1241, 1199, 1},
+    {0x0000082e0011, 1200, 1},
+    {0x0000082e0061, 1201, 1},
+    {0x0000082e0251, 1202, 1},
+    {0x0000082e02e1, 1203, 1},
+    {0x0000082e1009, 1204, 2},
+    {0x0000082e1012, 1206, 1},
+    {0x0000082e1048, 1207, 1},
+    {0x0000082e1051, 1208, 1},
+    {0x0000082e1059, 1209, 1},
+    {0x0000082e1062, 1210, 1},
+    {0x0000082e1240, 1211, 1},
+    {0x0000082e12c8, 1212, 1},
+    {0x0000082e200a, 1213, 1},
+    {0x0000082e2049, 1214, 1},
+    {0x0000082e205a, 1215, 1},
+    {0x0000082e2241, 1216, 1},
+    {0x0000082e9008, 1217, 1},
+    {0x0000082e9011, 1218, 1},
+    {0x0000082e9050, 1219, 1},
+    {0x0000082e9061, 1220, 1},
+    {0x0000082e9248, 1221, 1},
+    {0x0000082e92d0, 1222, 1},
+    {0x0000082ea009, 1223, 1},
+    {0x0000082ea012, 1224, 1},
+    {0x0000082ea051, 1225, 1},
+    {0x0000082ea062, 1226, 1},
+    {0x000008310049, 1227, 1},
+    {0x000008310099, 1228, 1},
+    {0x000008310289, 1229, 1},
+    {0x000008310319, 1230, 1},
+    {0x000008311041, 1231, 1},
+    {0x00000831104a, 1232, 1},
+    {0x000008311089, 1233, 1},
+    {0x00000831109a, 1234, 1},
+    {0x000008311281, 1235, 1},
+    {0x000008320051, 1236, 1},
+    {0x0000083200a1, 1237, 1},
+    {0x000008320291, 1238, 1},
+    {0x000008320321, 1239, 1},
+    {0x000008321040, 1240, 1},
+    {0x000008321049, 1241, 2},
+    {0x000008321052, 1243, 1},
+    {0x000008321088, 1244, 1},
+    {0x000008321091, 1245, 1},
+    {0x000008321099, 1246, 1},
+    {0x0000083210a2, 1247, 1},
+    {0x000008321280, 1248, 1},
+    {0x000008321308, 1249, 1},
+    {0x000008322041, 1250, 1},
+    {0x00000832204a, 1251, 1},
+    {0x000008322089, 1252, 1},
+    {0x00000832209a, 1253, 1},
+    {0x000008322281, 1254, 1},
+    {0x000008329048, 1255, 1},
+    {0x000008329051, 1256, 1},
+    {0x000008329090, 1257, 1},
+    {0x0000083290a1, 1258, 1},
+    {0x000008329288, 1259, 1},
+    {0x000008329310, 1260, 1},
+    {0x00000832a049, 1261, 1},
+    {0x00000832a052, 1262, 1},
+    {0x00000832a091, 1263, 1},
+    {0x00000832a0a2, 1264, 1},
+    {0x000008448209, 1265, 1},
+    {0x000008448259, 1266, 1},
+    {0x000008448449, 1267, 1},
+    {0x0000084484d9, 1268, 1},
+    {0x000008449201, 1269, 1},
+    {0x00000844920a, 1270, 1},
+    {0x000008449441, 1271, 1},
+    {0x000008451209, 1272, 1},
+    {0x000008451248, 1273, 1},
+    {0x000008451440, 1274, 1},
+    {0x0000084514c8, 1275, 1},
+    {0x000008452201, 1276, 1},
+    {0x00000845220a, 1277, 1},
+    {0x000008452441, 1278, 1},
+    {0x000008458211, 1279, 1},
+    {0x000008458261, 1280, 1},
+    {0x000008458451, 1281, 1},
+    {0x0000084584e1, 1282, 1},
+    {0x000008459209, 1283, 1},
+    {0x000008459212, 1284, 1},
+    {0x000008461208, 1285, 1},
+    {0x000008461211, 1286, 1},
+    {0x000008461250, 1287, 1},
+    {0x000008461448, 1288, 1},
+    {0x0000084614d0, 1289, 1},
+    {0x000008462209, 1290, 1},
+    {0x000008462212, 1291, 1},
+    {0x000008488249, 1292, 1},
+    {0x000008488299, 1293, 1},
+    {0x000008488489, 1294, 1},
+    {0x000008488519, 1295, 1},
+    {0x000008489241, 1296, 1},
+    {0x000008489481, 1297, 1},
+    {0x000008491240, 1298, 1},
+    {0x000008491288, 1299, 1},
+    {0x000008491480, 1300, 1},
+    {0x000008491508, 1301, 1},
+    {0x000008492241, 1302, 1},
+    {0x000008492481, 1303, 1},
+    {0x000008498251, 1304, 1},
+    {0x0000084982a1, 1305, 1},
+    {0x000008498491, 1306, 1},
+    {0x000008498521, 1307, 1},
+    {0x0000084a1248, 1308, 1},
+    {0x0000084a1290, 1309, 1},
+    {0x0000084a1488, 1310, 1},
+    {0x0000084a1510, 1311, 1},
+    {0x0000084d0209, 1312, 1},
+    {0x0000084d0259, 1313, 1},
+    {0x0000084d0449, 1314, 1},
+    {0x0000084d04d9, 1315, 1},
+    {0x0000084d1201, 1316, 1},
+    {0x0000084d120a, 1317, 1},
+    {0x0000084d1441, 1318, 1},
+    {0x0000084e0211, 1319, 1},
+    {0x0000084e0261, 1320, 1},
+    {0x0000084e0451, 1321, 1},
+    {0x0000084e04e1, 1322, 1},
+    {0x0000084e1209, 1323, 2},
+    {0x0000084e1212, 1325, 1},
+    {0x0000084e1248, 1326, 1},
+    {0x0000084e1440, 1327, 1},
+    {0x0000084e14c8, 1328, 1},
+    {0x0000084e2201, 1329, 1},
+    {0x0000084e220a, 1330, 1},
+    {0x0000084e2441, 1331, 1},
+    {0x0000084e9208, 1332, 1},
+    {0x0000084e9211, 1333, 1},
+    {0x0000084e9250, 1334, 1},
+    {0x0000084e9448, 1335, 1},
+    {0x0000084e94d0, 1336, 1},
+    {0x0000084ea209, 1337, 1},
+    {0x0000084ea212, 1338, 1},
+    {0x000008510249, 1339, 1},
+    {0x000008510299, 1340, 1},
+    {0x000008510489, 1341, 1},
+    {0x000008510519, 1342, 1},
+    {0x000008511241, 1343, 1},
+    {0x000008511481, 1344, 1},
+    {0x000008520251, 1345, 1},
+    {0x0000085202a1, 1346, 1},
+    {0x000008520491, 1347, 1},
+    {0x000008520521, 1348, 1},
+    {0x000008521240, 1349, 1},
+    {0x000008521288, 1350, 1},
+    {0x000008521480, 1351, 1},
+    {0x000008521508, 1352, 1},
+    {0x000008522241, 1353, 1},
+    {0x000008522481, 1354, 1},
+    {0x000008529248, 1355, 1},
+    {0x000008529290, 1356, 1},
+    {0x000008529488, 1357, 1},
+    {0x000008529510, 1358, 1},
+    {0x00000900124a, 1359, 1},
+    {0x0000090012c9, 1360, 1},
+    {0x0000090012da, 1361, 1},
+    {0x000009008248, 1362, 1},
+    {0x000009008251, 1363, 1},
+    {0x0000090082d0, 1364, 1},
+    {0x0000090082e1, 1365, 1},
+    {0x000009009249, 1366, 3},
+    {0x000009009252, 1369, 1},
+    {0x0000090092c8, 1370, 2},
+    {0x0000090092d1, 1372, 1},
+    {0x0000090092d9, 1373, 2},
+    {0x0000090092e2, 1375, 1},
+    {0x00000900a24a, 1376, 1},
+    {0x00000900a2c9, 1377, 1},
+    {0x00000900a2da, 1378, 1},
+    {0x00000900b24a, 1379, 1},
+    {0x00000900b2c9, 1380, 1},
+    {0x00000900b2da, 1381, 1},
+    {0x000009011248, 1382, 1},
+    {0x000009011251, 1383, 1},
+    {0x0000090112d0, 1384, 1},
+    {0x0000090112e1, 1385, 1},
+    {0x000009012249, 1386, 2},
+    {0x000009012252, 1388, 1},
+    {0x0000090122c8, 1389, 1},
+    {0x0000090122d1, 1390, 1},
+    {0x0000090122d9, 1391, 1},
+    {0x0000090122e2, 1392, 1},
+    {0x00000901424a, 1393, 1},
+    {0x0000090142c9, 1394, 1},
+    {0x0000090142da, 1395, 1},
+    {0x000009019248, 1396, 1},
+    {0x000009019251, 1397, 1},
+    {0x0000090192d0, 1398, 1},
+    {0x0000090192e1, 1399, 1},
+    {0x00000901b249, 1400, 1},
+    {0x00000901b252, 1401, 1},
+    {0x00000901b2d1, 1402, 1},
+    {0x00000901b2e2, 1403, 1},
+    {0x000009022248, 1404, 1},
+    {0x000009022251, 1405, 1},
+    {0x0000090222d0, 1406, 1},
+    {0x0000090222e1, 1407, 1},
+    {0x000009024249, 1408, 1},
+    {0x000009024252, 1409, 1},
+    {0x0000090242d1, 1410, 1},
+    {0x0000090242e2, 1411, 1},
+    {0x00000904104a, 1412, 1},
+    {0x000009041089, 1413, 1},
+    {0x00000904109a, 1414, 1},
+    {0x00000904128a, 1415, 1},
+    {0x000009041309, 1416, 1},
+    {0x00000904131a, 1417, 1},
+    {0x000009048051, 1418, 1},
+    {0x000009048059, 1419, 1},
+    {0x0000090480a1, 1420, 1},
+    {0x000009048240, 1421, 1},
+    {0x000009048249, 1422, 1},
+    {0x000009048288, 1423, 1},
+    {0x000009048291, 1424, 1},
+    {0x0000090482c8, 1425, 1},
+    {0x0000090482d9, 1426, 1},
+    {0x000009048310, 1427, 1},
+    {0x000009048321, 1428, 1},
+    {0x000009049049, 1429, 4},
+    {0x000009049052, 1433, 1},
+    {0x00000904905a, 1434, 1},
+    {0x000009049088, 1435, 2},
+    {0x000009049091, 1437, 1},
+    {0x000009049099, 1438, 2},
+    {0x0000090490a2, 1440, 1},
+    {0x000009049241, 1441, 1},
+    {0x000009049280, 1442, 2},
+    {0x000009049308, 1444, 2},
+    {0x00000904a089, 1446, 1},
+    {0x00000904a09a, 1447, 1},
+    {0x00000904a281, 1448, 1},
+    {0x00000904b089, 1449, 1},
+    {0x00000904b09a, 1450, 1},
+    {0x00000904b281, 1451, 1},
+    {0x000009050061, 1452, 1},
+    {0x000009050248, 1453, 1},
+    {0x000009050251, 1454, 1},
+    {0x0000090502d0, 1455, 1},
+    {0x0000090502e1, 1456, 1},
+    {0x000009051048, 1457, 2},
+    {0x000009051051, 1459, 2},
+    {0x000009051059, 1461, 1},
+    {0x000009051062, 1462, 1},
+    {0x000009051090, 1463, 1},
+    {0x0000090510a1, 1464, 1},
+    {0x000009051240, 1465, 1},
+    {0x000009051288, 1466, 1},
+    {0x0000090512c8, 1467, 1},
+    {0x000009051310, 1468, 1},
+    {0x000009052052, 1469, 1},
+    {0x000009052088, 1470, 1},
+    {0x000009052091, 1471, 1},
+    {0x000009052099, 1472, 1},
+    {0x0000090520a2, 1473, 1},
+    {0x000009052280, 1474, 1},
+    {0x000009052308, 1475, 1},
+    {0x00000905305a, 1476, 1},
+    {0x000009053241, 1477, 1},
+    {0x000009054089, 1478, 1},
+    {0x00000905409a, 1479, 1},
+    {0x000009054281, 1480, 1},
+    {0x000009059048, 1481, 2},
+    {0x000009059051, 1483, 1},
+    {0x000009059059, 1484, 1},
+    {0x000009059090, 1485, 1},
+    {0x0000090590a1, 1486, 1},
+    {0x000009059240, 1487, 1},
+    {0x000009059288, 1488, 1},
+    {0x0000090592c8, 1489, 1},
+    {0x000009059310, 1490, 1},
+    {0x00000905a05a, 1491, 1},
+    {0x00000905a241, 1492, 1},
+    {0x00000905b091, 1493, 1},
+    {0x00000905b0a2, 1494, 1},
+    {0x000009061050, 1495, 2},
+    {0x000009061061, 1497, 2},
+    {0x000009061248, 1499, 2},
+    {0x0000090612d0, 1501, 2},
+    {0x000009062051, 1503, 2},
+    {0x000009062059, 1505, 1},
+    {0x000009062062, 1506, 1},
+    {0x000009062090, 1507, 1},
+    {0x0000090620a1, 1508, 1},
+    {0x000009062240, 1509, 1},
+    {0x000009062288, 1510, 1},
+    {0x0000090622c8, 1511, 1},
+    {0x000009062310, 1512, 1},
+    {0x000009063062, 1513, 1},
+    {0x000009064091, 1514, 1},
+    {0x0000090640a2, 1515, 1},
+    {0x000009064241, 1516, 1},
+    {0x00000906a050, 1517, 1},
+    {0x00000906a061, 1518, 1},
+    {0x00000906a248, 1519, 1},
+    {0x00000906a2d0, 1520, 1},
+    {0x00000906c062, 1521, 1},
+    {0x000009088049, 1522, 1},
+    {0x000009088099, 1523, 1},
+    {0x000009088280, 1524, 1},
+    {0x000009088289, 1525, 1},
+    {0x000009088308, 1526, 1},
+    {0x000009088319, 1527, 1},
+    {0x000009089041, 1528, 1},
+    {0x00000908904a, 1529, 1},
+    {0x000009089089, 1530, 1},
+    {0x00000908909a, 1531, 1},
+    {0x000009089281, 1532, 1},
+    {0x000009090051, 1533, 1},
+    {0x0000090900a1, 1534, 1},
+    {0x000009090288, 1535, 1},
+    {0x000009090291, 1536, 1},
+    {0x000009090310, 1537, 1},
+    {0x000009090321, 1538, 1},
+    {0x000009091049, 1539, 2},
+    {0x000009091052, 1541, 1},
+    {0x000009091091, 1542, 1},
+    {0x000009091099, 1543, 1},
+    {0x0000090910a2, 1544, 1},
+    {0x000009091280, 1545, 1},
+    {0x000009091308, 1546, 1},
+    {0x000009093041, 1547, 1},
+    {0x00000909304a, 1548, 1},
+    {0x000009093089, 1549, 1},
+    {0x00000909309a, 1550, 1},
+    {0x000009093281, 1551, 1},
+    {0x000009099049, 1552, 1},
+    {0x000009099099, 1553, 1},
+    {0x000009099280, 1554, 1},
+    {0x000009099308, 1555, 1},
+    {0x00000909a041, 1556, 1},
+    {0x00000909a04a, 1557, 1},
+    {0x00000909a089, 1558, 1},
+    {0x00000909a09a, 1559, 1},
+    {0x00000909a281, 1560, 1},
+    {0x0000090a1051, 1561, 2},
+    {0x0000090a1090, 1563, 2},
+    {0x0000090a10a1, 1565, 2},
+    {0x0000090a1288, 1567, 2},
+    {0x0000090a1310, 1569, 2},
+    {0x0000090a2049, 1571, 2},
+    {0x0000090a2052, 1573, 1},
+    {0x0000090a2088, 1574, 1},
+    {0x0000090a2091, 1575, 1},
+    {0x0000090a2099, 1576, 1},
+    {0x0000090a20a2, 1577, 1},
+    {0x0000090a2280, 1578, 1},
+    {0x0000090a2308, 1579, 1},
+    {0x0000090a3049, 1580, 1},
+    {0x0000090a3052, 1581, 1},
+    {0x0000090a3091, 1582, 1},
+    {0x0000090a30a2, 1583, 1},
+    {0x0000090a4041, 1584, 1},
+    {0x0000090a404a, 1585, 1},
+    {0x0000090a4089, 1586, 1},
+    {0x0000090a409a, 1587, 1},
+    {0x0000090a4281, 1588, 1},
+    {0x0000090aa048, 1589, 1},
+    {0x0000090aa051, 1590, 1},
+    {0x0000090aa090, 1591, 1},
+    {0x0000090aa0a1, 1592, 1},
+    {0x0000090aa288, 1593, 1},
+    {0x0000090aa310, 1594, 1},
+    {0x0000090ac049, 1595, 1},
+    {0x0000090ac052, 1596, 1},
+    {0x0000090ac091, 1597, 1},
+    {0x0000090ac0a2, 1598, 1},
+    {0x000009201249, 1599, 1},
+    {0x00000920125a, 1600, 1},
+    {0x00000920144a, 1601, 1},
+    {0x0000092014c9, 1602, 1},
+    {0x0000092014da, 1603, 1},
+    {0x000009208250, 1604, 1},
+    {0x000009208261, 1605, 1},
+    {0x000009208448, 1606, 1},
+    {0x000009208451, 1607, 1},
+    {0x0000092084d0, 1608, 1},
+    {0x0000092084e1, 1609, 1},
+    {0x000009209248, 1610, 2},
+    {0x0000092094c8, 1612, 2},
+    {0x000009211250, 1614, 1},
+    {0x000009211448, 1615, 1},
+    {0x0000092114d0, 1616, 1},
+    {0x000009212248, 1617, 1},
+    {0x0000092124c8, 1618, 1},
+    {0x000009219250, 1619, 1},
+    {0x000009219448, 1620, 1},
+    {0x0000092194d0, 1621, 1},
+    {0x000009222250, 1622, 1},
+    {0x000009222448, 1623, 1},
+    {0x0000092224d0, 1624, 1},
+    {0x000009241049, 1625, 1},
+    {0x00000924105a, 1626, 1},
+    {0x000009248011, 1627, 1},
+    {0x000009248050, 1628, 1},
+    {0x000009248061, 1629, 1},
+    {0x000009248209, 1630, 1},
+    {0x000009248248, 1631, 3},
+    {0x000009248290, 1634, 1},
+    {0x0000092482d0, 1635, 1},
+    {0x000009248440, 1636, 1},
+    {0x000009248488, 1637, 1},
+    {0x0000092484c8, 1638, 1},
+    {0x000009248510, 1639, 1},
+    {0x000009249009, 1640, 3},
+    {0x000009249012, 1643, 1},
+    {0x000009249048, 1644, 2},
+    {0x000009249201, 1646, 1},
+    {0x000009249240, 1647, 4},
+    {0x000009249480, 1651, 2},
+    {0x00000924a00a, 1653, 1},
+    {0x00000924b00a, 1654, 1},
+    {0x000009250208, 1655, 1},
+    {0x000009250211, 1656, 1},
+    {0x000009250250, 1657, 1},
+    {0x000009250448, 1658, 1},
+    {0x0000092504d0, 1659, 1},
+    {0x000009251011, 1660, 1},
+    {0x000009251050, 1661, 1},
+    {0x000009251440, 1662, 1},
+    {0x000009252009, 1663, 2},
+    {0x000009252012, 1665, 1},
+    {0x000009252048, 1666, 1},
+    {0x000009252240, 1667, 2},
+    {0x000009252480, 1669, 1},
+    {0x000009253201, 1670, 1},
+    {0x00000925400a, 1671, 1},
+    {0x000009259011, 1672, 1},
+    {0x000009259050, 1673, 1},
+    {0x000009259440, 1674, 1},
+    {0x00000925a201, 1675, 1},
+    {0x00000925b009, 1676, 1},
+    {0x00000925b012, 1677, 1},
+    {0x000009261208, 1678, 2},
+    {0x000009262011, 1680, 1},
+    {0x000009262050, 1681, 1},
+    {0x000009262440, 1682, 1},
+    {0x000009264009, 1683, 1},
+    {0x000009264012, 1684, 1},
+    {0x000009264201, 1685, 1},
+    {0x00000926a208, 1686, 1},
+    {0x00000928104a, 1687, 1},
+    {0x000009281089, 1688, 1},
+    {0x00000928109a, 1689, 1},
+    {0x000009288048, 1690, 1},
+    {0x000009288051, 1691, 1},
+    {0x000009288090, 1692, 1},
+    {0x0000092880a1, 1693, 1},
+    {0x000009288288, 1694, 2},
+    {0x000009288310, 1696, 1},
+    {0x000009288480, 1697, 1},
+    {0x000009288508, 1698, 1},
+    {0x000009289088, 1699, 2},
+    {0x000009289280, 1701, 2},
+    {0x00000928a041, 1703, 1},
+    {0x00000928b041, 1704, 1},
+    {0x000009290248, 1705, 1},
+    {0x000009290290, 1706, 1},
+    {0x000009290488, 1707, 1},
+    {0x000009290510, 1708, 1},
+    {0x000009291048, 1709, 1},
+    {0x000009291090, 1710, 1},
+    {0x000009291240, 1711, 1},
+    {0x000009291480, 1712, 1},
+    {0x000009292088, 1713, 1},
+    {0x000009292280, 1714, 1},
+    {0x000009294041, 1715, 1},
+    {0x000009299048, 1716, 1},
+    {0x000009299090, 1717, 1},
+    {0x000009299240, 1718, 1},
+    {0x000009299480, 1719, 1},
+    {0x0000092a2048, 1720, 1},
+    {0x0000092a2090, 1721, 1},
+    {0x0000092a2240, 1722, 1},
+    {0x0000092a2480, 1723, 1},
+    {0x0000092c8009, 1724, 1},
+    {0x0000092c8048, 1725, 1},
+    {0x0000092c8059, 1726, 1},
+    {0x0000092c82c8, 1727, 1},
+    {0x0000092c900a, 1728, 1},
+    {0x0000092d0011, 1729, 1},
+    {0x0000092d0050, 1730, 1},
+    {0x0000092d0061, 1731, 1},
+    {0x0000092d0248, 1732, 1},
+    {0x0000092d02d0, 1733, 1},
+    {0x0000092d1009, 1734, 2},
+    {0x0000092d1012, 1736, 1},
+    {0x0000092d1048, 1737, 1},
+    {0x0000092d300a, 1738, 1},
+    {0x0000092d9009, 1739, 1},
+    {0x0000092d9048, 1740, 1},
+    {0x0000092d9240, 1741, 1},
+    {0x0000092da00a, 1742, 1},
+    {0x0000092e1011, 1743, 2},
+    {0x0000092e1050, 1745, 2},
+    {0x0000092e2009, 1747, 2},
+    {0x0000092e2012, 1749, 1},
+    {0x0000092e2048, 1750, 1},
+    {0x0000092e2240, 1751, 1},
+    {0x0000092e3009, 1752, 1},
+    {0x0000092e3012, 1753, 1},
+    {0x0000092e400a, 1754, 1},
+    {0x0000092ea011, 1755, 1},
+    {0x0000092ea050, 1756, 1},
+    {0x0000092ec009, 1757, 1},
+    {0x0000092ec012, 1758, 1},
+    {0x000009308049, 1759, 1},
+    {0x000009308088, 1760, 1},
+    {0x000009308099, 1761, 1},
+    {0x000009308280, 1762, 1},
+    {0x000009308308, 1763, 1},
+    {0x000009309041, 1764, 1},
+    {0x000009310048, 1765, 1},
+    {0x000009310051, 1766, 1},
+    {0x000009310090, 1767, 1},
+    {0x0000093100a1, 1768, 1},
+    {0x000009310288, 1769, 1},
+    {0x000009310310, 1770, 1},
+    {0x000009311088, 1771, 1},
+    {0x000009311280, 1772, 1},
+    {0x000009313041, 1773, 1},
+    {0x000009319088, 1774, 1},
+    {0x000009319280, 1775, 1},
+    {0x00000931a041, 1776, 1},
+    {0x000009321048, 1777, 2},
+    {0x000009321090, 1779, 2},
+    {0x000009322088, 1781, 1},
+    {0x000009322280, 1782, 1},
+    {0x000009324041, 1783, 1},
+    {0x00000932a048, 1784, 1},
+    {0x00000932a090, 1785, 1},
+    {0x000009448208, 1786, 1},
+    {0x000009448211, 1787, 1},
+    {0x000009448250, 1788, 1},
+    {0x000009448448, 1789, 1},
+    {0x0000094484d0, 1790, 1},
+    {0x000009449440, 1791, 2},
+    {0x00000944a201, 1793, 1},
+    {0x00000944b201, 1794, 1},
+    {0x000009451208, 1795, 1},
+    {0x000009452440, 1796, 1},
+    {0x000009454201, 1797, 1},
+    {0x000009459208, 1798, 1},
+    {0x000009462208, 1799, 1},
+    {0x000009488248, 1800, 1},
+    {0x000009488290, 1801, 1},
+    {0x000009488488, 1802, 1},
+    {0x000009488510, 1803, 1},
+    {0x000009489480, 1804, 2},
+    {0x000009492240, 1806, 1},
+    {0x000009492480, 1807, 1},
+    {0x0000094c8209, 1808, 1},
+    {0x0000094c8248, 1809, 1},
+    {0x0000094c8440, 1810, 1},
+    {0x0000094c84c8, 1811, 1},
+    {0x0000094c9201, 1812, 1},
+    {0x0000094d0208, 1813, 1},
+    {0x0000094d0211, 1814, 1},
+    {0x0000094d0250, 1815, 1},
+    {0x0000094d0448, 1816, 1},
+    {0x0000094d04d0, 1817, 1},
+    {0x0000094d1440, 1818, 1},
+    {0x0000094d3201, 1819, 1},
+    {0x0000094d9440, 1820, 1},
+    {0x0000094da201, 1821, 1},
+    {0x0000094e1208, 1822, 2},
+    {0x0000094e2440, 1824, 1},
+    {0x0000094e4201, 1825, 1},
+    {0x0000094ea208, 1826, 1},
+    {0x000009508288, 1827, 1},
+    {0x000009508480, 1828, 1},
+    {0x000009508508, 1829, 1},
+    {0x000009510248, 1830, 1},
+    {0x000009510290, 1831, 1},
+    {0x000009510488, 1832, 1},
+    {0x000009510510, 1833, 1},
+    {0x000009511480, 1834, 1},
+    {0x000009519480, 1835, 1},
+    {0x000009522240, 1836, 1},
+    {0x000009522480, 1837, 1},
+    {0x00000a001249, 1838, 1},
+    {0x00000a0012d9, 1839, 1},
+    {0x00000a00324a, 1840, 1},
+    {0x00000a0032c9, 1841, 1},
+    {0x00000a0032da, 1842, 1},
+    {0x00000a009248, 1843, 1},
+    {0x00000a009251, 1844, 1},
+    {0x00000a0092d0, 1845, 1},
+    {0x00000a0092e1, 1846, 1},
+    {0x00000a00a249, 1847, 1},
+    {0x00000a00a2c8, 1848, 1},
+    {0x00000a00a2d9, 1849, 1},
+    {0x00000a00b249, 1850, 1},
+    {0x00000a00b252, 1851, 1},
+    {0x00000a00b2d1, 1852, 1},
+    {0x00000a00b2e2, 1853, 1},
+    {0x00000a00c24a, 1854, 1},
+    {0x00000a00c2c9, 1855, 1},
+    {0x00000a00c2da, 1856, 1},
+    {0x00000a012248, 1857, 1},
+    {0x00000a012251, 1858, 1},
+    {0x00000a0122d0, 1859, 1},
+    {0x00000a0122e1, 1860, 1},
+    {0x00000a014249, 1861, 1},
+    {0x00000a014252, 1862, 1},
+    {0x00000a0142d1, 1863, 1},
+    {0x00000a0142e2, 1864, 1},
+    {0x00000a041099, 1865, 1},
+    {0x00000a041289, 1866, 1},
+    {0x00000a041319, 1867, 1},
+    {0x00000a04309a, 1868, 1},
+    {0x00000a04328a, 1869, 1},
+    {0x00000a043309, 1870, 1},
+    {0x00000a04331a, 1871, 1},
+    {0x00000a049090, 1872, 1},
+    {0x00000a0490a1, 1873, 1},
+    {0x00000a049288, 1874, 1},
+    {0x00000a0492c8, 1875, 1},
+    {0x00000a049310, 1876, 1},
+    {0x00000a04a099, 1877, 1},
+    {0x00000a04a280, 1878, 1},
+    {0x00000a04a308, 1879, 1},
+    {0x00000a04b0a2, 1880, 1},
+    {0x00000a04b241, 1881, 1},
+    {0x00000a04c281, 1882, 1},
+    {0x00000a051248, 1883, 1},
+    {0x00000a0512d0, 1884, 1},
+    {0x00000a052090, 1885, 1},
+    {0x00000a0520a1, 1886, 1},
+    {0x00000a052288, 1887, 1},
+    {0x00000a052310, 1888, 1},
+    {0x00000a0540a2, 1889, 1},
+    {0x00000a05a2c8, 1890, 1},
+    {0x00000a05c241, 1891, 1},
+    {0x00000a062248, 1892, 1},
+    {0x00000a0622d0, 1893, 1},
+    {0x00000a089049, 1894, 1},
+    {0x00000a089099, 1895, 1},
+    {0x00000a089280, 1896, 1},
+    {0x00000a089308, 1897, 1},
+    {0x00000a08b041, 1898, 1},
+    {0x00000a08b04a, 1899, 1},
+    {0x00000a08b089, 1900, 1},
+    {0x00000a08b09a, 1901, 1},
+    {0x00000a08b281, 1902, 1},
+    {0x00000a091051, 1903, 1},
+    {0x00000a091090, 1904, 1},
+    {0x00000a0910a1, 1905, 1},
+    {0x00000a091288, 1906, 1},
+    {0x00000a091310, 1907, 1},
+    {0x00000a093049, 1908, 1},
+    {0x00000a093052, 1909, 1},
+    {0x00000a093091, 1910, 1},
+    {0x00000a0930a2, 1911, 1},
+    {0x00000a09a049, 1912, 1},
+    {0x00000a09a088, 1913, 1},
+    {0x00000a09a099, 1914, 1},
+    {0x00000a09a280, 1915, 1},
+    {0x00000a09a308, 1916, 1},
+    {0x00000a09c041, 1917, 1},
+    {0x00000a09c04a, 1918, 1},
+    {0x00000a09c089, 1919, 1},
+    {0x00000a09c09a, 1920, 1},
+    {0x00000a09c281, 1921, 1},
+    {0x00000a0a2051, 1922, 1},
+    {0x00000a0a2090, 1923, 1},
+    {0x00000a0a20a1, 1924, 1},
+    {0x00000a0a2288, 1925, 1},
+    {0x00000a0a2310, 1926, 1},
+    {0x00000a0a4049, 1927, 1},
+    {0x00000a0a4052, 1928, 1},
+    {0x00000a0a4091, 1929, 1},
+    {0x00000a0a40a2, 1930, 1},
+    {0x00000a201259, 1931, 1},
+    {0x00000a201449, 1932, 1},
+    {0x00000a2014d9, 1933, 1},
+    {0x00000a203249, 1934, 1},
+    {0x00000a20325a, 1935, 1},
+    {0x00000a20344a, 1936, 1},
+    {0x00000a2034c9, 1937, 1},
+    {0x00000a2034da, 1938, 1},
+    {0x00000a209250, 1939, 1},
+    {0x00000a209448, 1940, 1},
+    {0x00000a2094d0, 1941, 1},
+    {0x00000a20a248, 1942, 1},
+    {0x00000a20a4c8, 1943, 1},
+    {0x00000a212250, 1944, 1},
+    {0x00000a212448, 1945, 1},
+    {0x00000a2124d0, 1946, 1},
+    {0x00000a241059, 1947, 1},
+    {0x00000a243049, 1948, 1},
+    {0x00000a24305a, 1949, 1},
+    {0x00000a249011, 1950, 1},
+    {0x00000a249050, 1951, 1},
+    {0x00000a249440, 1952, 1},
+    {0x00000a24a048, 1953, 1},
+    {0x00000a24a480, 1954, 1},
+    {0x00000a24b012, 1955, 1},
+    {0x00000a24b201, 1956, 1},
+    {0x00000a24c00a, 1957, 1},
+    {0x00000a251208, 1958, 1},
+    {0x00000a252011, 1959, 1},
+    {0x00000a252050, 1960, 1},
+    {0x00000a254012, 1961, 1},
+    {0x00000a25a440, 1962, 1},
+    {0x00000a25c201, 1963, 1},
+    {0x00000a262208, 1964, 1},
+    {0x00000a281049, 1965, 1},
+    {0x00000a281099, 1966, 1},
+    {0x00000a28304a, 1967, 1},
+    {0x00000a283089, 1968, 1},
+    {0x00000a28309a, 1969, 1},
+    {0x00000a289048, 1970, 1},
+    {0x00000a289090, 1971, 1},
+    {0x00000a289480, 1972, 1},
+    {0x00000a28a088, 1973, 1},
+    {0x00000a28a280, 1974, 1},
+    {0x00000a28c041, 1975, 1},
+    {0x00000a292048, 1976, 1},
+    {0x00000a292090, 1977, 1},
+    {0x00000a29a480, 1978, 1},
+    {0x00000a2c9048, 1979, 1},
+    {0x00000a2cb00a, 1980, 1},
+    {0x00000a2d1011, 1981, 1},
+    {0x00000a2d1050, 1982, 1},
+    {0x00000a2d3012, 1983, 1},
+    {0x00000a2da048, 1984, 1},
+    {0x00000a2dc00a, 1985, 1},
+    {0x00000a2e2011, 1986, 1},
+    {0x00000a2e2050, 1987, 1},
+    {0x00000a2e4012, 1988, 1},
+    {0x00000a309088, 1989, 1},
+    {0x00000a309280, 1990, 1},
+    {0x00000a30b041, 1991, 1},
+    {0x00000a311048, 1992, 1},
+    {0x00000a311090, 1993, 1},
+    {0x00000a31a088, 1994, 1},
+    {0x00000a31a280, 1995, 1},
+    {0x00000a31c041, 1996, 1},
+    {0x00000a322048, 1997, 1},
+    {0x00000a322090, 1998, 1},
+    {0x00000a449208, 1999, 1},
+    {0x00000a44a440, 2000, 1},
+    {0x00000a44c201, 2001, 1},
+    {0x00000a452208, 2002, 1},
+    {0x00000a48a480, 2003, 1},
+    {0x00000a4cb201, 2004, 1},
+    {0x00000a4d1208, 2005, 1},
+    {0x00000a4da440, 2006, 1},
+    {0x00000a4dc201, 2007, 1},
+    {0x00000a4e2208, 2008, 1},
+    {0x00000a509480, 2009, 1},
+    {0x00000a51a480, 2010, 1},
+    {0x000011008249, 2011, 1},
+    {0x0000110082c8, 2012, 1},
+    {0x0000110082d9, 2013, 1},
+    {0x00001100924a, 2014, 1},
+    {0x0000110092c9, 2015, 1},
+    {0x0000110092da, 2016, 1},
+    {0x000011011249, 2017, 1},
+    {0x0000110112c8, 2018, 1},
+    {0x0000110112d9, 2019, 1},
+    {0x00001101224a, 2020, 1},
+    {0x0000110122c9, 2021, 1},
+    {0x0000110122da, 2022, 1},
+    {0x000011018248, 2023, 1},
+    {0x000011018251, 2024, 1},
+    {0x0000110182d0, 2025, 1},
+    {0x0000110182e1, 2026, 1},
+    {0x000011019249, 2027, 1},
+    {0x000011019252, 2028, 1},
+    {0x0000110192d1, 2029, 1},
+    {0x0000110192e2, 2030, 1},
+    {0x000011021248, 2031, 1},
+    {0x000011021251, 2032, 1},
+    {0x0000110212d0, 2033, 1},
+    {0x0000110212e1, 2034, 1},
+    {0x000011022249, 2035, 1},
+    {0x000011022252, 2036, 1},
+    {0x0000110222d1, 2037, 1},
+    {0x0000110222e2, 2038, 1},
+    {0x000011048280, 2039, 1},
+    {0x000011048289, 2040, 1},
+    {0x000011048308, 2041, 1},
+    {0x000011048319, 2042, 1},
+    {0x000011049281, 2043, 1},
+    {0x000011050249, 2044, 1},
+    {0x0000110502c8, 2045, 1},
+    {0x0000110502d9, 2046, 1},
+    {0x000011051241, 2047, 1},
+    {0x000011051280, 2048, 1},
+    {0x000011051308, 2049, 1},
+    {0x000011052281, 2050, 1},
+    {0x000011058288, 2051, 1},
+    {0x000011058291, 2052, 1},
+    {0x000011058310, 2053, 1},
+    {0x000011058321, 2054, 1},
+    {0x000011060248, 2055, 1},
+    {0x000011060251, 2056, 1},
+    {0x0000110602d0, 2057, 1},
+    {0x0000110602e1, 2058, 1},
+    {0x000011061288, 2059, 1},
+    {0x0000110612c8, 2060, 1},
+    {0x000011061310, 2061, 1},
+    {0x000011062241, 2062, 1},
+    {0x000011069248, 2063, 1},
+    {0x0000110692d0, 2064, 1},
+    {0x000011090049, 2065, 1},
+    {0x000011090099, 2066, 1},
+    {0x000011090280, 2067, 1},
+    {0x000011090289, 2068, 1},
+    {0x000011090308, 2069, 1},
+    {0x000011090319, 2070, 1},
+    {0x00001109104a, 2071, 1},
+    {0x000011091089, 2072, 1},
+    {0x00001109109a, 2073, 1},
+    {0x000011091281, 2074, 1},
+    {0x0000110a0051, 2075, 1},
+    {0x0000110a00a1, 2076, 1},
+    {0x0000110a0288, 2077, 1},
+    {0x0000110a0291, 2078, 1},
+    {0x0000110a0310, 2079, 1},
+    {0x0000110a0321, 2080, 1},
+    {0x0000110a1049, 2081, 2},
+    {0x0000110a1052, 2083, 1},
+    {0x0000110a1091, 2084, 1},
+    {0x0000110a1099, 2085, 1},
+    {0x0000110a10a2, 2086, 1},
+    {0x0000110a1280, 2087, 1},
+    {0x0000110a1308, 2088, 1},
+    {0x0000110a2089, 2089, 1},
+    {0x0000110a209a, 2090, 1},
+    {0x0000110a2281, 2091, 1},
+    {0x0000110a9051, 2092, 1},
+    {0x0000110a90a1, 2093, 1},
+    {0x0000110a9288, 2094, 1},
+    {0x0000110a9310, 2095, 1},
+    {0x0000110aa052, 2096, 1},
+    {0x0000110aa091, 2097, 1},
+    {0x0000110aa0a2, 2098, 1},
+    {0x000011208248, 2099, 1},
+    {0x000011208259, 2100, 1},
+    {0x000011208449, 2101, 1},
+    {0x0000112084c8, 2102, 1},
+    {0x0000112084d9, 2103, 1},
+    {0x000011211248, 2104, 1},
+    {0x0000112114c8, 2105, 1},
+    {0x000011218250, 2106, 1},
+    {0x000011218261, 2107, 1},
+    {0x000011218448, 2108, 1},
+    {0x000011218451, 2109, 1},
+    {0x0000112184d0, 2110, 1},
+    {0x0000112184e1, 2111, 1},
+    {0x000011221250, 2112, 1},
+    {0x000011221448, 2113, 1},
+    {0x0000112214d0, 2114, 1},
+    {0x000011248048, 2115, 1},
+    {0x000011248059, 2116, 1},
+    {0x000011248288, 2117, 1},
+    {0x0000112482c8, 2118, 1},
+    {0x000011248480, 2119, 1},
+    {0x000011248508, 2120, 1},
+    {0x000011250209, 2121, 1},
+    {0x000011250248, 2122, 1},
+    {0x0000112504c8, 2123, 1},
+    {0x000011251048, 2124, 1},
+    {0x000011251201, 2125, 1},
+    {0x000011251480, 2126, 1},
+    {0x000011258011, 2127, 1},
+    {0x000011258050, 2128, 1},
+    {0x000011258061, 2129, 1},
+    {0x000011258248, 2130, 2},
+    {0x000011258290, 2132, 1},
+    {0x0000112582d0, 2133, 1},
+    {0x000011258488, 2134, 1},
+    {0x000011258510, 2135, 1},
+    {0x000011259012, 2136, 1},
+    {0x000011260208, 2137, 1},
+    {0x000011260211, 2138, 1},
+    {0x000011260250, 2139, 1},
+    {0x000011260448, 2140, 1},
+    {0x0000112604d0, 2141, 1},
+    {0x000011261011, 2142, 1},
+    {0x000011261050, 2143, 1},
+    {0x000011262012, 2144, 1},
+    {0x000011262201, 2145, 1},
+    {0x000011269208, 2146, 1},
+    {0x000011288049, 2147, 1},
+    {0x000011288088, 2148, 1},
+    {0x000011288099, 2149, 1},
+    {0x000011288308, 2150, 1},
+    {0x000011289041, 2151, 1},
+    {0x000011290288, 2152, 1},
+    {0x000011290480, 2153, 1},
+    {0x000011290508, 2154, 1},
+    {0x000011291088, 2155, 1},
+    {0x000011291280, 2156, 1},
+    {0x000011292041, 2157, 1},
+    {0x000011298048, 2158, 1},
+    {0x000011298051, 2159, 1},
+    {0x000011298090, 2160, 1},
+    {0x0000112980a1, 2161, 1},
+    {0x000011298288, 2162, 1},
+    {0x000011298310, 2163, 1},
+    {0x0000112a0248, 2164, 1},
+    {0x0000112a0290, 2165, 1},
+    {0x0000112a0488, 2166, 1},
+    {0x0000112a0510, 2167, 1},
+    {0x0000112a1048, 2168, 1},
+    {0x0000112a1090, 2169, 1},
+    {0x0000112a1480, 2170, 1},
+    {0x0000112d0048, 2171, 1},
+    {0x0000112d0059, 2172, 1},
+    {0x0000112d02c8, 2173, 1},
+    {0x0000112e0011, 2174, 1},
+    {0x0000112e0050, 2175, 1},
+    {0x0000112e0061, 2176, 1},
+    {0x0000112e0248, 2177, 1},
+    {0x0000112e02d0, 2178, 1},
+    {0x0000112e1012, 2179, 1},
+    {0x0000112e1048, 2180, 1},
+    {0x0000112e9011, 2181, 1},
+    {0x0000112e9050, 2182, 1},
+    {0x0000112ea012, 2183, 1},
+    {0x000011310049, 2184, 1},
+    {0x000011310088, 2185, 1},
+    {0x000011310099, 2186, 1},
+    {0x000011310308, 2187, 1},
+    {0x000011311041, 2188, 1},
+    {0x000011320048, 2189, 1},
+    {0x000011320051, 2190, 1},
+    {0x000011320090, 2191, 1},
+    {0x0000113200a1, 2192, 1},
+    {0x000011320288, 2193, 1},
+    {0x000011320310, 2194, 1},
+    {0x000011321088, 2195, 1},
+    {0x000011321280, 2196, 1},
+    {0x000011322041, 2197, 1},
+    {0x000011329048, 2198, 1},
+    {0x000011329090, 2199, 1},
+    {0x000011448209, 2200, 1},
+    {0x000011448248, 2201, 1},
+    {0x0000114484c8, 2202, 1},
+    {0x000011449201, 2203, 1},
+    {0x000011452201, 2204, 1},
+    {0x000011458208, 2205, 1},
+    {0x000011458211, 2206, 1},
+    {0x000011458250, 2207, 1},
+    {0x000011458448, 2208, 1},
+    {0x0000114584d0, 2209, 1},
+    {0x000011461208, 2210, 1},
+    {0x000011488288, 2211, 1},
+    {0x000011488480, 2212, 1},
+    {0x000011488508, 2213, 1},
+    {0x000011491480, 2214, 1},
+    {0x000011498248, 2215, 1},
+    {0x000011498290, 2216, 1},
+    {0x000011498488, 2217, 1},
+    {0x000011498510, 2218, 1},
+    {0x0000114d0209, 2219, 1},
+    {0x0000114d0248, 2220, 1},
+    {0x0000114d04c8, 2221, 1},
+    {0x0000114d1201, 2222, 1},
+    {0x0000114e0208, 2223, 1},
+    {0x0000114e0211, 2224, 1},
+    {0x0000114e0250, 2225, 1},
+    {0x0000114e0448, 2226, 1},
+    {0x0000114e04d0, 2227, 1},
+    {0x0000114e2201, 2228, 1},
+    {0x0000114e9208, 2229, 1},
+    {0x000011510288, 2230, 1},
+    {0x000011510480, 2231, 1},
+    {0x000011510508, 2232, 1},
+    {0x000011520248, 2233, 1},
+    {0x000011520290, 2234, 1},
+    {0x000011520488, 2235, 1},
+    {0x000011520510, 2236, 1},
+    {0x000011521480, 2237, 1},
+    {0x000012009249, 2238, 1},
+    {0x0000120092c8, 2239, 1},
+    {0x0000120092d9, 2240, 1},
+    {0x00001200b24a, 2241, 1},
+    {0x00001200b2c9, 2242, 1},
+    {0x00001200b2da, 2243, 1},
+    {0x000012012249, 2244, 1},
+    {0x0000120122c8, 2245, 1},
+    {0x0000120122d9, 2246, 1},
+    {0x00001201424a, 2247, 1},
+    {0x0000120142c9, 2248, 1},
+    {0x0000120142da, 2249, 1},
+    {0x000012019248, 2250, 1},
+    {0x000012019251, 2251, 1},
+    {0x0000120192d0, 2252, 1},
+    {0x0000120192e1, 2253, 1},
+    {0x00001201b249, 2254, 1},
+    {0x00001201b252, 2255, 1},
+    {0x00001201b2d1, 2256, 1},
+    {0x00001201b2e2, 2257, 1},
+    {0x000012022248, 2258, 1},
+    {0x000012022251, 2259, 1},
+    {0x0000120222d0, 2260, 1},
+    {0x0000120222e1, 2261, 1},
+    {0x000012024249, 2262, 1},
+    {0x000012024252, 2263, 1},
+    {0x0000120242d1, 2264, 1},
+    {0x0000120242e2, 2265, 1},
+    {0x000012049308, 2266, 1},
+    {0x00001204b281, 2267, 1},
+    {0x0000120512c8, 2268, 1},
+    {0x000012052308, 2269, 1},
+    {0x000012053241, 2270, 1},
+    {0x000012054281, 2271, 1},
+    {0x000012059288, 2272, 1},
+    {0x000012059310, 2273, 1},
+    {0x000012061248, 2274, 1},
+    {0x0000120612d0, 2275, 1},
+    {0x000012062288, 2276, 1},
+    {0x0000120622c8, 2277, 1},
+    {0x000012062310, 2278, 1},
+    {0x000012064241, 2279, 1},
+    {0x00001206a248, 2280, 1},
+    {0x00001206a2d0, 2281, 1},
+    {0x000012091099, 2282, 1},
+    {0x000012091308, 2283, 1},
+    {0x00001209309a, 2284, 1},
+    {0x000012093281, 2285, 1},
+    {0x0000120a10a1, 2286, 1},
+    {0x0000120a1288, 2287, 1},
+    {0x0000120a1310, 2288, 1},
+    {0x0000120a2099, 2289, 1},
+    {0x0000120a2308, 2290, 1},
+    {0x0000120a30a2, 2291, 1},
+    {0x0000120a4281, 2292, 1},
+    {0x0000120aa090, 2293, 1},
+    {0x0000120aa0a1, 2294, 1},
+    {0x0000120aa288, 2295, 1},
+    {0x0000120aa310, 2296, 1},
+    {0x0000120ac0a2, 2297, 1},
+    {0x000012209248, 2298, 1},
+    {0x0000122094c8, 2299, 1},
+    {0x000012212248, 2300, 1},
+    {0x0000122124c8, 2301, 1},
+    {0x000012219250, 2302, 1},
+    {0x000012219448, 2303, 1},
+    {0x0000122194d0, 2304, 1},
+    {0x000012222250, 2305, 1},
+    {0x000012222448, 2306, 1},
+    {0x0000122224d0, 2307, 1},
+    {0x000012249048, 2308, 1},
+    {0x000012249480, 2309, 1},
+    {0x000012252048, 2310, 1},
+    {0x000012252480, 2311, 1},
+    {0x000012253201, 2312, 1},
+    {0x000012259050, 2313, 1},
+    {0x00001225b012, 2314, 1},
+    {0x000012261208, 2315, 1},
+    {0x000012262050, 2316, 1},
+    {0x000012264012, 2317, 1},
+    {0x000012264201, 2318, 1},
+    {0x00001226a208, 2319, 1},
+    {0x000012289088, 2320, 1},
+    {0x00001228b041, 2321, 1},
+    {0x000012291480, 2322, 1},
+    {0x000012292088, 2323, 1},
+    {0x000012294041, 2324, 1},
+    {0x000012299048, 2325, 1},
+    {0x000012299090, 2326, 1},
+    {0x0000122a2048, 2327, 1},
+    {0x0000122a2090, 2328, 1},
+    {0x0000122a2480, 2329, 1},
+    {0x0000122d1048, 2330, 1},
+    {0x0000122e1050, 2331, 1},
+    {0x0000122e2048, 2332, 1},
+    {0x0000122e3012, 2333, 1},
+    {0x0000122ea050, 2334, 1},
+    {0x0000122ec012, 2335, 1},
+    {0x000012311088, 2336, 1},
+    {0x000012313041, 2337, 1},
+    {0x000012321048, 2338, 1},
+    {0x000012321090, 2339, 1},
+    {0x000012322088, 2340, 1},
+    {0x000012324041, 2341, 1},
+    {0x00001232a048, 2342, 1},
+    {0x00001232a090, 2343, 1},
+    {0x00001244b201, 2344, 1},
+    {0x000012454201, 2345, 1},
+    {0x000012459208, 2346, 1},
+    {0x000012462208, 2347, 1},
+    {0x000012492480, 2348, 1},
+    {0x0000124d3201, 2349, 1},
+    {0x0000124e1208, 2350, 1},
+    {0x0000124e4201, 2351, 1},
+    {0x0000124ea208, 2352, 1},
+    {0x000012522480, 2353, 1},
+    {0x000041041059, 2354, 1},
+    {0x000041041249, 2355, 1},
+    {0x0000410412d9, 2356, 1},
+    {0x000041043049, 2357, 1},
+    {0x00004104305a, 2358, 1},
+    {0x00004104324a, 2359, 1},
+    {0x0000410432c9, 2360, 1},
+    {0x0000410432da, 2361, 1},
+    {0x000041049061, 2362, 1},
+    {0x000041049248, 2363, 1},
+    {0x0000410492d0, 2364, 1},
+    {0x00004104a059, 2365, 1},
+    {0x00004104a2c8, 2366, 1},
+    {0x00004104b051, 2367, 1},
+    {0x00004104b062, 2368, 1},
+    {0x00004104c049, 2369, 1},
+    {0x00004104c05a, 2370, 1},
+    {0x00004104c241, 2371, 1},
+    {0x000041052061, 2372, 1},
+    {0x000041052248, 2373, 1},
+    {0x0000410522d0, 2374, 1},
+    {0x000041054051, 2375, 1},
+    {0x000041054062, 2376, 1},
+    {0x0000410892c8, 2377, 1},
+    {0x00004108b049, 2378, 1},
+    {0x00004108b05a, 2379, 1},
+    {0x00004108b241, 2380, 1},
+    {0x000041091248, 2381, 1},
+    {0x0000410912d0, 2382, 1},
+    {0x000041093051, 2383, 1},
+    {0x000041093062, 2384, 1},
+    {0x00004109a059, 2385, 1},
+    {0x00004109a2c8, 2386, 1},
+    {0x00004109c049, 2387, 1},
+    {0x00004109c05a, 2388, 1},
+    {0x00004109c241, 2389, 1},
+    {0x0000410a2061, 2390, 1},
+    {0x0000410a2248, 2391, 1},
+    {0x0000410a22d0, 2392, 1},
+    {0x0000410a4051, 2393, 1},
+    {0x0000410a4062, 2394, 1},
+    {0x0000410c1289, 2395, 1},
+    {0x0000410c1319, 2396, 1},
+    {0x0000410c304a, 2397, 1},
+    {0x0000410c309a, 2398, 1},
+    {0x0000410c328a, 2399, 1},
+    {0x0000410c3309, 2400, 1},
+    {0x0000410c331a, 2401, 1},
+    {0x0000410c9288, 2402, 1},
+    {0x0000410c9310, 2403, 1},
+    {0x0000410ca308, 2404, 1},
+    {0x0000410cb049, 2405, 1},
+    {0x0000410cb052, 2406, 1},
+    {0x0000410cb0a2, 2407, 1},
+    {0x0000410cc041, 2408, 1},
+    {0x0000410cc04a, 2409, 1},
+    {0x0000410cc089, 2410, 1},
+    {0x0000410cc09a, 2411, 1},
+    {0x0000410cc281, 2412, 1},
+    {0x0000410d2288, 2413, 1},
+    {0x0000410d2310, 2414, 1},
+    {0x0000410d4049, 2415, 1},
+    {0x0000410d4052, 2416, 1},
+    {0x0000410d4091, 2417, 1},
+    {0x0000410d40a2, 2418, 1},
+    {0x000041109308, 2419, 1},
+    {0x00004110b281, 2420, 1},
+    {0x000041111288, 2421, 1},
+    {0x000041111310, 2422, 1},
+    {0x00004111a308, 2423, 1},
+    {0x00004111c041, 2424, 1},
+    {0x00004111c04a, 2425, 1},
+    {0x00004111c09a, 2426, 1},
+    {0x00004111c281, 2427, 1},
+    {0x000041122288, 2428, 1},
+    {0x000041122310, 2429, 1},
+    {0x000041124049, 2430, 1},
+    {0x000041124052, 2431, 1},
+    {0x0000411240a2, 2432, 1},
+    {0x000041249208, 2433, 1},
+    {0x00004124c201, 2434, 1},
+    {0x000041252208, 2435, 1},
+    {0x000041281059, 2436, 1},
+    {0x000041283049, 2437, 1},
+    {0x00004128305a, 2438, 1},
+    {0x000041289050, 2439, 1},
+    {0x00004128a048, 2440, 1},
+    {0x00004128b201, 2441, 1},
+    {0x000041291208, 2442, 1},
+    {0x000041292050, 2443, 1},
+    {0x00004129c201, 2444, 1},
+    {0x0000412a2208, 2445, 1},
+    {0x000041301049, 2446, 1},
+    {0x000041301099, 2447, 1},
+    {0x00004130304a, 2448, 1},
+    {0x000041303089, 2449, 1},
+    {0x00004130309a, 2450, 1},
+    {0x000041309048, 2451, 2},
+    {0x000041309090, 2453, 1},
+    {0x00004130a088, 2454, 1},
+    {0x00004130c041, 2455, 1},
+    {0x000041311050, 2456, 1},
+    {0x000041312048, 2457, 1},
+    {0x000041312090, 2458, 1},
+    {0x00004131a048, 2459, 1},
+    {0x000041322050, 2460, 1},
+    {0x000041349088, 2461, 1},
+    {0x00004134b041, 2462, 1},
+    {0x000041351048, 2463, 1},
+    {0x000041351090, 2464, 1},
+    {0x00004135a088, 2465, 1},
+    {0x00004135c041, 2466, 1},
+    {0x000041362048, 2467, 1},
+    {0x000041362090, 2468, 1},
+    {0x00004148c201, 2469, 1},
+    {0x000041492208, 2470, 1},
+    {0x00004150b201, 2471, 1},
+    {0x00004151c201, 2472, 1},
+    {0x000041522208, 2473, 1},
+    {0x000048008251, 2474, 1},
+    {0x0000480082e1, 2475, 1},
+    {0x000048009249, 2476, 2},
+    {0x000048009252, 2478, 1},
+    {0x0000480092c8, 2479, 1},
+    {0x0000480092d1, 2480, 1},
+    {0x0000480092d9, 2481, 1},
+    {0x0000480092e2, 2482, 1},
+    {0x00004800a24a, 2483, 1},
+    {0x00004800a2c9, 2484, 1},
+    {0x00004800a2da, 2485, 1},
+    {0x000048011248, 2486, 1},
+    {0x000048011251, 2487, 1},
+    {0x0000480112d0, 2488, 1},
+    {0x0000480112e1, 2489, 1},
+    {0x000048012249, 2490, 1},
+    {0x000048012252, 2491, 1},
+    {0x0000480122d1, 2492, 1},
+    {0x0000480122e2, 2493, 1},
+    {0x00004804128a, 2494, 1},
+    {0x000048041309, 2495, 1},
+    {0x00004804131a, 2496, 1},
+    {0x000048048249, 2497, 2},
+    {0x000048048291, 2499, 1},
+    {0x0000480482d9, 2500, 2},
+    {0x000048048321, 2502, 1},
+    {0x000048049241, 2503, 2},
+    {0x000048049308, 2505, 1},
+    {0x00004804a281, 2506, 1},
+    {0x000048050251, 2507, 1},
+    {0x0000480502e1, 2508, 1},
+    {0x000048051288, 2509, 1},
+    {0x0000480512c8, 2510, 1},
+    {0x000048051310, 2511, 1},
+    {0x000048052241, 2512, 1},
+    {0x000048058251, 2513, 1},
+    {0x0000480582e1, 2514, 1},
+    {0x0000480592c8, 2515, 1},
+    {0x00004805a241, 2516, 1},
+    {0x000048061248, 2517, 2},
+    {0x0000480612d0, 2519, 2},
+    {0x000048089281, 2521, 1},
+    {0x000048090249, 2522, 1},
+    {0x000048090291, 2523, 1},
+    {0x0000480902d9, 2524, 1},
+    {0x000048090321, 2525, 1},
+    {0x000048091241, 2526, 1},
+    {0x000048099308, 2527, 1},
+    {0x00004809a281, 2528, 1},
+    {0x0000480a0251, 2529, 1},
+    {0x0000480a02e1, 2530, 1},
+    {0x0000480a1288, 2531, 1},
+    {0x0000480a12c8, 2532, 1},
+    {0x0000480a1310, 2533, 1},
+    {0x0000480a2241, 2534, 1},
+    {0x0000480a9248, 2535, 1},
+    {0x0000480a92d0, 2536, 1},
+    {0x0000480c9281, 2537, 1},
+    {0x0000480d1308, 2538, 1},
+    {0x0000480d2281, 2539, 1},
+    {0x0000480d8291, 2540, 1},
+    {0x0000480d8321, 2541, 1},
+    {0x0000480e1288, 2542, 1},
+    {0x0000480e1310, 2543, 1},
+    {0x000048111281, 2544, 1},
+    {0x000048120291, 2545, 1},
+    {0x000048120321, 2546, 1},
+    {0x000048121308, 2547, 1},
+    {0x000048122281, 2548, 1},
+    {0x000048129288, 2549, 1},
+    {0x000048129310, 2550, 1},
+    {0x000048209248, 2551, 1},
+    {0x0000482094c8, 2552, 1},
+    {0x000048211250, 2553, 1},
+    {0x000048211448, 2554, 1},
+    {0x0000482114d0, 2555, 1},
+    {0x000048249048, 2556, 1},
+    {0x000048249201, 2557, 2},
+    {0x000048251050, 2559, 1},
+    {0x000048252201, 2560, 1},
+    {0x00004825a201, 2561, 1},
+    {0x000048291048, 2562, 2},
+    {0x000048291090, 2564, 1},
+    {0x000048291201, 2565, 1},
+    {0x0000482a1050, 2566, 1},
+    {0x0000482a2201, 2567, 1},
+    {0x0000482d9048, 2568, 1},
+    {0x0000482e1050, 2569, 1},
+    {0x000048321048, 2570, 3},
+    {0x000048321090, 2573, 2},
+    {0x000048329050, 2575, 1},
+    {0x000048369048, 2576, 1},
+    {0x000048369090, 2577, 1},
+    {0x00004844a201, 2578, 1},
+    {0x000048492201, 2579, 1},
+    {0x0000484da201, 2580, 1},
+    {0x000048522201, 2581, 1},
+    {0x000049001249, 2582, 1},
+    {0x0000490012d9, 2583, 1},
+    {0x00004900324a, 2584, 1},
+    {0x0000490032c9, 2585, 1},
+    {0x0000490032da, 2586, 1},
+    {0x000049009248, 2587, 1},
+    {0x0000490092d0, 2588, 1},
+    {0x00004900a2c8, 2589, 1},
+    {0x000049012248, 2590, 1},
+    {0x0000490122d0, 2591, 1},
+    {0x000049040249, 2592, 1},
+    {0x0000490402c8, 2593, 1},
+    {0x0000490402d9, 2594, 1},
+    {0x000049041049, 2595, 2},
+    {0x00004904105a, 2597, 1},
+    {0x000049041241, 2598, 1},
+    {0x000049041308, 2599, 1},
+    {0x000049043089, 2600, 1},
+    {0x00004904309a, 2601, 1},
+    {0x000049043281, 2602, 1},
+    {0x000049048248, 2603, 1},
+    {0x0000490482d0, 2604, 1},
+    {0x0000490882c8, 2605, 1},
+    {0x000049090248, 2606, 1},
+    {0x0000490902d0, 2607, 1},
+    {0x0000490c0289, 2608, 1},
+    {0x0000490c0308, 2609, 1},
+    {0x0000490c0319, 2610, 1},
+    {0x0000490c1281, 2611, 1},
+    {0x0000490c8288, 2612, 1},
+    {0x0000490c8310, 2613, 1},
+    {0x000049108308, 2614, 1},
+    {0x000049110288, 2615, 1},
+    {0x000049110310, 2616, 1},
+    {0x0000492404c8, 2617, 1},
+    {0x000049241201, 2618, 1},
+    {0x000049280059, 2619, 1},
+    {0x0000492802c8, 2620, 1},
+    {0x000049281088, 2621, 1},
+    {0x000049288050, 2622, 1},
+    {0x0000492c0288, 2623, 1},
+    {0x0000492c0508, 2624, 1},
+    {0x000049300049, 2625, 1},
+    {0x000049300088, 2626, 1},
+    {0x000049300099, 2627, 1},
+    {0x000049300308, 2628, 1},
+    {0x000049308090, 2629, 1},
+    {0x000049310050, 2630, 1},
+    {0x000049348088, 2631, 1},
+    {0x000049350090, 2632, 1},
+    {0x000049443201, 2633, 1},
+    {0x0000494804c8, 2634, 1},
+    {0x000049481201, 2635, 1},
+    {0x000049500288, 2636, 1},
+    {0x000049500508, 2637, 1},
+    {0x00004a0412c8, 2638, 1},
+    {0x00004a043241, 2639, 1},
+    {0x00004a0c1099, 2640, 1},
+    {0x00004a0c1308, 2641, 1},
+    {0x00004a0c304a, 2642, 1},
+    {0x00004a0c3089, 2643, 1},
+    {0x00004a0c309a, 2644, 1},
+    {0x00004a0c3281, 2645, 1},
+    {0x00004a243201, 2646, 1},
+    {0x00004a301088, 2647, 1},
+    {0x00004a483201, 2648, 1},
+    {0x000050008249, 2649, 1},
+    {0x0000500082d9, 2650, 1},
+    {0x00005000924a, 2651, 1},
+    {0x0000500092c9, 2652, 1},
+    {0x0000500092da, 2653, 1},
+    {0x000050011249, 2654, 1},
+    {0x0000500112c8, 2655, 1},
+    {0x0000500112d9, 2656, 1},
+    {0x00005001224a, 2657, 1},
+    {0x0000500122c9, 2658, 1},
+    {0x0000500122da, 2659, 1},
+    {0x000050018251, 2660, 1},
+    {0x0000500182e1, 2661, 1},
+    {0x000050019249, 2662, 1},
+    {0x000050019252, 2663, 1},
+    {0x0000500192d1, 2664, 1},
+    {0x0000500192e2, 2665, 1},
+    {0x000050021251, 2666, 1},
+    {0x0000500212d0, 2667, 1},
+    {0x0000500212e1, 2668, 1},
+    {0x000050022249, 2669, 1},
+    {0x000050022252, 2670, 1},
+    {0x0000500222d1, 2671, 1},
+    {0x0000500222e2, 2672, 1},
+    {0x000050048289, 2673, 1},
+    {0x000050048319, 2674, 1},
+    {0x000050049281, 2675, 1},
+    {0x000050050249, 2676, 1},
+    {0x0000500502d9, 2677, 1},
+    {0x000050051241, 2678, 1},
+    {0x000050051308, 2679, 1},
+    {0x000050052281, 2680, 1},
+    {0x000050058291, 2681, 1},
+    {0x000050058321, 2682, 1},
+    {0x000050060251, 2683, 1},
+    {0x0000500602e1, 2684, 1},
+    {0x000050061288, 2685, 1},
+    {0x0000500612c8, 2686, 1},
+    {0x000050061310, 2687, 1},
+    {0x000050062241, 2688, 1},
+    {0x0000500692d0, 2689, 1},
+    {0x000050090289, 2690, 1},
+    {0x000050090319, 2691, 1},
+    {0x000050091281, 2692, 1},
+    {0x0000500a0291, 2693, 1},
+    {0x0000500a0321, 2694, 1},
+    {0x0000500a1308, 2695, 1},
+    {0x0000500a2281, 2696, 1},
+    {0x0000500a9288, 2697, 1},
+    {0x0000500a9310, 2698, 1},
+    {0x000050208259, 2699, 1},
+    {0x000050208449, 2700, 1},
+    {0x0000502084d9, 2701, 1},
+    {0x0000502114c8, 2702, 1},
+    {0x000050218261, 2703, 1},
+    {0x000050218451, 2704, 1},
+    {0x0000502184e1, 2705, 1},
+    {0x000050221250, 2706, 1},
+    {0x0000502214d0, 2707, 1},
+    {0x000050248059, 2708, 1},
+    {0x000050250209, 2709, 1},
+    {0x000050251201, 2710, 1},
+    {0x000050258061, 2711, 1},
+    {0x000050260211, 2712, 1},
+    {0x000050261050, 2713, 1},
+    {0x000050262201, 2714, 1},
+    {0x000050288099, 2715, 1},
+    {0x000050291088, 2716, 1},
+    {0x000050298051, 2717, 1},
+    {0x0000502980a1, 2718, 1},
+    {0x0000502a1090, 2719, 1},
+    {0x0000502d0059, 2720, 1},
+    {0x0000502e0061, 2721, 1},
+    {0x0000502e9050, 2722, 1},
+    {0x000050310099, 2723, 1},
+    {0x000050320051, 2724, 1},
+    {0x0000503200a1, 2725, 1},
+    {0x000050321088, 2726, 1},
+    {0x000050329090, 2727, 1},
+    {0x000050448209, 2728, 1},
+    {0x000050449201, 2729, 1},
+    {0x000050452201, 2730, 1},
+    {0x000050458211, 2731, 1},
+    {0x0000504d0209, 2732, 1},
+    {0x0000504d1201, 2733, 1},
+    {0x0000504e0211, 2734, 1},
+    {0x0000504e2201, 2735, 1},
+    {0x0000510092c8, 2736, 1},
+    {0x0000510122c8, 2737, 1},
+    {0x0000510192d0, 2738, 1},
+    {0x0000510222d0, 2739, 1},
+    {0x0000510482c8, 2740, 1},
+    {0x0000510582d0, 2741, 1},
+    {0x0000510902c8, 2742, 1},
+    {0x0000510a02d0, 2743, 1},
+    {0x0000510c8308, 2744, 1},
+    {0x0000510d8288, 2745, 1},
+    {0x0000510d8310, 2746, 1},
+    {0x000051110308, 2747, 1},
+    {0x000051120288, 2748, 1},
+    {0x000051120310, 2749, 1},
+    {0x000051318090, 2750, 1},
+    {0x000051360090, 2751, 1},
+    {0x00005900124a, 2752, 1},
+    {0x0000590012c9, 2753, 1},
+    {0x0000590012da, 2754, 1},
+    {0x000059008251, 2755, 1},
+    {0x0000590082d0, 2756, 1},
+    {0x0000590082e1, 2757, 1},
+    {0x0000590092c8, 2758, 1},
+    {0x0000590112d0, 2759, 1},
+    {0x000059040289, 2760, 1},
+    {0x000059040308, 2761, 1},
+    {0x000059040319, 2762, 1},
+    {0x000059041281, 2763, 1},
+    {0x0000590482c8, 2764, 1},
+    {0x000059048310, 2765, 1},
+    {0x0000590502d0, 2766, 1},
+    {0x000059088308, 2767, 1},
+    {0x000059090310, 2768, 1},
+    {0x000059208250, 2769, 1},
+    {0x0000592084d0, 2770, 1},
+    {0x000059240059, 2771, 1},
+    {0x000059240508, 2772, 1},
+    {0x000059280099, 2773, 1},
+    {0x000059280308, 2774, 1},
+    {0x000059288090, 2775, 1},
+    {0x000059310090, 2776, 1},
+    {0x0000594404c8, 2777, 1},
+    {0x000059441201, 2778, 1},
+    {0x000059480508, 2779, 1},
+    {0x00005a001249, 2780, 1},
+    {0x00005a0012d9, 2781, 1},
+    {0x00005a00324a, 2782, 1},
+    {0x00005a0032c9, 2783, 1},
+    {0x00005a0032da, 2784, 1},
+    {0x00005a0092d0, 2785, 1},
+    {0x00005a0122d0, 2786, 1},
+    {0x00005a041308, 2787, 1},
+    {0x00005a043281, 2788, 1},
+    {0x00005a443201, 2789, 1},
+    {0x000061008249, 2790, 1},
+    {0x0000610082d9, 2791, 1},
+    {0x000061018251, 2792, 1},
+    {0x0000610182d0, 2793, 1},
+    {0x0000610182e1, 2794, 1},
+    {0x0000610212d0, 2795, 1},
+    {0x000061048308, 2796, 1},
+    {0x000061058310, 2797, 1},
+    {0x0000610602d0, 2798, 1},
+    {0x000061090308, 2799, 1},
+    {0x0000610a0310, 2800, 1},
+    {0x000061218250, 2801, 1},
+    {0x0000612184d0, 2802, 1},
+    {0x000061298090, 2803, 1},
+    {0x000061320090, 2804, 1},
+    {0x0000620192d0, 2805, 1},
+    {0x0000620222d0, 2806, 1},
+    {0x000089043241, 2807, 1},
+    {0x0000890c3281, 2808, 1},
+    {0x000089243201, 2809, 1},
+    {0x000089483201, 2810, 1},
+    {0x000090048249, 2811, 1},
+    {0x0000900482d9, 2812, 1},
+    {0x000090049241, 2813, 1},
+    {0x000090052241, 2814, 1},
+    {0x000090058251, 2815, 1},
+    {0x0000900582e1, 2816, 1},
+    {0x0000900612d0, 2817, 1},
+    {0x000090090249, 2818, 1},
+    {0x0000900902d9, 2819, 1},
+    {0x000090091241, 2820, 1},
+    {0x0000900a0251, 2821, 1},
+    {0x0000900a02e1, 2822, 1},
+    {0x0000900a2241, 2823, 1},
+    {0x0000900a92d0, 2824, 1},
+    {0x0000900c9281, 2825, 1},
+    {0x0000900d2281, 2826, 1},
+    {0x0000900d8291, 2827, 1},
+    {0x0000900d8321, 2828, 1},
+    {0x0000900e1310, 2829, 1},
+    {0x000090111281, 2830, 1},
+    {0x000090120291, 2831, 1},
+    {0x000090120321, 2832, 1},
+    {0x000090122281, 2833, 1},
+    {0x000090129310, 2834, 1},
+    {0x000090249201, 2835, 1},
+    {0x000090252201, 2836, 1},
+    {0x000090291201, 2837, 1},
+    {0x0000902a2201, 2838, 1},
+    {0x000090321090, 2839, 1},
+    {0x000090369090, 2840, 1},
+    {0x000090492201, 2841, 1},
+    {0x000090522201, 2842, 1},
+    {0x000099040249, 2843, 1},
+    {0x0000990402d9, 2844, 1},
+    {0x000099041241, 2845, 1},
+    {0x0000990482d0, 2846, 1},
+    {0x0000990902d0, 2847, 1},
+    {0x0000990c0289, 2848, 1},
+    {0x0000990c0319, 2849, 1},
+    {0x0000990c1281, 2850, 1},
+    {0x0000990c8310, 2851, 1},
+    {0x000099110310, 2852, 1},
+    {0x000099241201, 2853, 1},
+    {0x000099300099, 2854, 1},
+    {0x000099481201, 2855, 1},
+    {0x00009a043241, 2856, 1},
+    {0x00009a0c309a, 2857, 1},
+    {0x00009a0c3281, 2858, 1},
+    {0x00009a243201, 2859, 1},
+    {0x00009a483201, 2860, 1},
+    {0x0000a10d8310, 2861, 1},
+    {0x0000a1120310, 2862, 1},
+    {0x000201201249, 2863, 1},
+    {0x0002012012d9, 2864, 1},
+    {0x00020120324a, 2865, 1},
+    {0x0002012032c9, 2866, 1},
+    {0x0002012032da, 2867, 1},
+    {0x000201603249, 2868, 1},
+    {0x00020160325a, 2869, 1},
+    {0x00020160344a, 2870, 1},
+    {0x0002016034da, 2871, 1},
+    {0x00020164b201, 2872, 1},
+    {0x00020165c201, 2873, 1},
+    {0x00020184c201, 2874, 1},
+    {0x0002018dc201, 2875, 1},
+    {0x00100100124a, 2876, 1},
+    {0x0010010012c9, 2877, 1},
+    {0x0010010012da, 2878, 1},
+    {0x001001009249, 2879, 2},
+    {0x001001009252, 2881, 1},
+    {0x0010010092c8, 2882, 1},
+    {0x0010010092d1, 2883, 1},
+    {0x0010010092d9, 2884, 1},
+    {0x0010010092e2, 2885, 1},
+    {0x00100100a2c9, 2886, 1},
+    {0x00100100a2da, 2887, 1},
+    {0x001001011248, 2888, 1},
+    {0x001001011251, 2889, 1},
+    {0x0010010112d0, 2890, 1},
+    {0x0010010112e1, 2891, 1},
+    {0x001001012252, 2892, 1},
+    {0x0010010122d1, 2893, 1},
+    {0x0010010122e2, 2894, 1},
+    {0x00100104128a, 2895, 1},
+    {0x001001041309, 2896, 1},
+    {0x00100104131a, 2897, 1},
+    {0x001001049241, 2898, 1},
+    {0x001001049280, 2899, 1},
+    {0x001001049308, 2900, 1},
+    {0x00100104a281, 2901, 1},
+    {0x001001051288, 2902, 1},
+    {0x001001051310, 2903, 1},
+    {0x001001059240, 2904, 1},
+    {0x0010010592c8, 2905, 1},
+    {0x00100105a241, 2906, 1},
+    {0x001001061248, 2907, 1},
+    {0x0010010612d0, 2908, 1},
+    {0x001001089281, 2909, 1},
+    {0x001001099280, 2910, 1},
+    {0x001001099308, 2911, 1},
+    {0x00100109a281, 2912, 1},
+    {0x0010010a1288, 2913, 1},
+    {0x0010010a1310, 2914, 1},
+    {0x001001201249, 2915, 1},
+    {0x00100120125a, 2916, 1},
+    {0x00100120144a, 2917, 1},
+    {0x0010012014c9, 2918, 1},
+    {0x0010012014da, 2919, 1},
+    {0x001001209248, 2920, 1},
+    {0x0010012094c8, 2921, 1},
+    {0x001001211250, 2922, 1},
+    {0x001001211448, 2923, 1},
+    {0x0010012114d0, 2924, 1},
+    {0x001001241049, 2925, 1},
+    {0x00100124105a, 2926, 1},
+    {0x001001249009, 2927, 2},
+    {0x001001249012, 2929, 1},
+    {0x001001249048, 2930, 1},
+    {0x001001249201, 2931, 1},
+    {0x001001249240, 2932, 2},
+    {0x001001249480, 2934, 1},
+    {0x00100124a001, 2935, 1},
+    {0x00100124a00a, 2936, 1},
+    {0x001001251008, 2937, 1},
+    {0x001001251011, 2938, 1},
+    {0x001001251050, 2939, 1},
+    {0x001001252009, 2940, 1},
+    {0x001001252012, 2941, 1},
+    {0x001001259200, 2942, 1},
+    {0x001001259440, 2943, 1},
+    {0x00100125a201, 2944, 1},
+    {0x001001261208, 2945, 1},
+    {0x00100128104a, 2946, 1},
+    {0x001001281089, 2947, 1},
+    {0x00100128109a, 2948, 1},
+    {0x001001289040, 2949, 1},
+    {0x001001289088, 2950, 1},
+    {0x001001289280, 2951, 1},
+    {0x00100128a041, 2952, 1},
+    {0x001001291048, 2953, 1},
+    {0x001001291090, 2954, 1},
+    {0x001001299240, 2955, 1},
+    {0x001001299480, 2956, 1},
+    {0x0010012c9001, 2957, 1},
+    {0x0010012c900a, 2958, 1},
+    {0x0010012d1009, 2959, 1},
+    {0x0010012d1012, 2960, 1},
+    {0x0010012d9009, 2961, 1},
+    {0x0010012d9048, 2962, 1},
+    {0x0010012d9240, 2963, 1},
+    {0x0010012da001, 2964, 1},
+    {0x0010012da00a, 2965, 1},
+    {0x0010012e1008, 2966, 1},
+    {0x0010012e1011, 2967, 1},
+    {0x0010012e1050, 2968, 1},
+    {0x0010012e2009, 2969, 1},
+    {0x0010012e2012, 2970, 1},
+    {0x001001309041, 2971, 1},
+    {0x001001319040, 2972, 1},
+    {0x001001319088, 2973, 1},
+    {0x001001319280, 2974, 1},
+    {0x00100131a041, 2975, 1},
+    {0x001001321048, 2976, 1},
+    {0x001001321090, 2977, 1},
+    {0x001001449200, 2978, 1},
+    {0x001001449440, 2979, 1},
+    {0x00100144a201, 2980, 1},
+    {0x001001451208, 2981, 1},
+    {0x001001489240, 2982, 1},
+    {0x001001489480, 2983, 1},
+    {0x0010014c9201, 2984, 1},
+    {0x0010014d9200, 2985, 1},
+    {0x0010014d9440, 2986, 1},
+    {0x0010014da201, 2987, 1},
+    {0x0010014e1208, 2988, 1},
+    {0x001001519240, 2989, 1},
+    {0x001001519480, 2990, 1},
+    {0x0010030012d9, 2991, 1},
+    {0x0010030032da, 2992, 1},
+    {0x0010030092d0, 2993, 1},
+    {0x0010030092e1, 2994, 1},
+    {0x00100300a2d9, 2995, 1},
+    {0x00100300b2e2, 2996, 1},
+    {0x0010030122d0, 2997, 1},
+    {0x0010030122e1, 2998, 1},
+    {0x0010030142e2, 2999, 1},
+    {0x001003041289, 3000, 1},
+    {0x001003041319, 3001, 1},
+    {0x00100304328a, 3002, 1},
+    {0x001003043309, 3003, 1},
+    {0x00100304331a, 3004, 1},
+    {0x001003049240, 3005, 1},
+    {0x001003049288, 3006, 1},
+    {0x0010030492c8, 3007, 1},
+    {0x001003049310, 3008, 1},
+    {0x00100304a280, 3009, 1},
+    {0x00100304a308, 3010, 1},
+    {0x00100304b241, 3011, 1},
+    {0x00100304c281, 3012, 1},
+    {0x001003051248, 3013, 1},
+    {0x0010030512d0, 3014, 1},
+    {0x001003052288, 3015, 1},
+    {0x001003052310, 3016, 1},
+    {0x00100305a240, 3017, 1},
+    {0x00100305a2c8, 3018, 1},
+    {0x00100305c241, 3019, 1},
+    {0x001003062248, 3020, 1},
+    {0x0010030622d0, 3021, 1},
+    {0x001003089280, 3022, 1},
+    {0x001003089308, 3023, 1},
+    {0x00100308b281, 3024, 1},
+    {0x001003091288, 3025, 1},
+    {0x001003091310, 3026, 1},
+    {0x00100309a280, 3027, 1},
+    {0x00100309a308, 3028, 1},
+    {0x00100309c281, 3029, 1},
+    {0x0010030a2288, 3030, 1},
+    {0x0010030a2310, 3031, 1},
+    {0x001003201259, 3032, 1},
+    {0x001003201449, 3033, 1},
+    {0x0010032014d9, 3034, 1},
+    {0x001003203249, 3035, 1},
+    {0x00100320325a, 3036, 1},
+    {0x00100320344a, 3037, 1},
+    {0x0010032034c9, 3038, 1},
+    {0x0010032034da, 3039, 1},
+    {0x001003209250, 3040, 1},
+    {0x001003209448, 3041, 1},
+    {0x0010032094d0, 3042, 1},
+    {0x00100320a248, 3043, 1},
+    {0x00100320a4c8, 3044, 1},
+    {0x001003212250, 3045, 1},
+    {0x001003212448, 3046, 1},
+    {0x0010032124d0, 3047, 1},
+    {0x001003241059, 3048, 1},
+    {0x001003243049, 3049, 1},
+    {0x00100324305a, 3050, 1},
+    {0x001003249008, 3051, 1},
+    {0x001003249011, 3052, 1},
+    {0x001003249050, 3053, 1},
+    {0x001003249200, 3054, 1},
+    {0x001003249440, 3055, 1},
+    {0x00100324a009, 3056, 1},
+    {0x00100324a048, 3057, 1},
+    {0x00100324a240, 3058, 2},
+    {0x00100324a480, 3060, 1},
+    {0x00100324b009, 3061, 1},
+    {0x00100324b012, 3062, 1},
+    {0x00100324b201, 3063, 1},
+    {0x00100324c001, 3064, 1},
+    {0x00100324c00a, 3065, 1},
+    {0x001003251208, 3066, 1},
+    {0x001003252008, 3067, 1},
+    {0x001003252011, 3068, 1},
+    {0x001003252050, 3069, 1},
+    {0x001003254009, 3070, 1},
+    {0x001003254012, 3071, 1},
+    {0x00100325a200, 3072, 1},
+    {0x00100325a440, 3073, 1},
+    {0x00100325c201, 3074, 1},
+    {0x001003262208, 3075, 1},
+    {0x001003281049, 3076, 1},
+    {0x001003281099, 3077, 1},
+    {0x00100328304a, 3078, 1},
+    {0x001003283089, 3079, 1},
+    {0x00100328309a, 3080, 1},
+    {0x001003289048, 3081, 1},
+    {0x001003289090, 3082, 1},
+    {0x001003289240, 3083, 1},
+    {0x001003289480, 3084, 1},
+    {0x00100328a040, 3085, 1},
+    {0x00100328a088, 3086, 1},
+    {0x00100328a280, 3087, 1},
+    {0x00100328c041, 3088, 1},
+    {0x001003292048, 3089, 1},
+    {0x001003292090, 3090, 1},
+    {0x00100329a240, 3091, 1},
+    {0x00100329a480, 3092, 1},
+    {0x0010032c9009, 3093, 1},
+    {0x0010032c9048, 3094, 1},
+    {0x0010032c9240, 3095, 1},
+    {0x0010032cb001, 3096, 1},
+    {0x0010032cb00a, 3097, 1},
+    {0x0010032d1008, 3098, 1},
+    {0x0010032d1011, 3099, 1},
+    {0x0010032d1050, 3100, 1},
+    {0x0010032d3009, 3101, 1},
+    {0x0010032d3012, 3102, 1},
+    {0x0010032da009, 3103, 1},
+    {0x0010032da048, 3104, 1},
+    {0x0010032da240, 3105, 1},
+    {0x0010032dc001, 3106, 1},
+    {0x0010032dc00a, 3107, 1},
+    {0x0010032e2008, 3108, 1},
+    {0x0010032e2011, 3109, 1},
+    {0x0010032e2050, 3110, 1},
+    {0x0010032e4009, 3111, 1},
+    {0x0010032e4012, 3112, 1},
+    {0x001003309040, 3113, 1},
+    {0x001003309088, 3114, 1},
+    {0x001003309280, 3115, 1},
+    {0x00100330b041, 3116, 1},
+    {0x001003311048, 3117, 1},
+    {0x001003311090, 3118, 1},
+    {0x00100331a040, 3119, 1},
+    {0x00100331a088, 3120, 1},
+    {0x00100331a280, 3121, 1},
+    {0x00100331c041, 3122, 1},
+    {0x001003322048, 3123, 1},
+    {0x001003322090, 3124, 1},
+    {0x001003449208, 3125, 1},
+    {0x00100344a200, 3126, 1},
+    {0x00100344a440, 3127, 1},
+    {0x00100344c201, 3128, 1},
+    {0x001003452208, 3129, 1},
+    {0x00100348a240, 3130, 1},
+    {0x00100348a480, 3131, 1},
+    {0x0010034c9200, 3132, 1},
+    {0x0010034c9440, 3133, 1},
+    {0x0010034cb201, 3134, 1},
+    {0x0010034d1208, 3135, 1},
+    {0x0010034da200, 3136, 1},
+    {0x0010034da440, 3137, 1},
+    {0x0010034dc201, 3138, 1},
+    {0x0010034e2208, 3139, 1},
+    {0x001003509240, 3140, 1},
+    {0x001003509480, 3141, 1},
+    {0x00100351a240, 3142, 1},
+    {0x00100351a480, 3143, 1},
+    {0x001009048280, 3144, 1},
+    {0x001009048308, 3145, 1},
+    {0x001009050240, 3146, 1},
+    {0x0010090502c8, 3147, 1},
+    {0x001009051280, 3148, 1},
+    {0x001009058288, 3149, 1},
+    {0x001009058310, 3150, 1},
+    {0x001009060248, 3151, 1},
+    {0x0010090602d0, 3152, 1},
+    {0x001009090280, 3153, 1},
+    {0x001009090308, 3154, 1},
+    {0x0010090a0288, 3155, 1},
+    {0x0010090a0310, 3156, 1},
+    {0x0010090a1280, 3157, 1},
+    {0x001009208248, 3158, 1},
+    {0x0010092084c8, 3159, 1},
+    {0x001009218250, 3160, 1},
+    {0x001009218448, 3161, 1},
+    {0x0010092184d0, 3162, 1},
+    {0x001009248009, 3163, 1},
+    {0x001009248048, 3164, 1},
+    {0x001009248240, 3165, 2},
+    {0x001009248480, 3167, 1},
+    {0x001009249001, 3168, 1},
+    {0x001009250200, 3169, 1},
+    {0x001009250440, 3170, 1},
+    {0x001009252001, 3171, 1},
+    {0x001009258008, 3172, 1},
+    {0x001009258011, 3173, 1},
+    {0x001009258050, 3174, 1},
+    {0x001009260208, 3175, 1},
+    {0x001009261008, 3176, 1},
+    {0x001009261200, 3177, 1},
+    {0x001009288040, 3178, 1},
+    {0x001009288088, 3179, 1},
+    {0x001009288280, 3180, 1},
+    {0x001009290240, 3181, 1},
+    {0x001009290480, 3182, 1},
+    {0x001009291040, 3183, 1},
+    {0x001009298048, 3184, 1},
+    {0x001009298090, 3185, 1},
+    {0x0010092d0009, 3186, 1},
+    {0x0010092d0048, 3187, 1},
+    {0x0010092d0240, 3188, 1},
+    {0x0010092d1001, 3189, 1},
+    {0x0010092e0008, 3190, 1},
+    {0x0010092e0011, 3191, 1},
+    {0x0010092e0050, 3192, 1},
+    {0x0010092e2001, 3193, 1},
+    {0x0010092e9008, 3194, 1},
+    {0x001009310040, 3195, 1},
+    {0x001009310088, 3196, 1},
+    {0x001009310280, 3197, 1},
+    {0x001009320048, 3198, 1},
+    {0x001009320090, 3199, 1},
+    {0x001009321040, 3200, 1},
+    {0x001009448200, 3201, 1},
+    {0x001009448440, 3202, 1},
+    {0x001009451200, 3203, 1},
+    {0x001009458208, 3204, 1},
+    {0x001009488240, 3205, 1},
+    {0x001009488480, 3206, 1},
+    {0x0010094d0200, 3207, 1},
+    {0x0010094d0440, 3208, 1},
+    {0x0010094e0208, 3209, 1},
+    {0x0010094e1200, 3210, 1},
+    {0x001009510240, 3211, 1},
+    {0x001009510480, 3212, 1},
+    {0x00100a048288, 3213, 1},
+    {0x00100a0482c8, 3214, 1},
+    {0x00100a048310, 3215, 1},
+    {0x00100a0502d0, 3216, 1},
+    {0x00100a088280, 3217, 1},
+    {0x00100a088308, 3218, 1},
+    {0x00100a090288, 3219, 1},
+    {0x00100a090310, 3220, 1},
+    {0x00100a099280, 3221, 1},
+    {0x00100a208250, 3222, 1},
+    {0x00100a208448, 3223, 1},
+    {0x00100a2084d0, 3224, 1},
+    {0x00100a248008, 3225, 1},
+    {0x00100a248011, 3226, 1},
+    {0x00100a248050, 3227, 1},
+    {0x00100a248200, 3228, 1},
+    {0x00100a248440, 3229, 1},
+    {0x00100a24a001, 3230, 1},
+    {0x00100a250208, 3231, 1},
+    {0x00100a251008, 3232, 1},
+    {0x00100a259200, 3233, 1},
+    {0x00100a288048, 3234, 1},
+    {0x00100a288090, 3235, 1},
+    {0x00100a288240, 3236, 1},
+    {0x00100a288480, 3237, 1},
+    {0x00100a289040, 3238, 1},
+    {0x00100a2c8009, 3239, 1},
+    {0x00100a2c8048, 3240, 1},
+    {0x00100a2c8240, 3241, 1},
+    {0x00100a2c9001, 3242, 1},
+    {0x00100a2d0008, 3243, 1},
+    {0x00100a2d0011, 3244, 1},
+    {0x00100a2d0050, 3245, 1},
+    {0x00100a2da001, 3246, 1},
+    {0x00100a2e1008, 3247, 1},
+    {0x00100a308040, 3248, 1},
+    {0x00100a308088, 3249, 1},
+    {0x00100a308280, 3250, 1},
+    {0x00100a310048, 3251, 1},
+    {0x00100a310090, 3252, 1},
+    {0x00100a319040, 3253, 1},
+    {0x00100a448208, 3254, 1},
+    {0x00100a449200, 3255, 1},
+    {0x00100a4c8200, 3256, 1},
+    {0x00100a4c8440, 3257, 1},
+    {0x00100a4d0208, 3258, 1},
+    {0x00100a4d9200, 3259, 1},
+    {0x00100a508240, 3260, 1},
+    {0x00100a508480, 3261, 1},
+    {0x00100b091280, 3262, 1},
+    {0x00100b0a2280, 3263, 1},
+    {0x00100b24b001, 3264, 1},
+    {0x00100b251200, 3265, 1},
+    {0x00100b254001, 3266, 1},
+    {0x00100b259008, 3267, 1},
+    {0x00100b262008, 3268, 1},
+    {0x00100b262200, 3269, 1},
+    {0x00100b289040, 3270, 1},
+    {0x00100b292040, 3271, 1},
+    {0x00100b2d3001, 3272, 1},
+    {0x00100b2e1008, 3273, 1},
+    {0x00100b2e4001, 3274, 1},
+    {0x00100b2ea008, 3275, 1},
+    {0x00100b311040, 3276, 1},
+    {0x00100b322040, 3277, 1},
+    {0x00100b449200, 3278, 1},
+    {0x00100b452200, 3279, 1},
+    {0x00100b4d1200, 3280, 1},
+    {0x00100b4e2200, 3281, 1},
+    {0x00100c089280, 3282, 1},
+    {0x00100c09a280, 3283, 1},
+    {0x00100c249008, 3284, 1},
+    {0x00100c249200, 3285, 1},
+    {0x00100c24c001, 3286, 1},
+    {0x00100c252008, 3287, 1},
+    {0x00100c25a200, 3288, 1},
+    {0x00100c28a040, 3289, 1},
+    {0x00100c2cb001, 3290, 1},
+    {0x00100c2d1008, 3291, 1},
+    {0x00100c2dc001, 3292, 1},
+    {0x00100c2e2008, 3293, 1},
+    {0x00100c309040, 3294, 1},
+    {0x00100c31a040, 3295, 1},
+    {0x00100c44a200, 3296, 1},
+    {0x00100c4c9200, 3297, 1},
+    {0x00100c4da200, 3298, 1},
+    {0x001012090280, 3299, 1},
+    {0x001012090308, 3300, 1},
+    {0x0010120a0288, 3301, 1},
+    {0x0010120a0310, 3302, 1},
+    {0x001012208248, 3303, 1},
+    {0x0010122084c8, 3304, 1},
+    {0x001012218250, 3305, 1},
+    {0x001012218448, 3306, 1},
+    {0x0010122184d0, 3307, 1},
+    {0x001012248009, 3308, 1},
+    {0x001012248048, 3309, 1},
+    {0x001012248240, 3310, 2},
+    {0x001012248480, 3312, 1},
+    {0x001012249001, 3313, 1},
+    {0x001012250200, 3314, 1},
+    {0x001012250440, 3315, 1},
+    {0x001012252001, 3316, 1},
+    {0x001012258008, 3317, 1},
+    {0x001012258011, 3318, 1},
+    {0x001012258050, 3319, 1},
+    {0x001012260208, 3320, 1},
+    {0x001012261008, 3321, 1},
+    {0x001012261200, 3322, 1},
+    {0x001012288040, 3323, 1},
+    {0x001012288088, 3324, 1},
+    {0x001012288280, 3325, 1},
+    {0x001012290240, 3326, 1},
+    {0x001012290480, 3327, 1},
+    {0x001012291040, 3328, 1},
+    {0x001012298048, 3329, 1},
+    {0x001012298090, 3330, 1},
+    {0x0010122d0009, 3331, 1},
+    {0x0010122d0048, 3332, 1},
+    {0x0010122d0240, 3333, 1},
+    {0x0010122d1001, 3334, 1},
+    {0x0010122e0008, 3335, 1},
+    {0x0010122e0011, 3336, 1},
+    {0x0010122e0050, 3337, 1},
+    {0x0010122e2001, 3338, 1},
+    {0x0010122e9008, 3339, 1},
+    {0x001012310040, 3340, 1},
+    {0x001012310088, 3341, 1},
+    {0x001012310280, 3342, 1},
+    {0x001012320048, 3343, 1},
+    {0x001012320090, 3344, 1},
+    {0x001012321040, 3345, 1},
+    {0x001012448200, 3346, 1},
+    {0x001012448440, 3347, 1},
+    {0x001012451200, 3348, 1},
+    {0x001012458208, 3349, 1},
+    {0x001012488240, 3350, 1},
+    {0x001012488480, 3351, 1},
+    {0x0010124d0200, 3352, 1},
+    {0x0010124d0440, 3353, 1},
+    {0x0010124e0208, 3354, 1},
+    {0x0010124e1200, 3355, 1},
+    {0x001012510240, 3356, 1},
+    {0x001012510480, 3357, 1},
+    {0x00101424b001, 3358, 1},
+    {0x001014251200, 3359, 1},
+    {0x001014254001, 3360, 1},
+    {0x001014259008, 3361, 1},
+    {0x001014262008, 3362, 1},
+    {0x001014262200, 3363, 1},
+    {0x001014289040, 3364, 1},
+    {0x001014292040, 3365, 1},
+    {0x0010142d3001, 3366, 1},
+    {0x0010142e1008, 3367, 1},
+    {0x0010142e4001, 3368, 1},
+    {0x0010142ea008, 3369, 1},
+    {0x001014311040, 3370, 1},
+    {0x001014322040, 3371, 1},
+    {0x001014449200, 3372, 1},
+    {0x001014452200, 3373, 1},
+    {0x0010144d1200, 3374, 1},
+    {0x0010144e2200, 3375, 1},
+    {0x001041049240, 3376, 1},
+    {0x001041099240, 3377, 1},
+    {0x0010410c9280, 3378, 1},
+    {0x001041119280, 3379, 1},
+    {0x001041249200, 3380, 1},
+    {0x00104128a001, 3381, 1},
+    {0x001041291008, 3382, 1},
+    {0x001041299200, 3383, 1},
+    {0x001041309001, 3384, 1},
+    {0x001041309040, 3385, 1},
+    {0x00104131a001, 3386, 1},
+    {0x001041321008, 3387, 1},
+    {0x001041359040, 3388, 1},
+    {0x001041489200, 3389, 1},
+    {0x001041519200, 3390, 1},
+    {0x00104304a240, 3391, 1},
+    {0x001043089240, 3392, 1},
+    {0x00104309a240, 3393, 1},
+    {0x0010430ca280, 3394, 1},
+    {0x001043109280, 3395, 1},
+    {0x00104311a280, 3396, 1},
+    {0x00104324a200, 3397, 1},
+    {0x001043289008, 3398, 1},
+    {0x001043289200, 3399, 1},
+    {0x00104328c001, 3400, 1},
+    {0x001043292008, 3401, 1},
+    {0x00104329a200, 3402, 1},
+    {0x00104330a040, 3403, 1},
+    {0x00104330b001, 3404, 1},
+    {0x001043311008, 3405, 1},
+    {0x00104331c001, 3406, 1},
+    {0x001043322008, 3407, 1},
+    {0x001043349040, 3408, 1},
+    {0x00104335a040, 3409, 1},
+    {0x00104348a200, 3410, 1},
+    {0x001043509200, 3411, 1},
+    {0x00104351a200, 3412, 1},
+    {0x001049040280, 3413, 1},
+    {0x001049040308, 3414, 1},
+    {0x001049048240, 3415, 2},
+    {0x001049088280, 3417, 1},
+    {0x001049090240, 3418, 1},
+    {0x0010490c8280, 3419, 1},
+    {0x001049110280, 3420, 1},
+    {0x001049240048, 3421, 1},
+    {0x001049240240, 3422, 2},
+    {0x001049240480, 3424, 1},
+    {0x001049241001, 3425, 1},
+    {0x001049248008, 3426, 1},
+    {0x001049248200, 3427, 2},
+    {0x001049280040, 3429, 1},
+    {0x001049280088, 3430, 1},
+    {0x001049280280, 3431, 1},
+    {0x001049290200, 3432, 1},
+    {0x001049298008, 3433, 1},
+    {0x0010492d0008, 3434, 1},
+    {0x001049308040, 3435, 2},
+    {0x001049320008, 3437, 1},
+    {0x001049350040, 3438, 1},
+    {0x001049440440, 3439, 1},
+    {0x001049480240, 3440, 1},
+    {0x001049480480, 3441, 1},
+    {0x001049488200, 3442, 1},
+    {0x0010494c8200, 3443, 1},
+    {0x001049510200, 3444, 1},
+    {0x00104a0402c8, 3445, 1},
+    {0x00104a088240, 3446, 1},
+    {0x00104a0c0280, 3447, 1},
+    {0x00104a0c0308, 3448, 1},
+    {0x00104a108280, 3449, 1},
+    {0x00104a240440, 3450, 1},
+    {0x00104a280048, 3451, 1},
+    {0x00104a280240, 3452, 1},
+    {0x00104a281001, 3453, 1},
+    {0x00104a288008, 3454, 1},
+    {0x00104a288200, 3455, 1},
+    {0x00104a2c0240, 3456, 1},
+    {0x00104a2c0480, 3457, 1},
+    {0x00104a300040, 3458, 1},
+    {0x00104a300088, 3459, 1},
+    {0x00104a300280, 3460, 1},
+    {0x00104a310008, 3461, 1},
+    {0x00104a348040, 3462, 1},
+    {0x00104a480440, 3463, 1},
+    {0x00104a500240, 3464, 1},
+    {0x00104a500480, 3465, 1},
+    {0x00104a508200, 3466, 1},
+    {0x00104b243001, 3467, 1},
+    {0x00104b281040, 3468, 1},
+    {0x00104b441200, 3469, 1},
+    {0x00104c0c1280, 3470, 1},
+    {0x00104c241200, 3471, 1},
+    {0x00104c283001, 3472, 1},
+    {0x00104c301040, 3473, 1},
+    {0x00104c481200, 3474, 1},
+    {0x001051090280, 3475, 1},
+    {0x001051250200, 3476, 1},
+    {0x001051258008, 3477, 1},
+    {0x001051288040, 3478, 1},
+    {0x0010512e0008, 3479, 1},
+    {0x001051310040, 3480, 1},
+    {0x0010514d0200, 3481, 1},
+    {0x0010520c8280, 3482, 1},
+    {0x001052110280, 3483, 1},
+    {0x001052290200, 3484, 1},
+    {0x001052298008, 3485, 1},
+    {0x001052308040, 3486, 1},
+    {0x001052320008, 3487, 1},
+    {0x001052350040, 3488, 1},
+    {0x001052488200, 3489, 1},
+    {0x001052510200, 3490, 1},
+    {0x00105a240048, 3491, 1},
+    {0x00105a240240, 3492, 2},
+    {0x00105a240480, 3494, 1},
+    {0x00105a241001, 3495, 1},
+    {0x00105a248008, 3496, 1},
+    {0x00105a280040, 3497, 1},
+    {0x00105a280088, 3498, 1},
+    {0x00105a280280, 3499, 1},
+    {0x00105a2d0008, 3500, 1},
+    {0x00105a308040, 3501, 1},
+    {0x00105a440440, 3502, 1},
+    {0x00105a480240, 3503, 1},
+    {0x00105a480480, 3504, 1},
+    {0x00105a4c8200, 3505, 1},
+    {0x00105c243001, 3506, 1},
+    {0x00105c281040, 3507, 1},
+    {0x00105c441200, 3508, 1},
+    {0x001062250200, 3509, 1},
+    {0x001062258008, 3510, 1},
+    {0x001062288040, 3511, 1},
+    {0x0010622e0008, 3512, 1},
+    {0x001062310040, 3513, 1},
+    {0x0010624d0200, 3514, 1},
+    {0x001089040240, 3515, 1},
+    {0x0010890402c8, 3516, 1},
+    {0x001089088240, 3517, 1},
+    {0x0010890c0280, 3518, 1},
+    {0x0010890c0308, 3519, 1},
+    {0x001089108280, 3520, 1},
+    {0x001089240440, 3521, 1},
+    {0x001089280048, 3522, 1},
+    {0x001089280240, 3523, 1},
+    {0x001089281001, 3524, 1},
+    {0x001089288008, 3525, 1},
+    {0x0010892c0240, 3526, 1},
+    {0x0010892c0480, 3527, 1},
+    {0x001089300040, 3528, 1},
+    {0x001089300088, 3529, 1},
+    {0x001089300280, 3530, 1},
+    {0x001089310008, 3531, 1},
+    {0x001089348040, 3532, 1},
+    {0x001089480440, 3533, 1},
+    {0x001089500240, 3534, 1},
+    {0x001089500480, 3535, 1},
+    {0x00108b0c1280, 3536, 1},
+    {0x00108b241200, 3537, 1},
+    {0x00108b283001, 3538, 1},
+    {0x00108b301040, 3539, 1},
+    {0x00108b481200, 3540, 1},
+    {0x001091090240, 3541, 1},
+    {0x0010910c8280, 3542, 1},
+    {0x001091110280, 3543, 1},
+    {0x001091290200, 3544, 1},
+    {0x001091298008, 3545, 1},
+    {0x001091308040, 3546, 1},
+    {0x001091320008, 3547, 1},
+    {0x001091350040, 3548, 1},
+    {0x001091510200, 3549, 1},
+    {0x00109a0c0280, 3550, 1},
+    {0x00109a0c0308, 3551, 1},
+    {0x00109a108280, 3552, 1},
+    {0x00109a240440, 3553, 1},
+    {0x00109a280048, 3554, 1},
+    {0x00109a280240, 3555, 1},
+    {0x00109a281001, 3556, 1},
+    {0x00109a288008, 3557, 1},
+    {0x00109a2c0240, 3558, 1},
+    {0x00109a2c0480, 3559, 1},
+    {0x00109a300040, 3560, 1},
+    {0x00109a300088, 3561, 1},
+    {0x00109a300280, 3562, 1},
+    {0x00109a310008, 3563, 1},
+    {0x00109a348040, 3564, 1},
+    {0x00109a480440, 3565, 1},
+    {0x00109a500240, 3566, 1},
+    {0x00109a500480, 3567, 1},
+    {0x00109c241200, 3568, 1},
+    {0x00109c283001, 3569, 1},
+    {0x00109c301040, 3570, 1},
+    {0x00109c481200, 3571, 1},
+    {0x0010a2110280, 3572, 1},
+    {0x0010a2298008, 3573, 1},
+    {0x0010a2308040, 3574, 1},
+    {0x0010a2320008, 3575, 1},
+    {0x0010a2350040, 3576, 1},
+    {0x0010a2510200, 3577, 1},
+    {0x001201249001, 3578, 1},
+    {0x001201249040, 3579, 1},
+    {0x00120125a001, 3580, 1},
+    {0x001201261008, 3581, 1},
+    {0x001201299040, 3582, 1},
+    {0x00120144a001, 3583, 1},
+    {0x001201451008, 3584, 1},
+    {0x001201489040, 3585, 1},
+    {0x0012014c9001, 3586, 1},
+    {0x0012014da001, 3587, 1},
+    {0x0012014e1008, 3588, 1},
+    {0x001201519040, 3589, 1},
+    {0x001201659200, 3590, 1},
+    {0x001201849200, 3591, 1},
+    {0x0012018d9200, 3592, 1},
+    {0x00120324a040, 3593, 1},
+    {0x00120324b001, 3594, 1},
+    {0x001203251008, 3595, 1},
+    {0x00120325c001, 3596, 1},
+    {0x001203262008, 3597, 1},
+    {0x001203289040, 3598, 1},
+    {0x00120329a040, 3599, 1},
+    {0x001203449008, 3600, 1},
+    {0x00120344c001, 3601, 1},
+    {0x001203452008, 3602, 1},
+    {0x00120348a040, 3603, 1},
+    {0x0012034cb001, 3604, 1},
+    {0x0012034d1008, 3605, 1},
+    {0x0012034dc001, 3606, 1},
+    {0x0012034e2008, 3607, 1},
+    {0x001203509040, 3608, 1},
+    {0x00120351a040, 3609, 1},
+    {0x001203649200, 3610, 1},
+    {0x00120365a200, 3611, 1},
+    {0x00120384a200, 3612, 1},
+    {0x0012038c9200, 3613, 1},
+    {0x0012038da200, 3614, 1},
+    {0x001209248040, 3615, 1},
+    {0x001209260008, 3616, 1},
+    {0x001209290040, 3617, 1},
+    {0x001209458008, 3618, 1},
+    {0x001209488040, 3619, 1},
+    {0x0012094e0008, 3620, 1},
+    {0x001209510040, 3621, 1},
+    {0x00120a250008, 3622, 1},
+    {0x00120a288040, 3623, 1},
+    {0x00120a448008, 3624, 1},
+    {0x00120a4d0008, 3625, 1},
+    {0x00120a508040, 3626, 1},
+    {0x001212248040, 3627, 1},
+    {0x001212260008, 3628, 1},
+    {0x001212290040, 3629, 1},
+    {0x001212458008, 3630, 1},
+    {0x001212488040, 3631, 1},
+    {0x0012124e0008, 3632, 1},
+    {0x001212510040, 3633, 1},
+    {0x001241049040, 3634, 1},
+    {0x001241061008, 3635, 1},
+    {0x001241099040, 3636, 1},
+    {0x00124304a040, 3637, 1},
+    {0x001243051008, 3638, 1},
+    {0x001243062008, 3639, 1},
+    {0x001243089040, 3640, 1},
+    {0x00124309a040, 3641, 1},
+    {0x001249008009, 3642, 1},
+    {0x001249008048, 3643, 1},
+    {0x001249018008, 3644, 1},
+    {0x001249018011, 3645, 1},
+    {0x001249018050, 3646, 1},
+    {0x001249021008, 3647, 1},
+    {0x001249048040, 3648, 1},
+    {0x001249060008, 3649, 1},
+    {0x001249090040, 3650, 1},
+    {0x001249200240, 3651, 1},
+    {0x001249208008, 3652, 1},
+    {0x001249240040, 3653, 1},
+    {0x001249480040, 3654, 1},
+    {0x001249600440, 3655, 1},
+    {0x00124a00100a, 3656, 1},
+    {0x00124a008008, 3657, 1},
+    {0x00124a008011, 3658, 1},
+    {0x00124a008050, 3659, 1},
+    {0x00124a011008, 3660, 1},
+    {0x00124a040040, 3661, 1},
+    {0x00124a040088, 3662, 1},
+    {0x00124a040280, 3663, 1},
+    {0x00124a050008, 3664, 1},
+    {0x00124a088040, 3665, 1},
+    {0x00124a200440, 3666, 1},
+    {0x00124a280040, 3667, 1},
+    {0x00124a2c0040, 3668, 1},
+    {0x00124a500040, 3669, 1},
+    {0x00124b019008, 3670, 1},
+    {0x00124b022008, 3671, 1},
+    {0x00124c001009, 3672, 1},
+    {0x00124c00300a, 3673, 1},
+    {0x00124c009008, 3674, 1},
+    {0x00124c012008, 3675, 1},
+    {0x00124c041040, 3676, 1},
+    {0x001251218008, 3677, 1},
+    {0x001252008009, 3678, 1},
+    {0x001252008048, 3679, 1},
+    {0x001252018008, 3680, 1},
+    {0x001252018011, 3681, 1},
+    {0x001252018050, 3682, 1},
+    {0x001252021008, 3683, 1},
+    {0x001252048040, 3684, 1},
+    {0x001252060008, 3685, 1},
+    {0x001252090040, 3686, 1},
+    {0x001254019008, 3687, 1},
+    {0x001254022008, 3688, 1},
+    {0x00125a200240, 3689, 1},
+    {0x00125a208008, 3690, 1},
+    {0x00125a240040, 3691, 1},
+    {0x00125a480040, 3692, 1},
+    {0x00125a600440, 3693, 1},
+    {0x001262218008, 3694, 1},
+    {0x001281051008, 3695, 1},
+    {0x0012810a1008, 3696, 1},
+    {0x0012810c9040, 3697, 1},
+    {0x001281119040, 3698, 1},
+    {0x001283049008, 3699, 1},
+    {0x001283052008, 3700, 1},
+    {0x001283091008, 3701, 1},
+    {0x0012830a2008, 3702, 1},
+    {0x0012830ca040, 3703, 1},
+    {0x001283109040, 3704, 1},
+    {0x00128311a040, 3705, 1},
+    {0x001289058008, 3706, 1},
+    {0x0012890a0008, 3707, 1},
+    {0x0012890c8040, 3708, 1},
+    {0x001289110040, 3709, 1},
+    {0x0012892c0040, 3710, 1},
+    {0x001289500040, 3711, 1},
+    {0x00128a040048, 3712, 1},
+    {0x00128a040240, 3713, 1},
+    {0x00128a048008, 3714, 1},
+    {0x00128a090008, 3715, 1},
+    {0x00128a0c0040, 3716, 1},
+    {0x00128a0c0088, 3717, 1},
+    {0x00128a0c0280, 3718, 1},
+    {0x00128a108040, 3719, 1},
+    {0x00128a300040, 3720, 1},
+    {0x00128c0c1040, 3721, 1},
+    {0x001292058008, 3722, 1},
+    {0x0012920a0008, 3723, 1},
+    {0x0012920c8040, 3724, 1},
+    {0x001292110040, 3725, 1},
+    {0x00129a2c0040, 3726, 1},
+    {0x00129a500040, 3727, 1},
+    {0x0012c900100a, 3728, 1},
+    {0x0012c9008008, 3729, 1},
+    {0x0012c9008011, 3730, 1},
+    {0x0012c9008050, 3731, 1},
+    {0x0012c9011008, 3732, 1},
+    {0x0012c9040040, 3733, 1},
+    {0x0012c9040088, 3734, 1},
+    {0x0012c9040280, 3735, 1},
+    {0x0012c9050008, 3736, 1},
+    {0x0012c9088040, 3737, 1},
+    {0x0012c9200440, 3738, 1},
+    {0x0012c9280040, 3739, 1},
+    {0x0012cb001009, 3740, 1},
+    {0x0012cb00300a, 3741, 1},
+    {0x0012cb009008, 3742, 1},
+    {0x0012cb012008, 3743, 1},
+    {0x0012cb041040, 3744, 1},
+    {0x0012d1008009, 3745, 1},
+    {0x0012d1008048, 3746, 1},
+    {0x0012d1018008, 3747, 1},
+    {0x0012d1018011, 3748, 1},
+    {0x0012d1018050, 3749, 1},
+    {0x0012d1021008, 3750, 1},
+    {0x0012d1048040, 3751, 1},
+    {0x0012d1060008, 3752, 1},
+    {0x0012d1090040, 3753, 1},
+    {0x0012d3019008, 3754, 1},
+    {0x0012d3022008, 3755, 1},
+    {0x0012da00100a, 3756, 1},
+    {0x0012da008008, 3757, 1},
+    {0x0012da008011, 3758, 1},
+    {0x0012da008050, 3759, 1},
+    {0x0012da011008, 3760, 1},
+    {0x0012da040040, 3761, 1},
+    {0x0012da040088, 3762, 1},
+    {0x0012da040280, 3763, 1},
+    {0x0012da050008, 3764, 1},
+    {0x0012da088040, 3765, 1},
+    {0x0012da200440, 3766, 1},
+    {0x0012da280040, 3767, 1},
+    {0x0012dc001009, 3768, 1},
+    {0x0012dc00300a, 3769, 1},
+    {0x0012dc009008, 3770, 1},
+    {0x0012dc012008, 3771, 1},
+    {0x0012dc041040, 3772, 1},
+    {0x0012e2008009, 3773, 1},
+    {0x0012e2008048, 3774, 1},
+    {0x0012e2018008, 3775, 1},
+    {0x0012e2018011, 3776, 1},
+    {0x0012e2018050, 3777, 1},
+    {0x0012e2021008, 3778, 1},
+    {0x0012e2048040, 3779, 1},
+    {0x0012e2060008, 3780, 1},
+    {0x0012e2090040, 3781, 1},
+    {0x0012e4019008, 3782, 1},
+    {0x0012e4022008, 3783, 1},
+    {0x001309040048, 3784, 1},
+    {0x001309040240, 3785, 1},
+    {0x001309048008, 3786, 1},
+    {0x001309090008, 3787, 1},
+    {0x0013090c0040, 3788, 1},
+    {0x0013090c0088, 3789, 1},
+    {0x0013090c0280, 3790, 1},
+    {0x001309108040, 3791, 1},
+    {0x001309300040, 3792, 1},
+    {0x00130b0c1040, 3793, 1},
+    {0x001311058008, 3794, 1},
+    {0x0013110a0008, 3795, 1},
+    {0x0013110c8040, 3796, 1},
+    {0x001311110040, 3797, 1},
+    {0x00131a040048, 3798, 1},
+    {0x00131a040240, 3799, 1},
+    {0x00131a048008, 3800, 1},
+    {0x00131a090008, 3801, 1},
+    {0x00131a0c0040, 3802, 1},
+    {0x00131a0c0088, 3803, 1},
+    {0x00131a0c0280, 3804, 1},
+    {0x00131a108040, 3805, 1},
+    {0x00131a300040, 3806, 1},
+    {0x00131c0c1040, 3807, 1},
+    {0x001322058008, 3808, 1},
+    {0x0013220a0008, 3809, 1},
+    {0x0013220c8040, 3810, 1},
+    {0x001322110040, 3811, 1},
+    {0x001449218008, 3812, 1},
+    {0x00144a200240, 3813, 1},
+    {0x00144a208008, 3814, 1},
+    {0x00144a240040, 3815, 1},
+    {0x00144a480040, 3816, 1},
+    {0x00144a600440, 3817, 1},
+    {0x001452218008, 3818, 1},
+    {0x00148a2c0040, 3819, 1},
+    {0x00148a500040, 3820, 1},
+    {0x0014c9200240, 3821, 1},
+    {0x0014c9208008, 3822, 1},
+    {0x0014c9240040, 3823, 1},
+    {0x0014c9480040, 3824, 1},
+    {0x0014c9600440, 3825, 1},
+    {0x0014d1218008, 3826, 1},
+    {0x0014da200240, 3827, 1},
+    {0x0014da208008, 3828, 1},
+    {0x0014da240040, 3829, 1},
+    {0x0014da480040, 3830, 1},
+    {0x0014da600440, 3831, 1},
+    {0x0014e2218008, 3832, 1},
+    {0x0015092c0040, 3833, 1},
+    {0x001509500040, 3834, 1},
+    {0x00151a2c0040, 3835, 1},
+    {0x00151a500040, 3836, 1},
+    {0x008008209248, 3837, 1},
+    {0x0080082094c8, 3838, 1},
+    {0x008008211250, 3839, 1},
+    {0x008008211448, 3840, 1},
+    {0x0080082114d0, 3841, 1},
+    {0x008008249009, 3842, 2},
+    {0x008008249012, 3844, 1},
+    {0x008008249048, 3845, 1},
+    {0x008008249201, 3846, 1},
+    {0x008008249240, 3847, 2},
+    {0x008008249480, 3849, 1},
+    {0x008008251008, 3850, 1},
+    {0x008008251011, 3851, 1},
+    {0x008008251050, 3852, 1},
+    {0x008008252012, 3853, 1},
+    {0x008008259440, 3854, 1},
+    {0x00800825a201, 3855, 1},
+    {0x008008261208, 3856, 1},
+    {0x008008289040, 3857, 1},
+    {0x008008289088, 3858, 1},
+    {0x008008289280, 3859, 1},
+    {0x00800828a041, 3860, 1},
+    {0x008008291048, 3861, 1},
+    {0x008008291090, 3862, 1},
+    {0x008008299240, 3863, 1},
+    {0x008008299480, 3864, 1},
+    {0x0080082c900a, 3865, 1},
+    {0x0080082d1009, 3866, 1},
+    {0x0080082d1012, 3867, 1},
+    {0x0080082d9009, 3868, 1},
+    {0x0080082d9048, 3869, 1},
+    {0x0080082d9240, 3870, 1},
+    {0x0080082da00a, 3871, 1},
+    {0x0080082e1008, 3872, 1},
+    {0x0080082e1011, 3873, 1},
+    {0x0080082e1050, 3874, 1},
+    {0x0080082e2009, 3875, 1},
+    {0x0080082e2012, 3876, 1},
+    {0x008008309041, 3877, 1},
+    {0x008008319040, 3878, 1},
+    {0x008008319088, 3879, 1},
+    {0x008008319280, 3880, 1},
+    {0x00800831a041, 3881, 1},
+    {0x008008321048, 3882, 1},
+    {0x008008321090, 3883, 1},
+    {0x008008449440, 3884, 1},
+    {0x00800844a201, 3885, 1},
+    {0x008008451208, 3886, 1},
+    {0x008008489240, 3887, 1},
+    {0x008008489480, 3888, 1},
+    {0x0080084c9201, 3889, 1},
+    {0x0080084d9440, 3890, 1},
+    {0x0080084da201, 3891, 1},
+    {0x0080084e1208, 3892, 1},
+    {0x008008519240, 3893, 1},
+    {0x008008519480, 3894, 1},
+    {0x00800928a040, 3895, 1},
+    {0x0080092d1008, 3896, 1},
+    {0x0080092e2008, 3897, 1},
+    {0x008009309040, 3898, 1},
+    {0x00800931a040, 3899, 1},
+    {0x008011208250, 3900, 1},
+    {0x008011208448, 3901, 1},
+    {0x0080112084d0, 3902, 1},
+    {0x008011248440, 3903, 1},
+    {0x008011250208, 3904, 1},
+    {0x008011288048, 3905, 1},
+    {0x008011288090, 3906, 1},
+    {0x008011288240, 3907, 1},
+    {0x008011288480, 3908, 1},
+    {0x0080112c8009, 3909, 1},
+    {0x0080112c8048, 3910, 1},
+    {0x0080112c8240, 3911, 1},
+    {0x0080112d0008, 3912, 1},
+    {0x0080112d0011, 3913, 1},
+    {0x0080112d0050, 3914, 1},
+    {0x0080112e1008, 3915, 1},
+    {0x008011308040, 3916, 1},
+    {0x008011308088, 3917, 1},
+    {0x008011308280, 3918, 1},
+    {0x008011310048, 3919, 1},
+    {0x008011310090, 3920, 1},
+    {0x008011319040, 3921, 1},
+    {0x008011448208, 3922, 1},
+    {0x0080114c8440, 3923, 1},
+    {0x0080114d0208, 3924, 1},
+    {0x008011508240, 3925, 1},
+    {0x008011508480, 3926, 1},
+    {0x0080122d1008, 3927, 1},
+    {0x0080122e2008, 3928, 1},
+    {0x008012309040, 3929, 1},
+    {0x00801231a040, 3930, 1},
+    {0x008018211248, 3931, 1},
+    {0x0080182114c8, 3932, 1},
+    {0x008018221250, 3933, 1},
+    {0x008018221448, 3934, 1},
+    {0x0080182214d0, 3935, 1},
+    {0x008018251201, 3936, 1},
+    {0x008018251240, 3937, 2},
+    {0x008018251480, 3939, 1},
+    {0x008018261440, 3940, 1},
+    {0x008018262201, 3941, 1},
+    {0x008018269208, 3942, 1},
+    {0x008018291280, 3943, 1},
+    {0x0080182a1240, 3944, 1},
+    {0x0080182a1480, 3945, 1},
+    {0x0080182d100a, 3946, 1},
+    {0x0080182e1009, 3947, 2},
+    {0x0080182e1012, 3949, 1},
+    {0x0080182e1048, 3950, 1},
+    {0x0080182e1240, 3951, 1},
+    {0x0080182e9008, 3952, 1},
+    {0x0080182e9011, 3953, 1},
+    {0x0080182e9050, 3954, 1},
+    {0x0080182ea012, 3955, 1},
+    {0x008018311041, 3956, 1},
+    {0x008018321040, 3957, 1},
+    {0x008018321088, 3958, 1},
+    {0x008018321280, 3959, 1},
+    {0x008018322041, 3960, 1},
+    {0x008018329048, 3961, 1},
+    {0x008018329090, 3962, 1},
+    {0x008018449201, 3963, 1},
+    {0x008018451440, 3964, 1},
+    {0x008018452201, 3965, 1},
+    {0x008018461208, 3966, 1},
+    {0x008018491240, 3967, 1},
+    {0x008018491480, 3968, 1},
+    {0x0080184d1201, 3969, 1},
+    {0x0080184e1440, 3970, 1},
+    {0x0080184e2201, 3971, 1},
+    {0x0080184e9208, 3972, 1},
+    {0x008018521240, 3973, 1},
+    {0x008018521480, 3974, 1},
+    {0x008019311040, 3975, 1},
+    {0x008019322040, 3976, 1},
+    {0x008021208248, 3977, 1},
+    {0x0080212084c8, 3978, 1},
+    {0x008021218250, 3979, 1},
+    {0x008021218448, 3980, 1},
+    {0x0080212184d0, 3981, 1},
+    {0x008021248240, 3982, 2},
+    {0x008021248480, 3984, 1},
+    {0x008021250440, 3985, 1},
+    {0x008021260208, 3986, 1},
+    {0x008021288280, 3987, 1},
+    {0x008021290240, 3988, 1},
+    {0x008021290480, 3989, 1},
+    {0x0080212d0240, 3990, 1},
+    {0x008021310040, 3991, 1},
+    {0x008021310088, 3992, 1},
+    {0x008021310280, 3993, 1},
+    {0x008021320048, 3994, 1},
+    {0x008021320090, 3995, 1},
+    {0x008021448440, 3996, 1},
+    {0x008021458208, 3997, 1},
+    {0x008021488240, 3998, 1},
+    {0x008021488480, 3999, 1},
+    {0x0080214d0440, 4000, 1},
+    {0x0080214e0208, 4001, 1},
+    {0x008021510240, 4002, 1},
+    {0x008021510480, 4003, 1},
+    {0x008048291008, 4004, 1},
+    {0x008048309040, 4005, 1},
+    {0x008048321008, 4006, 1},
+    {0x008048359040, 4007, 1},
+    {0x008049301040, 4008, 1},
+    {0x008050289040, 4009, 1},
+    {0x0080502e1008, 4010, 1},
+    {0x008050319040, 4011, 1},
+    {0x008051280048, 4012, 1},
+    {0x008051300088, 4013, 1},
+    {0x008051310008, 4014, 1},
+    {0x008051348040, 4015, 1},
+    {0x008052301040, 4016, 1},
+    {0x008058311040, 4017, 1},
+    {0x008058329008, 4018, 1},
+    {0x008058361040, 4019, 1},
+    {0x008060321040, 4020, 1},
+    {0x008061308040, 4021, 2},
+    {0x008061350040, 4023, 1},
+    {0x008090291008, 4024, 1},
+    {0x008090309040, 4025, 1},
+    {0x008090321008, 4026, 1},
+    {0x008090359040, 4027, 1},
+    {0x008091301040, 4028, 1},
+    {0x0080a0311040, 4029, 1},
+    {0x0080a0329008, 4030, 1},
+    {0x0080a0361040, 4031, 1},
+    {0x0080a1300088, 4032, 1},
+    {0x0080a9350040, 4033, 1},
+    {0x008208249040, 4034, 1},
+    {0x008208261008, 4035, 1},
+    {0x008208299040, 4036, 1},
+    {0x008208451008, 4037, 1},
+    {0x008208489040, 4038, 1},
+    {0x0082084e1008, 4039, 1},
+    {0x008208519040, 4040, 1},
+    {0x008211250008, 4041, 1},
+    {0x008211448008, 4042, 1},
+    {0x0082114d0008, 4043, 1},
+    {0x008218251040, 4044, 1},
+    {0x008218269008, 4045, 1},
+    {0x0082182a1040, 4046, 1},
+    {0x008218461008, 4047, 1},
+    {0x008218491040, 4048, 1},
+    {0x0082184e9008, 4049, 1},
+    {0x008218521040, 4050, 1},
+    {0x008221260008, 4051, 1},
+    {0x008221458008, 4052, 1},
+    {0x0082214e0008, 4053, 1},
+    {0x008248049040, 4054, 1},
+    {0x008248099040, 4055, 1},
+    {0x0082580a1040, 4056, 1},
+    {0x0082980d1040, 4057, 1},
+    {0x008298121040, 4058, 1},
+    {0x008320121040, 4059, 1},
+};
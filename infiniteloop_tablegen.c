@@ -0,0 +1,132 @@
+// Copyright (c) 2016 Ed Schouten <ed@nuxi.nl>
+//
+// This file is distributed under a 2-clause BSD license.
+// See the LICENSE file for details.
+
+// Generates infiniteloop_tablebase.h, containing the solutions of all
+// small components of connected cells in canonical form.
+//
+// Instead of enumerating components and solving them, this tool
+// enumerates all sets of edges within a 4x4 box. Every set of edges is a
+// solution to the component formed by the cells it touches.
+
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "infiniteloop_impl.h"
+
+struct pair {
+  uint64_t key;
+  uint32_t solution;
+  uint32_t unused;
+};
+
+static int compare_pairs(const void *a, const void *b) {
+  const struct pair *pa = a, *pb = b;
+  if (pa->key != pb->key)
+    return pa->key < pb->key ? -1 : 1;
+  return pa->solution < pb->solution ? -1 : pa->solution > pb->solution;
+}
+
+// Returns true if a set of cells within the 4x4 box is connected.
+static bool connected(unsigned int cells) {
+  unsigned int seen = cells & -cells, prev = 0;
+  while (seen != prev) {
+    prev = seen;
+    seen |= ((seen & 0x7777) << 1 | (seen & 0xeeee) >> 1 | seen << 4 |
+             seen >> 4) &
+            cells;
+  }
+  return seen == cells;
+}
+
+int main(void) {
+  size_t npairs = 0, maxpairs = 1 << 20;
+  struct pair *pairs = malloc(maxpairs * sizeof(*pairs));
+  if (pairs == NULL)
+    return 1;
+
+  // Edges 0 to 11 are horizontal and edges 12 to 23 are vertical.
+  for (uint32_t edges = 1; edges < 1 << 24; ++edges) {
+    unsigned char cells[16] = {};
+    for (unsigned int i = 0; i < 12; ++i) {
+      if ((edges & (1U << i)) != 0) {
+        unsigned int pos = i / 3 * 4 + i % 3;
+        cells[pos] |= 0x2;
+        cells[pos + 1] |= 0x8;
+      }
+      if ((edges & (1U << (i + 12))) != 0) {
+        cells[i] |= 0x4;
+        cells[i + 4] |= 0x1;
+      }
+    }
+
+    // Only consider components that are small enough.
+    struct component c = {.ncells = 0};
+    unsigned char masks[16];
+    unsigned int occupied = 0;
+    for (unsigned int pos = 0; pos < 16 && c.ncells <= TABLEBASE_CELLS;
+         ++pos) {
+      if (cells[pos] != 0) {
+        if (c.ncells < TABLEBASE_CELLS) {
+          c.x[c.ncells] = pos % 4;
+          c.y[c.ncells] = pos / 4;
+          c.shape[c.ncells] = shape(cells[pos]);
+          masks[c.ncells] = cells[pos];
+        }
+        ++c.ncells;
+        occupied |= 1U << pos;
+      }
+    }
+    if (c.ncells > TABLEBASE_CELLS || !connected(occupied))
+      continue;
+
+    // Store the solution in the canonical frame of the component.
+    component_canonicalize(&c);
+    uint32_t solution = 0;
+    for (size_t i = c.ncells; i-- > 0;)
+      solution = solution << 4 | symmetry_edges(c.symmetry, masks[c.order[i]]);
+    if (npairs == maxpairs) {
+      maxpairs *= 2;
+      pairs = realloc(pairs, maxpairs * sizeof(*pairs));
+      if (pairs == NULL)
+        return 1;
+    }
+    pairs[npairs++] = (struct pair){.key = c.key, .solution = solution};
+  }
+  qsort(pairs, npairs, sizeof(pairs[0]), compare_pairs);
+
+  // Print all unique solutions, followed by an index.
+  printf(
+      "// Generated by infiniteloop_tablegen. Do not edit.\n"
+      "\n"
+      "static const uint32_t tablebase_solutions[] = {\n");
+  size_t nsolutions = 0;
+  for (size_t i = 0; i < npairs; ++i) {
+    if (i == 0 || pairs[i].key != pairs[i - 1].key ||
+        pairs[i].solution != pairs[i - 1].solution) {
+      printf(nsolutions % 6 == 0 ? "    0x%08" PRIx32 "," : " 0x%08" PRIx32 ",",
+             pairs[i].solution);
+      if (nsolutions % 6 == 5)
+        printf("\n");
+      pairs[nsolutions++] = pairs[i];
+    }
+  }
+  printf(
+      "%s};\n"
+      "\n"
+      "static const struct tablebase_entry tablebase_entries[] = {\n",
+      nsolutions % 6 == 0 ? "" : "\n");
+  for (size_t i = 0; i < nsolutions;) {
+    size_t j = i + 1;
+    while (j < nsolutions && pairs[j].key == pairs[i].key)
+      ++j;
+    printf("    {0x%012" PRIx64 ", %zu, %zu},\n", pairs[i].key, i, j - i);
+    i = j;
+  }
+  printf("};\n");
+  free(pairs);
+  return 0;
+}
@@ -4,10 +4,17 @@
 // See the LICENSE file for details.
 
 #include <assert.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <math.h>
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <unistd.h>
 
 #include "infiniteloop.h"
+#include "infiniteloop_impl.h"
 
 #define TEST(a, b) int main(void)
 #define ASSERT_TRUE(x) assert(x)
@@ -72,6 +79,270 @@ static bool resolve_callback(const struct il_solution *s, void *thunk) {
   return !param->found;
 }
 
+// Returns true if a cell is placed differently in two solutions.
+static bool cell_differs(const struct il_solution *a,
+                         const struct il_solution *b, size_t x, size_t y) {
+  return (y > 0 && a->vertical[x][y - 1] != b->vertical[x][y - 1]) ||
+         (x < IL_AXIS - 3 && a->horizontal[x][y] != b->horizontal[x][y]) ||
+         (y < IL_AXIS - 3 && a->vertical[x][y] != b->vertical[x][y]) ||
+         (x > 0 && a->horizontal[x - 1][y] != b->horizontal[x - 1][y]);
+}
+
+struct backbone_param {
+  struct il_solution first;
+  struct il_backbone backbone;
+  struct il_marginals marginals;
+};
+
+static bool backbone_callback(const struct il_solution *s, void *thunk) {
+  // Compare every solution against the first one found.
+  struct backbone_param *param = thunk;
+  if (param->marginals.solutions < 1.0)
+    param->first = *s;
+  for (size_t x = 0; x < IL_AXIS - 2; ++x)
+    for (size_t y = 0; y < IL_AXIS - 2; ++y)
+      if (cell_differs(&param->first, s, x, y))
+        param->backbone.fixed[x][y] = false;
+
+  // Count the number of times every edge is set.
+  ++param->marginals.solutions;
+  for (size_t x = 0; x < IL_AXIS - 3; ++x)
+    for (size_t y = 0; y < IL_AXIS - 2; ++y)
+      param->marginals.horizontal[x][y] += s->horizontal[x][y];
+  for (size_t x = 0; x < IL_AXIS - 2; ++x)
+    for (size_t y = 0; y < IL_AXIS - 3; ++y)
+      param->marginals.vertical[x][y] += s->vertical[x][y];
+  return true;
+}
+
+// Returns true if two solution counts are approximately equal.
+static bool count_equal(double a, double b) {
+  return a - b < 1e-6 && b - a < 1e-6;
+}
+
+// Generates a random solution, where every edge is present with a
+// probability of 1/one_in.
+static void random_solution(struct il_solution *s, unsigned int one_in) {
+  for (size_t x = 0; x < IL_AXIS - 3; ++x)
+    for (size_t y = 0; y < IL_AXIS - 2; ++y)
+      s->horizontal[x][y] = arc4random_uniform(one_in) == 0;
+  for (size_t x = 0; x < IL_AXIS - 2; ++x)
+    for (size_t y = 0; y < IL_AXIS - 3; ++y)
+      s->vertical[x][y] = arc4random_uniform(one_in) == 0;
+}
+
+static bool count_callback(const struct il_solution *s, void *thunk) {
+  ++*(size_t *)thunk;
+  return true;
+}
+
+static bool large_count_callback(const struct il_large_solution *s,
+                                 void *thunk) {
+  ++*(size_t *)thunk;
+  return true;
+}
+
+// Creates a large puzzle from a random solution, where every edge is
+// present with a probability of 1/2.
+static struct il_large_problem *random_large_problem(size_t width,
+                                                     size_t height,
+                                                     enum il_layout layout) {
+  struct il_large_problem *p = il_large_problem_create(width, height, layout);
+  ASSERT_TRUE(p != NULL);
+  for (size_t x = 0; x < width; ++x) {
+    for (size_t y = 0; y < height; ++y) {
+      if (x < width - 1 && arc4random_uniform(2) == 0) {
+        il_large_problem_set(p, x, y, il_large_problem_get(p, x, y) | 0x2);
+        il_large_problem_set(p, x + 1, y,
+                             il_large_problem_get(p, x + 1, y) | 0x8);
+      }
+      if (y < height - 1 && arc4random_uniform(2) == 0) {
+        il_large_problem_set(p, x, y, il_large_problem_get(p, x, y) | 0x4);
+        il_large_problem_set(p, x, y + 1,
+                             il_large_problem_get(p, x, y + 1) | 0x1);
+      }
+    }
+  }
+  return p;
+}
+
+// Checks that every edge of a solution of a large puzzle has a matching
+// edge on the neighbouring cell.
+static void large_check(const struct il_large_problem *p,
+                        const struct il_large_solution *s) {
+  size_t width = il_large_problem_width(p), height = il_large_problem_height(p);
+  for (size_t x = 0; x < width; ++x) {
+    for (size_t y = 0; y < height; ++y) {
+      unsigned char c = il_large_solution_get(s, x, y);
+      ASSERT_TRUE(((c & 0x1) != 0) ==
+                  (y > 0 && (il_large_solution_get(s, x, y - 1) & 0x4) != 0));
+      ASSERT_TRUE(((c & 0x2) != 0) == (x < width - 1 &&
+                                       (il_large_solution_get(s, x + 1, y) &
+                                        0x8) != 0));
+    }
+  }
+}
+
+static bool large_valid_callback(const struct il_large_solution *s,
+                                 void *thunk) {
+  large_check(thunk, s);
+  return false;
+}
+
+// Validates and counts the solutions of a large puzzle.
+struct large_local_param {
+  const struct il_large_problem *p;
+  size_t count;
+};
+
+static bool large_local_callback(const struct il_large_solution *s,
+                                 void *thunk) {
+  struct large_local_param *param = thunk;
+  large_check(param->p, s);
+  ++param->count;
+  return true;
+}
+
+// Order-sensitive digest of the solutions generated by a solver.
+struct digest_param {
+  uint64_t digest;
+  size_t count;
+};
+
+static bool digest_callback(const struct il_solution *s, void *thunk) {
+  struct digest_param *param = thunk;
+  const unsigned char *bytes = (const unsigned char *)s;
+  for (size_t i = 0; i < sizeof(*s); ++i)
+    param->digest = (param->digest ^ bytes[i]) * 0x100000001b3;
+  ++param->count;
+  return true;
+}
+
+// Computes the digest of the solutions of a problem when guessing cells
+// in a fixed order on a single thread.
+static void deterministic_digest(const struct il_problem *p,
+                                 struct digest_param *param) {
+  *param = (struct digest_param){.digest = 0xcbf29ce484222325, .count = 0};
+  struct il_solver *solver = il_solver_create(p, digest_callback, param);
+  ASSERT_TRUE(solver != NULL);
+  il_solver_set_deterministic(solver);
+  ASSERT_TRUE(il_solver_run(solver, ULONG_MAX));
+  il_solver_destroy(solver);
+}
+
+// Sink that appends output to a buffer.
+struct buffer_param {
+  char *data;
+  size_t len;
+};
+
+static bool buffer_sink(const char *in, size_t inlen, void *thunk) {
+  struct buffer_param *param = thunk;
+  char *data = realloc(param->data, param->len + inlen);
+  ASSERT_TRUE(data != NULL);
+  memcpy(data + param->len, in, inlen);
+  param->data = data;
+  param->len += inlen;
+  return true;
+}
+
+// Removes the lowest rotation from the first step of a given kind in a
+// refutation that keeps any rotations. Returns false if there is no
+// such step.
+static bool refutation_drop_rotation(char *data, size_t len, char kind) {
+  for (size_t i = 0; i < len;) {
+    size_t eol = i;
+    while (eol < len && data[eol] != '\n')
+      ++eol;
+    if (eol > i && data[i] == kind && data[eol - 1] != '0') {
+      char *m = &data[eol - 1];
+      unsigned int options =
+          *m <= '9' ? (unsigned int)(*m - '0') : (unsigned int)(*m - 'a' + 10);
+      *m = "0123456789abcdef"[options & (options - 1)];
+      return true;
+    }
+    i = eol + 1;
+  }
+  return false;
+}
+
+// Appends a solution to a buffer, in the same form as
+// il_problem_solve_text().
+static bool text_callback(const struct il_solution *s, void *thunk) {
+  char buf[IL_SOLUTION_PRINT_MAX];
+  ASSERT_TRUE(il_solution_print(s, buf, sizeof(buf)));
+  buffer_sink("-- SOLUTION --\n", 15, thunk);
+  buffer_sink(buf, strlen(buf), thunk);
+  buffer_sink("\n", 1, thunk);
+  return true;
+}
+
+struct render_param {
+  char buf[IL_SOLUTION_PRINT_MAX];
+  size_t len;
+};
+
+static bool render_sink(const char *in, size_t inlen, void *thunk) {
+  struct render_param *param = thunk;
+  ASSERT_TRUE(inlen > 0 && param->len + inlen < sizeof(param->buf));
+  memcpy(param->buf + param->len, in, inlen);
+  param->len += inlen;
+  param->buf[param->len] = '\0';
+  return true;
+}
+
+static bool large_render_callback(const struct il_large_solution *s,
+                                  void *thunk) {
+  struct resolve_param *param = thunk;
+  struct render_param render = {.len = 0};
+  ASSERT_TRUE(il_large_solution_render(s, render_sink, &render));
+  if (strcmp(render.buf, param->expected) == 0)
+    param->found = true;
+  return !param->found;
+}
+
+struct schedule_param {
+  struct il_problem problem;
+  size_t solutions;
+  unsigned int completions;
+  enum il_request_status status;
+};
+
+static bool schedule_callback(const struct il_solution *s, void *thunk) {
+  struct schedule_param *param = thunk;
+  ++param->solutions;
+  return true;
+}
+
+static void schedule_done(enum il_request_status status, void *thunk) {
+  struct schedule_param *param = thunk;
+  ++param->completions;
+  param->status = status;
+}
+
+struct collect_param {
+  struct il_solution solutions[16];
+  size_t nsolutions;
+};
+
+static bool collect_callback(const struct il_solution *s, void *thunk) {
+  struct collect_param *param = thunk;
+  if (param->nsolutions == 16)
+    return false;
+  param->solutions[param->nsolutions++] = *s;
+  return true;
+}
+
+static bool batch_callback(size_t index, const struct il_solution *s,
+                           void *thunk) {
+  ++((size_t *)thunk)[index];
+  return true;
+}
+
+static int compare_solutions(const void *a, const void *b) {
+  return memcmp(a, b, sizeof(struct il_solution));
+}
+
 TEST(il_solve, examples) {
   // Empty puzzles.
   EXAMPLE("", "");
@@ -91,6 +362,20 @@ TEST(il_solve, examples) {
       "│  │  │  │\n"
       "╵  ╰──╯  ╵");
 
+  // Small component that is resolved by using the tablebase.
+  EXAMPLE(
+      "C1\n"
+      "S1\n"
+      "C3C\n"
+      "  1",
+      "╭──╴\n"
+      "│\n"
+      "│  ╷\n"
+      "│  │\n"
+      "╰──┴──╮\n"
+      "      │\n"
+      "      ╵");
+
   EXAMPLE(
       "11  11\n"
       "CC11CC\n"
@@ -152,12 +437,7 @@ TEST(il_solve, examples) {
     // Generate a random solution and store the expected textual
     // representation.
     struct il_solution s;
-    for (size_t x = 0; x < IL_AXIS - 3; ++x)
-      for (size_t y = 0; y < IL_AXIS - 2; ++y)
-        s.horizontal[x][y] = arc4random_uniform(2);
-    for (size_t x = 0; x < IL_AXIS - 2; ++x)
-      for (size_t y = 0; y < IL_AXIS - 3; ++y)
-        s.vertical[x][y] = arc4random_uniform(2);
+    random_solution(&s, 2);
     struct resolve_param param;
     ASSERT_TRUE(il_solution_print(&s, param.expected, sizeof(param.expected)));
 
@@ -168,5 +448,868 @@ TEST(il_solve, examples) {
     param.found = false;
     il_problem_solve(&p, resolve_callback, &param);
     ASSERT_TRUE(param.found);
+
+    // Rendering the solution should yield the same output, both when
+    // solving it as a large board and when writing it to a pipe.
+    struct render_param render = {.len = 0};
+    ASSERT_TRUE(il_solution_render(&s, render_sink, &render));
+    ASSERT_TRUE(strcmp(render.buf, param.expected) == 0);
+
+    struct il_large_problem *lp =
+        il_large_problem_create(IL_AXIS - 2, IL_AXIS - 2, IL_LAYOUT_TILED);
+    ASSERT_TRUE(lp != NULL);
+    for (size_t x = 0; x < IL_AXIS - 2; ++x)
+      for (size_t y = 0; y < IL_AXIS - 2; ++y)
+        il_large_problem_set(lp, x, y, p.board[x + 1][y + 1]);
+    param.found = false;
+    ASSERT_TRUE(
+        il_large_problem_solve(lp, 0, NULL, large_render_callback, &param));
+    ASSERT_TRUE(param.found);
+    il_large_problem_destroy(lp);
+
+    int fds[2];
+    ASSERT_TRUE(pipe(fds) == 0);
+    ASSERT_TRUE(il_solution_render(&s, il_sink_fd, &fds[1]));
+    close(fds[1]);
+    char buf[IL_SOLUTION_PRINT_MAX];
+    size_t len = 0;
+    ssize_t ret;
+    while ((ret = read(fds[0], buf + len, sizeof(buf) - 1 - len)) > 0)
+      len += (size_t)ret;
+    close(fds[0]);
+    buf[len] = '\0';
+    ASSERT_TRUE(strcmp(buf, param.expected) == 0);
+
+    // Printing the problem and parsing it again should yield a problem
+    // that is printed identically and has the same solutions.
+    char problem[IL_PROBLEM_PRINT_MAX];
+    ASSERT_TRUE(il_problem_print(&p, problem, sizeof(problem)));
+    struct il_problem reparsed;
+    ASSERT_TRUE(il_problem_parse(problem, &reparsed));
+    char reprinted[IL_PROBLEM_PRINT_MAX];
+    ASSERT_TRUE(il_problem_print(&reparsed, reprinted, sizeof(reprinted)));
+    ASSERT_TRUE(strcmp(problem, reprinted) == 0);
+    param.found = false;
+    il_problem_solve(&reparsed, resolve_callback, &param);
+    ASSERT_TRUE(param.found);
+  }
+
+  for (int i = 0; i < 100; ++i) {
+    // Mirroring a random puzzle along its diagonal and moving it should
+    // not change its canonical form or its number of solutions.
+    struct il_solution s;
+    for (size_t x = 0; x < IL_AXIS - 3; ++x)
+      for (size_t y = 0; y < IL_AXIS - 2; ++y)
+        s.horizontal[x][y] = x < 8 && y < 10 && arc4random_uniform(2);
+    for (size_t x = 0; x < IL_AXIS - 2; ++x)
+      for (size_t y = 0; y < IL_AXIS - 3; ++y)
+        s.vertical[x][y] = x < 9 && y < 9 && arc4random_uniform(2);
+    struct il_problem p, mirrored;
+    il_solution_unsolve(&s, &p);
+    memset(&mirrored, 0, sizeof(mirrored));
+    for (size_t x = 1; x < IL_AXIS - 3; ++x) {
+      for (size_t y = 1; y < IL_AXIS - 3; ++y) {
+        unsigned char c = p.board[x][y];
+        mirrored.board[y + 2][x + 2] = (unsigned char)(
+            (c & 0x1) << 3 | (c & 0x2) << 1 | (c & 0x4) >> 1 | (c & 0x8) >> 3);
+      }
+    }
+
+    struct il_problem a, b, c;
+    il_problem_canonicalize(&p, &a);
+    il_problem_canonicalize(&mirrored, &b);
+    il_problem_canonicalize(&a, &c);
+    ASSERT_TRUE(memcmp(&a, &b, sizeof(a)) == 0);
+    ASSERT_TRUE(memcmp(&a, &c, sizeof(a)) == 0);
+    size_t count1 = 0, count2 = 0;
+    il_problem_solve(&p, count_callback, &count1);
+    il_problem_solve(&a, count_callback, &count2);
+    ASSERT_TRUE(count1 == count2);
+  }
+
+  {
+    // Converting a solution back to a problem should place cells in
+    // their solved positions, with edges pointing south on the upper
+    // cell of a vertical connection. Solving the problem should yield
+    // the same solution without turning any cells.
+    struct il_solution s;
+    memset(&s, 0, sizeof(s));
+    s.horizontal[1][2] = true;
+    s.vertical[4][5] = true;
+    struct il_problem p;
+    il_solution_unsolve(&s, &p);
+    ASSERT_TRUE(p.board[2][3] == 0x2 && p.board[3][3] == 0x8);
+    ASSERT_TRUE(p.board[5][6] == 0x4 && p.board[5][7] == 0x1);
+
+    struct resolve_param param = {.found = false};
+    ASSERT_TRUE(il_solution_print(&s, param.expected, sizeof(param.expected)));
+    il_problem_solve(&p, resolve_callback, &param);
+    ASSERT_TRUE(param.found);
+    unsigned int taps;
+    ASSERT_TRUE(il_problem_taps(&p, &s, &taps) && taps == 0);
+  }
+
+  for (int i = 0; i < 100; ++i) {
+    // A puzzle converted from a solution needs no taps. Every quarter
+    // turn counterclockwise of a cell without symmetry needs a tap.
+    struct il_solution s;
+    random_solution(&s, 2);
+    struct il_problem p;
+    il_solution_unsolve(&s, &p);
+    unsigned int taps;
+    ASSERT_TRUE(il_problem_taps(&p, &s, &taps) && taps == 0);
+
+    size_t x = arc4random_uniform(IL_AXIS - 2) + 1;
+    size_t y = arc4random_uniform(IL_AXIS - 2) + 1;
+    unsigned char c = p.board[x][y];
+    unsigned int period =
+        c == 0x0 || c == 0xf ? 1 : c == 0x5 || c == 0xa ? 2 : 4;
+    for (unsigned int turns = 1; turns < 4; ++turns) {
+      unsigned char d = p.board[x][y];
+      p.board[x][y] = (unsigned char)((d >> 1 | d << 3) & 0xf);
+      ASSERT_TRUE(il_problem_taps(&p, &s, &taps) && taps == turns % period);
+    }
+    p.board[x][y] = c ^ 0x1;
+    ASSERT_TRUE(!il_problem_taps(&p, &s, &taps));
+  }
+
+  {
+    // Puzzles that differ in more than symmetry have different
+    // canonical forms.
+    struct il_problem p, q, a, b;
+    ASSERT_TRUE(il_problem_parse("1ss1\n1cc1", &p));
+    ASSERT_TRUE(il_problem_parse("1cc1\n1ss1", &q));
+    il_problem_canonicalize(&p, &a);
+    il_problem_canonicalize(&q, &b);
+    ASSERT_TRUE(memcmp(&a, &b, sizeof(a)) == 0);
+    ASSERT_TRUE(il_problem_parse("1ss1\n1c1c", &q));
+    il_problem_canonicalize(&q, &b);
+    ASSERT_TRUE(memcmp(&a, &b, sizeof(a)) != 0);
+  }
+
+  {
+    // Puzzles are printed without trailing whitespace.
+    struct il_problem p;
+    ASSERT_TRUE(il_problem_parse("1C 1\n \n\n  S3  \n4\n\n", &p));
+    char buf[IL_PROBLEM_PRINT_MAX];
+    ASSERT_TRUE(il_problem_print(&p, buf, sizeof(buf)));
+    ASSERT_TRUE(strcmp(buf, "1c 1\n\n\n  s3\n4") == 0);
+    ASSERT_TRUE(!il_problem_print(&p, buf, 4));
+  }
+
+  {
+    // Solving a sequence of puzzles in one go should yield the same
+    // output as solving them one by one. The puzzles have at most one
+    // solution, so that their order is fixed. The output can be used as
+    // input again.
+    const char *input =
+        "cc\nCC\n-- PUZZLE --\n1sssss\n-- IGNORED --\n1cc1\n"
+        "-- PUZZLE --\n\n 1ss1\n";
+    const char *const puzzles[] = {"cc\ncc", "1sssss", "\n 1ss1"};
+    struct buffer_param expected = {.data = NULL, .len = 0};
+    for (size_t i = 0; i < sizeof(puzzles) / sizeof(puzzles[0]); ++i) {
+      struct il_problem p;
+      ASSERT_TRUE(il_problem_parse(puzzles[i], &p));
+      char buf[IL_SOLUTION_PRINT_MAX];
+      ASSERT_TRUE(il_problem_print(&p, buf, sizeof(buf)));
+      ASSERT_TRUE(strcmp(buf, puzzles[i]) == 0);
+      buffer_sink("-- PUZZLE --\n", 13, &expected);
+      buffer_sink(buf, strlen(buf), &expected);
+      buffer_sink("\n", 1, &expected);
+      size_t count = 0;
+      il_problem_solve(&p, count_callback, &count);
+      ASSERT_TRUE(count <= 1);
+      il_problem_solve(&p, text_callback, &expected);
+      const char *found = count == 0 ? "-- FOUND 0 SOLUTIONS --\n"
+                                     : "-- FOUND 1 SOLUTIONS --\n";
+      buffer_sink(found, strlen(found), &expected);
+    }
+
+    struct buffer_param output = {.data = NULL, .len = 0};
+    ASSERT_TRUE(
+        il_problem_solve_text(input, strlen(input), buffer_sink, &output));
+    struct buffer_param again = {.data = NULL, .len = 0};
+    ASSERT_TRUE(il_problem_solve_text(output.data, output.len,
+                                      buffer_sink, &again));
+    ASSERT_TRUE(output.len == expected.len &&
+                memcmp(output.data, expected.data, expected.len) == 0);
+    ASSERT_TRUE(again.len == output.len &&
+                memcmp(again.data, output.data, output.len) == 0);
+    free(expected.data);
+    free(output.data);
+    free(again.data);
+  }
+
+  for (int i = 0; i < 100; ++i) {
+    // Generate a random problem that is likely to be ambiguous.
+    struct il_solution s;
+    random_solution(&s, 3);
+    struct il_problem p;
+    il_solution_unsolve(&s, &p);
+
+    // The backbone should match the one obtained through enumeration.
+    struct backbone_param param = {.marginals = {.solutions = 0.0}};
+    for (size_t x = 0; x < IL_AXIS - 2; ++x)
+      for (size_t y = 0; y < IL_AXIS - 2; ++y)
+        param.backbone.fixed[x][y] = true;
+    il_problem_solve(&p, backbone_callback, &param);
+    struct il_backbone b;
+    ASSERT_TRUE(il_problem_backbone(&p, &b));
+    ASSERT_TRUE(memcmp(&b, &param.backbone, sizeof(b)) == 0);
+
+    // So should the solution statistics.
+    struct il_marginals m;
+    il_problem_marginals(&p, &m);
+    ASSERT_TRUE(count_equal(m.solutions, param.marginals.solutions));
+    for (size_t x = 0; x < IL_AXIS - 3; ++x)
+      for (size_t y = 0; y < IL_AXIS - 2; ++y)
+        ASSERT_TRUE(
+            count_equal(m.horizontal[x][y], param.marginals.horizontal[x][y]));
+    for (size_t x = 0; x < IL_AXIS - 2; ++x)
+      for (size_t y = 0; y < IL_AXIS - 3; ++y)
+        ASSERT_TRUE(
+            count_equal(m.vertical[x][y], param.marginals.vertical[x][y]));
+    for (size_t x = 0; x < IL_AXIS - 2; ++x)
+      for (size_t y = 0; y < IL_AXIS - 2; ++y)
+        ASSERT_TRUE(count_equal(m.rotation[x][y][0] + m.rotation[x][y][1] +
+                                    m.rotation[x][y][2] + m.rotation[x][y][3],
+                                m.solutions));
+  }
+
+  for (int i = 0; i < 10; ++i) {
+    // Generate a random problem consisting of nine copies of a random
+    // tile of 4x4 cells with at least eight solutions. Its solutions
+    // are too many to enumerate.
+    struct il_solution tile = {}, s = {};
+    struct il_problem p, tp;
+    size_t tile_solutions;
+    do {
+      for (size_t x = 0; x < 3; ++x) {
+        for (size_t y = 0; y < 4; ++y) {
+          tile.horizontal[x][y] = arc4random_uniform(2) == 0;
+          tile.vertical[y][x] = arc4random_uniform(2) == 0;
+        }
+      }
+      il_solution_unsolve(&tile, &tp);
+      tile_solutions = 0;
+      il_problem_solve(&tp, count_callback, &tile_solutions);
+    } while (tile_solutions < 8);
+    for (size_t ox = 0; ox < IL_AXIS - 2; ox += 5) {
+      for (size_t oy = 0; oy < IL_AXIS - 2; oy += 5) {
+        for (size_t x = 0; x < 3; ++x) {
+          for (size_t y = 0; y < 4; ++y) {
+            s.horizontal[ox + x][oy + y] = tile.horizontal[x][y];
+            s.vertical[ox + y][oy + x] = tile.vertical[y][x];
+          }
+        }
+      }
+    }
+    il_solution_unsolve(&s, &p);
+
+    // The solution statistics should follow from those of a single
+    // tile, obtained through enumeration.
+    struct backbone_param param = {.marginals = {.solutions = 0.0}};
+    il_problem_solve(&tp, backbone_callback, &param);
+    struct il_marginals m;
+    il_problem_marginals(&p, &m);
+    double t = param.marginals.solutions;
+    ASSERT_TRUE(count_equal(m.solutions / (t * t * t * t * t * t * t * t * t),
+                            1.0));
+    for (size_t x = 0; x < IL_AXIS - 3; ++x)
+      for (size_t y = 0; y < IL_AXIS - 2; ++y)
+        ASSERT_TRUE(count_equal(
+            m.horizontal[x][y] / m.solutions,
+            x % 5 < 3 && y % 5 < 4
+                ? param.marginals.horizontal[x % 5][y % 5] / t
+                : 0.0));
+    for (size_t x = 0; x < IL_AXIS - 2; ++x)
+      for (size_t y = 0; y < IL_AXIS - 3; ++y)
+        ASSERT_TRUE(count_equal(
+            m.vertical[x][y] / m.solutions,
+            x % 5 < 4 && y % 5 < 3 ? param.marginals.vertical[x % 5][y % 5] / t
+                                   : 0.0));
+  }
+
+  for (int i = 0; i < 100; ++i) {
+    // Generate a random problem that is likely to be ambiguous.
+    struct il_solution s;
+    random_solution(&s, 3);
+    struct il_problem p;
+    il_solution_unsolve(&s, &p);
+    size_t expected = 0;
+    il_problem_solve(&p, count_callback, &expected);
+
+    // Suspending and resuming the search at every node should not
+    // affect the outcome.
+    size_t steps = 0;
+    struct il_solver *solver = il_solver_create(&p, count_callback, &steps);
+    ASSERT_TRUE(solver != NULL);
+
+    // The estimated progress should never decrease, and cover the full
+    // search space once finished.
+    struct il_solver_progress progress;
+    il_solver_get_progress(solver, &progress);
+    ASSERT_TRUE(fpclassify(progress.explored) == FP_ZERO &&
+                progress.nodes == 0);
+    unsigned long nodes = 0;
+    while (!il_solver_run(solver, 1)) {
+      double explored = progress.explored;
+      il_solver_get_progress(solver, &progress);
+      ASSERT_TRUE(progress.explored >= explored &&
+                  progress.explored < 1.0 + 1e-9);
+      ASSERT_TRUE(progress.nodes == ++nodes);
+    }
+    il_solver_get_progress(solver, &progress);
+    ASSERT_TRUE(fabs(progress.explored - 1.0) < 1e-9);
+    il_solver_destroy(solver);
+    ASSERT_TRUE(steps == expected);
+
+    // Guessing cells by using belief propagation should not affect the
+    // outcome either.
+    steps = 0;
+    solver = il_solver_create(&p, count_callback, &steps);
+    ASSERT_TRUE(solver != NULL);
+    il_solver_set_belief_propagation(solver);
+    ASSERT_TRUE(il_solver_run(solver, ULONG_MAX));
+    il_solver_destroy(solver);
+    ASSERT_TRUE(steps == expected);
+
+    // Solvers split off from another should cover the remaining part.
+    solver = il_solver_create(&p, NULL, NULL);
+    ASSERT_TRUE(solver != NULL);
+    il_solver_run(solver, 3);
+    struct il_solver *split = il_solver_split(solver);
+    double explored = 0.0;
+    if (split != NULL) {
+      ASSERT_TRUE(il_solver_run(split, ULONG_MAX));
+      il_solver_get_progress(split, &progress);
+      explored += progress.explored;
+      il_solver_destroy(split);
+    }
+    ASSERT_TRUE(il_solver_run(solver, ULONG_MAX));
+    il_solver_get_progress(solver, &progress);
+    explored += progress.explored;
+    il_solver_destroy(solver);
+    ASSERT_TRUE(fabs(explored - 1.0) < 1e-9);
+
+    // An enumerator should yield every solution exactly once, also when
+    // it cannot store the solutions of the clusters.
+    struct il_solution *solutions = malloc((expected + 1) * sizeof(s));
+    ASSERT_TRUE(solutions != NULL);
+    size_t nsolutions;
+    const size_t max_bytes[] = {0, SIZE_MAX};
+    for (size_t j = 0; j < sizeof(max_bytes) / sizeof(max_bytes[0]); ++j) {
+      struct il_enumerator *e = il_enumerator_create(&p, max_bytes[j]);
+      ASSERT_TRUE(e != NULL);
+      nsolutions = 0;
+      while (nsolutions <= expected &&
+             il_enumerator_next(e, &solutions[nsolutions]))
+        ++nsolutions;
+      ASSERT_TRUE(!il_enumerator_next(e, &s));
+      il_enumerator_destroy(e);
+      ASSERT_TRUE(nsolutions == expected);
+      qsort(solutions, nsolutions, sizeof(s), compare_solutions);
+      for (size_t k = 1; k < nsolutions; ++k)
+        ASSERT_TRUE(compare_solutions(&solutions[k - 1], &solutions[k]) != 0);
+    }
+    for (size_t j = 0; j < nsolutions && j < 16; ++j) {
+      struct resolve_param param;
+      ASSERT_TRUE(il_solution_print(&solutions[j], param.expected,
+                                    sizeof(param.expected)));
+      param.found = false;
+      il_problem_solve(&p, resolve_callback, &param);
+      ASSERT_TRUE(param.found);
+    }
+    free(solutions);
+
+    // Solving it as a large board should yield the same number of
+    // solutions, regardless of the layout.
+    const enum il_layout layouts[] = {IL_LAYOUT_ROW_MAJOR, IL_LAYOUT_TILED};
+    for (size_t j = 0; j < sizeof(layouts) / sizeof(layouts[0]); ++j) {
+      struct il_large_problem *lp =
+          il_large_problem_create(IL_AXIS - 2, IL_AXIS - 2, layouts[j]);
+      ASSERT_TRUE(lp != NULL);
+      for (size_t x = 0; x < IL_AXIS - 2; ++x)
+        for (size_t y = 0; y < IL_AXIS - 2; ++y)
+          il_large_problem_set(lp, x, y, p.board[x + 1][y + 1]);
+      size_t count = 0;
+      ASSERT_TRUE(il_large_problem_solve(lp, 0, NULL, large_count_callback,
+                                         &count));
+      ASSERT_TRUE(count == expected);
+      il_large_problem_destroy(lp);
+    }
+  }
+
+  {
+    // Solve random problems by using a scheduler. A single problem is
+    // given a budget that is too small to complete.
+    struct schedule_param params[20];
+    struct il_scheduler *sched = il_scheduler_create(2, 1, 20, 4);
+    ASSERT_TRUE(sched != NULL);
+    for (size_t i = 0; i < 20; ++i) {
+      struct il_solution s;
+      random_solution(&s, 3);
+      il_solution_unsolve(&s, &params[i].problem);
+      params[i].solutions = 0;
+      params[i].completions = 0;
+    }
+    ASSERT_TRUE(il_problem_parse("1cccc1\n1cccc1", &params[0].problem));
+    ASSERT_TRUE(il_scheduler_submit(sched, &params[0].problem, 1,
+                                    schedule_callback, schedule_done,
+                                    &params[0]));
+    for (size_t i = 1; i < 20; ++i)
+      ASSERT_TRUE(il_scheduler_submit(sched, &params[i].problem, 0,
+                                      schedule_callback, schedule_done,
+                                      &params[i]));
+    il_scheduler_destroy(sched);
+
+    ASSERT_TRUE(params[0].completions == 1);
+    ASSERT_TRUE(params[0].status == IL_REQUEST_BUDGET_EXHAUSTED);
+    for (size_t i = 1; i < 20; ++i) {
+      size_t expected = 0;
+      il_problem_solve(&params[i].problem, count_callback, &expected);
+      ASSERT_TRUE(params[i].completions == 1);
+      ASSERT_TRUE(params[i].status == IL_REQUEST_COMPLETED);
+      ASSERT_TRUE(params[i].solutions == expected);
+    }
+  }
+
+  {
+    // Schedulers that could never complete a request should be
+    // rejected. Zero pending requests means there is no limit.
+    ASSERT_TRUE(il_scheduler_create(0, 1, 20, 4) == NULL);
+    ASSERT_TRUE(il_scheduler_create(1, 1, 20, 0) == NULL);
+    struct il_scheduler *sched = il_scheduler_create(1, 0, 0, 4);
+    ASSERT_TRUE(sched != NULL);
+    struct schedule_param params[50];
+    for (size_t i = 0; i < 50; ++i) {
+      ASSERT_TRUE(il_problem_parse("cc\ncc", &params[i].problem));
+      params[i].solutions = 0;
+      params[i].completions = 0;
+      ASSERT_TRUE(il_scheduler_submit(sched, &params[i].problem, 0,
+                                      schedule_callback, schedule_done,
+                                      &params[i]));
+    }
+    il_scheduler_destroy(sched);
+    for (size_t i = 0; i < 50; ++i) {
+      ASSERT_TRUE(params[i].completions == 1);
+      ASSERT_TRUE(params[i].status == IL_REQUEST_COMPLETED);
+      ASSERT_TRUE(params[i].solutions == 1);
+    }
+  }
+
+  {
+    // Solving random problems in parallel, either individually or as a
+    // batch, should yield the same number of solutions.
+    struct il_problem problems[20];
+    size_t expected[20], found[20];
+    for (size_t i = 0; i < 20; ++i) {
+      struct il_solution s;
+      random_solution(&s, 3);
+      il_solution_unsolve(&s, &problems[i]);
+      expected[i] = 0;
+      il_problem_solve(&problems[i], count_callback, &expected[i]);
+
+      size_t count = 0;
+      struct il_parallel_stats stats;
+      ASSERT_TRUE(il_problem_solve_parallel(&problems[i], 3, 0, &stats,
+                                            count_callback, &count));
+      ASSERT_TRUE(count == expected[i]);
+      double solutions;
+      ASSERT_TRUE(il_problem_count_parallel(&problems[i], 3,
+                                            IL_PARALLEL_TRANSPOSITIONS, &stats,
+                                            &solutions));
+      ASSERT_TRUE((size_t)solutions == expected[i]);
+
+      // Solutions should be reported in a fixed order when requested.
+      struct digest_param sequential, parallel = {.digest = 0xcbf29ce484222325};
+      deterministic_digest(&problems[i], &sequential);
+      ASSERT_TRUE(sequential.count == expected[i]);
+      ASSERT_TRUE(il_problem_solve_parallel(&problems[i], 3,
+                                            IL_PARALLEL_ORDERED, &stats,
+                                            digest_callback, &parallel));
+      ASSERT_TRUE(parallel.count == expected[i]);
+      ASSERT_TRUE(parallel.digest == sequential.digest);
+      found[i] = 0;
+    }
+    ASSERT_TRUE(il_problem_solve_batch(problems, 20, 3, 0, NULL,
+                                       batch_callback, found));
+    for (size_t i = 0; i < 20; ++i) {
+      ASSERT_TRUE(found[i] == expected[i]);
+      found[i] = 0;
+    }
+    ASSERT_TRUE(il_problem_solve_batch(problems, 20, 5, IL_PARALLEL_NUMA, NULL,
+                                       batch_callback, found));
+    for (size_t i = 0; i < 20; ++i)
+      ASSERT_TRUE(found[i] == expected[i]);
+
+    // Threads sharing a queue may steal work at the same time. No
+    // puzzles should get lost when that happens.
+    for (int run = 0; run < 50; ++run) {
+      for (size_t i = 0; i < 20; ++i)
+        found[i] = 0;
+      ASSERT_TRUE(il_problem_solve_batch_numa(problems, 20, 12, 3,
+                                              IL_PARALLEL_NUMA, NULL,
+                                              batch_callback, found));
+      for (size_t i = 0; i < 20; ++i)
+        ASSERT_TRUE(found[i] == expected[i]);
+    }
+  }
+
+  {
+    // A block of 6x6 dead ends has a solution for every way of tiling
+    // it with dominoes. Its search tree is large enough for work to be
+    // handed over between threads many times, which should not affect
+    // the order in which solutions are reported.
+    struct il_solution s = {};
+    for (size_t x = 0; x < 6; x += 2)
+      for (size_t y = 0; y < 6; ++y)
+        s.horizontal[x][y] = true;
+    struct il_problem p;
+    il_solution_unsolve(&s, &p);
+    struct digest_param sequential, parallel = {.digest = 0xcbf29ce484222325};
+    deterministic_digest(&p, &sequential);
+    ASSERT_TRUE(sequential.count == 6728);
+    struct il_parallel_stats stats;
+    ASSERT_TRUE(il_problem_solve_parallel(&p, 3, IL_PARALLEL_ORDERED, &stats,
+                                          digest_callback, &parallel));
+    ASSERT_TRUE(parallel.count == sequential.count);
+    ASSERT_TRUE(parallel.digest == sequential.digest);
+  }
+
+  {
+    // Solutions of boards consisting of independent parts can be
+    // counted by using a transposition table, as the parts are placed
+    // in many different orders. Even a table that is far too small
+    // should yield the right number of solutions.
+    struct il_problem p;
+    ASSERT_TRUE(
+        il_problem_parse("1cc11cc1\n1cc11cc1\n\n1cc11cc1\n1cc11cc1", &p));
+    size_t expected = 0;
+    il_problem_solve(&p, count_callback, &expected);
+    ASSERT_TRUE(expected > 1);
+
+    const size_t sizes[] = {1, 1 << 10, 1 << 20};
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+      struct il_table *t = il_table_create(sizes[i]);
+      ASSERT_TRUE(t != NULL);
+      struct il_solver *solver = il_solver_create(&p, NULL, NULL);
+      ASSERT_TRUE(solver != NULL);
+      il_solver_set_table(solver, t);
+      ASSERT_TRUE(il_solver_run(solver, ULONG_MAX));
+      struct il_solver_stats stats;
+      il_solver_get_stats(solver, &stats);
+      ASSERT_TRUE((size_t)stats.solutions == expected);
+      ASSERT_TRUE(stats.table_hits > 0);
+      il_solver_destroy(solver);
+      il_table_destroy(t);
+    }
+
+    double solutions;
+    struct il_parallel_stats stats;
+    ASSERT_TRUE(il_problem_count_parallel(&p, 3, IL_PARALLEL_TRANSPOSITIONS,
+                                          &stats, &solutions));
+    ASSERT_TRUE((size_t)solutions == expected);
+    size_t count = 0;
+    ASSERT_TRUE(il_problem_solve_parallel(&p, 3, IL_PARALLEL_TRANSPOSITIONS,
+                                          &stats, count_callback, &count));
+    ASSERT_TRUE(count == expected);
+  }
+
+  {
+    // A staircase of corners running against the order in which cells
+    // are stored is fully determined by its dead ends. Propagation
+    // should place all of it without making any guesses.
+    struct il_solution s = {};
+    for (size_t i = 0; i < IL_AXIS - 3; ++i) {
+      s.horizontal[i][IL_AXIS - 3 - i] = true;
+      s.vertical[i][IL_AXIS - 4 - i] = true;
+    }
+    struct il_problem p;
+    il_solution_unsolve(&s, &p);
+    struct il_solver *solver = il_solver_create(&p, NULL, NULL);
+    ASSERT_TRUE(solver != NULL);
+    ASSERT_TRUE(il_solver_run(solver, ULONG_MAX));
+    struct il_solver_stats stats;
+    il_solver_get_stats(solver, &stats);
+    ASSERT_TRUE(stats.nodes == 1);
+    ASSERT_TRUE(stats.solutions > 0.5 && stats.solutions < 1.5);
+    il_solver_destroy(solver);
+  }
+
+  {
+    // Puzzles in which the number of outgoing edges is odd cannot be
+    // solved. Their refutations should be accepted, unless tampered with.
+    struct il_problem p;
+    ASSERT_TRUE(il_problem_parse("1sssss", &p));
+    struct buffer_param param = {.data = NULL, .len = 0};
+    ASSERT_TRUE(il_problem_refute(&p, buffer_sink, &param));
+    ASSERT_TRUE(il_refutation_check(&p, param.data, param.len));
+    free(param.data);
+
+    // Eliminating a rotation that is consistent with the neighbours of a
+    // cell or leaving out a rotation of a branch should cause the
+    // refutation to be rejected. This puzzle needs a branch to be
+    // refuted.
+    const char kinds[] = {'e', 'b'};
+    ASSERT_TRUE(il_problem_parse("c111\n1c31\n1c11", &p));
+    param = (struct buffer_param){.data = NULL, .len = 0};
+    ASSERT_TRUE(il_problem_refute(&p, buffer_sink, &param));
+    ASSERT_TRUE(il_refutation_check(&p, param.data, param.len));
+    for (size_t j = 0; j < sizeof(kinds); ++j) {
+      char *data = malloc(param.len);
+      ASSERT_TRUE(data != NULL);
+      memcpy(data, param.data, param.len);
+      ASSERT_TRUE(refutation_drop_rotation(data, param.len, kinds[j]));
+      ASSERT_TRUE(!il_refutation_check(&p, data, param.len));
+      free(data);
+    }
+    free(param.data);
+
+    for (int i = 0; i < 100; ++i) {
+      struct il_solution s;
+      random_solution(&s, 3);
+      il_solution_unsolve(&s, &p);
+      param = (struct buffer_param){.data = NULL, .len = 0};
+      ASSERT_TRUE(!il_problem_refute(&p, buffer_sink, &param));
+      ASSERT_TRUE(param.len == 0);
+
+      p.board[arc4random_uniform(IL_AXIS - 2) + 1]
+             [arc4random_uniform(IL_AXIS - 2) + 1] ^=
+          (unsigned char)(1 << arc4random_uniform(4));
+      ASSERT_TRUE(il_problem_refute(&p, buffer_sink, &param));
+      ASSERT_TRUE(il_refutation_check(&p, param.data, param.len));
+
+      // Leaving out the last step should cause the refutation to be
+      // incomplete.
+      size_t len = param.len - 1;
+      while (len > 0 && param.data[len - 1] != '\n')
+        --len;
+      ASSERT_TRUE(!il_refutation_check(&p, param.data, len));
+
+      // The same holds for the steps of random puzzles.
+      for (size_t j = 0; j < sizeof(kinds); ++j) {
+        char *data = malloc(param.len);
+        ASSERT_TRUE(data != NULL);
+        memcpy(data, param.data, param.len);
+        if (refutation_drop_rotation(data, param.len, kinds[j]))
+          ASSERT_TRUE(!il_refutation_check(&p, data, param.len));
+        free(data);
+      }
+      free(param.data);
+    }
+  }
+
+  {
+    // A board with more solutions than can be buffered should still
+    // have its solutions reported in a fixed order.
+    struct il_problem p;
+    ASSERT_TRUE(il_problem_parse(
+        "1cc11cc11cc1\n1cc11cc11cc1\n\n1cc11cc11cc1\n1cc11cc11cc1\n\n"
+        "1cc11cc11cc1\n1cc11cc11cc1",
+        &p));
+    struct digest_param sequential;
+    deterministic_digest(&p, &sequential);
+    ASSERT_TRUE(sequential.count == 2197);
+    for (size_t nthreads = 1; nthreads <= 8; nthreads *= 2) {
+      struct digest_param parallel = {.digest = 0xcbf29ce484222325};
+      ASSERT_TRUE(il_problem_solve_parallel(
+          &p, nthreads, IL_PARALLEL_ORDERED | IL_PARALLEL_TRANSPOSITIONS, NULL,
+          digest_callback, &parallel));
+      ASSERT_TRUE(parallel.count == sequential.count);
+      ASSERT_TRUE(parallel.digest == sequential.digest);
+    }
+  }
+
+  {
+    // Solve a board that is too large for struct il_problem, by
+    // generating a random solution and converting it to a problem.
+    struct il_large_problem *lp =
+        random_large_problem(100, 70, IL_LAYOUT_TILED);
+    ASSERT_TRUE(il_large_problem_solve(lp, IL_LARGE_HUGE_PAGES, NULL,
+                                       large_valid_callback, lp));
+    il_large_problem_destroy(lp);
+  }
+
+  {
+    // The clusters of a small random board are counted exactly, so the
+    // approximate number of solutions should match the actual number.
+    struct il_large_problem *lp =
+        random_large_problem(16, 12, IL_LAYOUT_ROW_MAJOR);
+    size_t count = 0;
+    ASSERT_TRUE(
+        il_large_problem_solve(lp, 0, NULL, large_count_callback, &count));
+    double log2_count;
+    ASSERT_TRUE(il_large_problem_count_approx(lp, 0.5, 0.01, 0, &log2_count));
+    ASSERT_TRUE(fabs(log2_count - log2((double)count)) < 1e-9);
+
+    // Boards without any solutions should be detected.
+    il_large_problem_set(lp, 0, 0, 0xf);
+    ASSERT_TRUE(il_large_problem_count_approx(lp, 0.5, 0.01, 0, &log2_count));
+    ASSERT_TRUE(isinf(log2_count) && log2_count < 0.0);
+    il_large_problem_destroy(lp);
+  }
+
+  {
+    // Approximating by adding parity constraints should be close to the
+    // actual number of solutions. Pick a board having enough solutions
+    // that constraints need to be added. The random constraints are not
+    // seeded, so allow a factor of two instead of the requested
+    // tolerance, which a correct estimate practically never exceeds.
+    struct il_large_problem *lp;
+    size_t count;
+    for (;;) {
+      lp = random_large_problem(32, 24, IL_LAYOUT_ROW_MAJOR);
+      count = 0;
+      ASSERT_TRUE(
+          il_large_problem_solve(lp, 0, NULL, large_count_callback, &count));
+      if (count >= 256 && count <= 1024)
+        break;
+      il_large_problem_destroy(lp);
+    }
+    double log2_count;
+    ASSERT_TRUE(il_large_problem_count_approx(
+        lp, 0.5, 0.01, IL_LARGE_NO_EXACT_COUNT, &log2_count));
+    ASSERT_TRUE(fabs(log2_count - log2((double)count)) <= 1.0);
+    il_large_problem_destroy(lp);
+  }
+
+  {
+    // Parity constraints should prune the search early enough to
+    // approximate the number of solutions of a board of a thousand cells
+    // within seconds. The exact count is obtained by counting clusters
+    // separately.
+    struct il_large_problem *lp;
+    double log2_exact;
+    for (;;) {
+      lp = random_large_problem(32, 32, IL_LAYOUT_ROW_MAJOR);
+      ASSERT_TRUE(il_large_problem_count_approx(lp, 0.8, 0.2, 0, &log2_exact));
+      if (log2_exact >= 12.0 && log2_exact <= 20.0)
+        break;
+      il_large_problem_destroy(lp);
+    }
+    struct timespec start, end;
+    ASSERT_TRUE(clock_gettime(CLOCK_MONOTONIC, &start) == 0);
+    double log2_count;
+    ASSERT_TRUE(il_large_problem_count_approx(
+        lp, 0.8, 0.2, IL_LARGE_NO_EXACT_COUNT, &log2_count));
+    ASSERT_TRUE(clock_gettime(CLOCK_MONOTONIC, &end) == 0);
+    ASSERT_TRUE(end.tv_sec - start.tv_sec < 10);
+    ASSERT_TRUE(fabs(log2_count - log2_exact) <= 1.0);
+    il_large_problem_destroy(lp);
+  }
+
+  for (int layout = IL_LAYOUT_ROW_MAJOR; layout <= IL_LAYOUT_TILED; ++layout) {
+    // Local search should find a single solution of a large random
+    // board by itself, without falling back to complete search.
+    struct il_large_problem *lp =
+        random_large_problem(300, 200, (enum il_layout)layout);
+    struct large_local_param param = {.p = lp};
+    struct il_large_stats stats;
+    ASSERT_TRUE(il_large_problem_solve_local(lp, 0, &stats,
+                                             large_local_callback, &param));
+    ASSERT_TRUE(param.count == 1);
+    ASSERT_TRUE(stats.nodes == 0 && stats.flips > 0);
+    il_large_problem_destroy(lp);
+  }
+
+  {
+    // Toggling a single edge of a board makes it unsolvable, as the
+    // number of edges becomes odd. Local search can't detect this, so
+    // it has to fall back to complete search.
+    struct il_large_problem *lp =
+        random_large_problem(16, 12, IL_LAYOUT_ROW_MAJOR);
+    il_large_problem_set(lp, 8, 6, il_large_problem_get(lp, 8, 6) ^ 0x2);
+    struct large_local_param param = {.p = lp};
+    struct il_large_stats stats;
+    ASSERT_TRUE(il_large_problem_solve_local(lp, 0, &stats,
+                                             large_local_callback, &param));
+    ASSERT_TRUE(param.count == 0);
+    ASSERT_TRUE(stats.nodes > 0);
+    il_large_problem_destroy(lp);
+  }
+
+  {
+    // Store the solutions of random problems in a snapshot. Looking them
+    // up should yield the same solutions as solving them, even if the
+    // cells are oriented differently. Solutions are generated in random
+    // order, so they are sorted before being compared.
+    struct il_problem problems[50];
+    for (size_t i = 0; i < 50; ++i) {
+      struct il_solution s;
+      random_solution(&s, 3);
+      il_solution_unsolve(&s, &problems[i]);
+    }
+    char path[] = "/tmp/infiniteloop_test.XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_TRUE(fd >= 0);
+    close(fd);
+    ASSERT_TRUE(il_snapshot_build(path, problems, 40, 15));
+    struct il_snapshot *snapshot = il_snapshot_open(path);
+    ASSERT_TRUE(snapshot != NULL);
+    unlink(path);
+
+    for (size_t i = 0; i < 50; ++i) {
+      struct collect_param expected = {.nsolutions = 0};
+      il_problem_solve(&problems[i], collect_callback, &expected);
+      for (size_t x = 1; x < IL_AXIS - 1; ++x)
+        for (size_t y = 1; y < IL_AXIS - 1; ++y)
+          problems[i].board[x][y] = (unsigned char)(
+              (problems[i].board[x][y] << 1 | problems[i].board[x][y] >> 3) &
+              0xf);
+      struct collect_param found = {.nsolutions = 0};
+      if (i < 40 && expected.nsolutions <= 15) {
+        ASSERT_TRUE(il_snapshot_lookup(snapshot, &problems[i],
+                                       collect_callback, &found));
+        ASSERT_TRUE(found.nsolutions == expected.nsolutions);
+        qsort(found.solutions, found.nsolutions, sizeof(found.solutions[0]),
+              compare_solutions);
+        qsort(expected.solutions, expected.nsolutions,
+              sizeof(expected.solutions[0]), compare_solutions);
+        ASSERT_TRUE(memcmp(found.solutions, expected.solutions,
+                           found.nsolutions * sizeof(found.solutions[0])) == 0);
+      } else {
+        ASSERT_TRUE(!il_snapshot_lookup(snapshot, &problems[i],
+                                        collect_callback, &found));
+        ASSERT_TRUE(found.nsolutions == 0);
+      }
+    }
+    il_snapshot_close(snapshot);
+  }
+
+  {
+    // Entries are validated when they are looked up. An entry referring
+    // to solutions past the end of the snapshot should be ignored.
+    struct il_problem p;
+    ASSERT_TRUE(il_problem_parse("1cc1\n1cc1", &p));
+    char path[] = "/tmp/infiniteloop_test.XXXXXX";
+    int fd = mkstemp(path);
+    ASSERT_TRUE(fd >= 0);
+    close(fd);
+    ASSERT_TRUE(il_snapshot_build(path, &p, 1, 2));
+    fd = open(path, O_WRONLY);
+    ASSERT_TRUE(fd >= 0);
+    const uint32_t entry[2] = {0, UINT32_MAX};
+    ASSERT_TRUE(pwrite(fd, entry, sizeof(entry), 32 + sizeof(uint64_t)) ==
+                sizeof(entry));
+    close(fd);
+    struct il_snapshot *snapshot = il_snapshot_open(path);
+    ASSERT_TRUE(snapshot != NULL);
+    unlink(path);
+    size_t count = 0;
+    ASSERT_TRUE(!il_snapshot_lookup(snapshot, &p, count_callback, &count));
+    ASSERT_TRUE(count == 0);
+    il_snapshot_close(snapshot);
+  }
+
+  // Puzzles without solutions have no backbone or statistics.
+  {
+    struct il_problem p;
+    ASSERT_TRUE(il_problem_parse("1sssss", &p));
+    struct il_backbone b;
+    ASSERT_TRUE(!il_problem_backbone(&p, &b));
+    struct il_marginals m;
+    il_problem_marginals(&p, &m);
+    ASSERT_TRUE(count_equal(m.solutions, 0.0));
   }
 }